@@ -49,6 +49,7 @@ my $bSerp = 0x1;                # serpentine path
 my $bSquare = 0x2;              # square_wave path
 my $bGroup = 0x4;               # group path
 my $bSimd = 0x8;                # simd prefix
+my $bMorton = 0x10;             # morton path
 
 ##########
 # Function to make names of variables based on dimension string(s).
@@ -120,6 +121,12 @@ sub groupOffsetVar {
 sub numLocalGroupItersVar {
     return join('_', 'num_iters_in_group', @_);
 }
+sub numBitsVar {
+    return join('_', 'num_bits', @_);
+}
+sub numMortonItersVar {
+    return join('_', 'num_morton_iters', @_);
+}
 sub loopIndexVar {
     return join('_', 'loop_index', @_);
 }
@@ -213,6 +220,15 @@ sub addIndexVars1($$$) {
                     " // Number of *full* groups in $dim dimension.",
                     " const $itype $ntvar = $nvar / $ntivar;";
                 }
+
+                # For morton loops.
+                if ($features & $bMorton) {
+                    my $nbvar = numBitsVar($dim);
+                    push @$code,
+                    " // Number of bits needed for index in $dim dimension.",
+                    " int $nbvar = 0;",
+                    " while ((idx_t(1) << $nbvar) < $nvar) $nbvar++;";
+                }
             }
 
             # Pass 1: Product of sizes of this and remaining nested dimensions.
@@ -229,6 +245,16 @@ sub addIndexVars1($$$) {
             }
         }
     }
+
+    # Morton loops scan the index space padded to a power of 2 in each dim.
+    if ($features & $bMorton) {
+        my $mnvar = numMortonItersVar(@$loopDims);
+        my $nbval = join(' + ', map { numBitsVar($_) } @$loopDims);
+        push @$code,
+        " // Number of iterations in ".dimStr(@$loopDims).
+            " after padding each to a power of 2 for 'morton' path.",
+        " const $itype $mnvar = idx_t(1) << ($nbval);";
+    }
 }
 
 # Add index variables *inside* the loop.
@@ -243,8 +269,47 @@ sub addIndexVars2($$$$) {
     my $outerDim = $loopDims->[0];            # outer dim of these loops.
     my $innerDim = $loopDims->[$#$loopDims];  # inner dim of these loops.
 
+    # Morton (Z-order) path.
+    if ($features & $bMorton) {
+
+        die "error: grouping not compatible with morton.\n"
+            if $features & $bGroup;
+        die "error: serpentine not compatible with morton.\n"
+            if $features & $bSerp;
+        die "error: square-wave not compatible with morton.\n"
+            if $features & $bSquare;
+
+        # De-interleave bits of the loop index, assigning them
+        # round-robin from the inner dim to the outer dim while each dim
+        # has bits remaining.
+        push @$code,
+        " // Zero-based, unit-stride indices for ".dimStr(@$loopDims).".";
+        for my $dim (@$loopDims) {
+            push @$code, " idx_t ".indexVar($dim)." = 0;";
+        }
+        push @$code,
+        " // Distribute bits of $civar among dimensions for 'morton' path.",
+        " {",
+        "  idx_t morton_bits = $civar;",
+        "  for (int bit = 0; morton_bits; bit++) {";
+        for my $dim (reverse @$loopDims) {
+            my $divar = indexVar($dim);
+            push @$code,
+            "   if (bit < ".numBitsVar($dim).") {",
+            "    $divar |= (morton_bits & 1) << bit;",
+            "    morton_bits >>= 1;",
+            "   }";
+        }
+        push @$code,
+        "  }",
+        " }",
+        " // Skip indices in the padding.",
+        " if (".join(' || ', map { indexVar($_)." >= ".numItersVar($_) } @$loopDims).")",
+        "  continue;";
+    }
+
     # Grouping.
-    if ($features & $bGroup) {
+    elsif ($features & $bGroup) {
 
         die "error: serpentine not compatible with grouping.\n"
             if $features & $bSerp;
@@ -471,6 +536,7 @@ sub beginLoop($$$$$$$) {
     my $loopStack = shift;      # whole stack, including enclosing dims.
 
     $endVal = numItersVar(@$loopDims) if !defined $endVal;
+    $endVal = numMortonItersVar(@$loopDims) if $features & $bMorton;
     my $itype = indexType(@$loopDims);
     my $ivar = loopIndexVar(@$loopDims);
     push @$code, @$prefix if defined $prefix;
@@ -639,7 +705,7 @@ sub getArgs($$) {
     return @args;
 }
 
-# Process the loop-code string.
+# Process the loop-code string and return the lines of code.
 # This is where most of the work is done.
 sub processCode($) {
     my $codeString = shift;
@@ -670,13 +736,6 @@ sub processCode($) {
     
     # Front matter.
     push @code,
-        "#ifndef OMP_PRAGMA_PREFIX",
-        "#define OMP_PRAGMA_PREFIX $OPT{ompConstruct}",
-        "#endif",
-        "#ifndef OMP_PRAGMA_SUFFIX",
-        "#define OMP_PRAGMA_SUFFIX",
-        "#endif",
-        "// 'ScanIndices $inputVar' must be set before the following code.",
         "{",
         " // Indices for function calls.",
         " ScanIndices ".locVar()."($inputVar);";
@@ -721,6 +780,11 @@ sub processCode($) {
             $features |= $bSquare;
         }
         
+        # use morton path in next loop.
+        elsif (lc $tok eq 'morton') {
+            $features |= $bMorton;
+        }
+        
         # beginning of a loop.
         # also eats the args in parens and the following '{'.
         elsif (lc $tok eq 'loop') {
@@ -869,9 +933,50 @@ sub processCode($) {
     die "error: ".(scalar @loopStack)." loop(s) not closed.\n"
         if @loopStack;
 
+    # Back matter.
+    push @code, "}";
+    return @code;
+}
+
+# Generate code for each variant and write it to the output file.
+sub writeCode(@) {
+    my @codeStrings = @_;
+
+    # Lines of code to output.
+    my @code;
+
+    # Front matter.
+    push @code,
+        "#ifndef OMP_PRAGMA_PREFIX",
+        "#define OMP_PRAGMA_PREFIX $OPT{ompConstruct}",
+        "#endif",
+        "#ifndef OMP_PRAGMA_SUFFIX",
+        "#define OMP_PRAGMA_SUFFIX",
+        "#endif",
+        "// 'ScanIndices $inputVar' must be set before the following code.";
+
+    # Only one variant: no selection needed.
+    if (@codeStrings == 1) {
+        push @code, processCode($codeStrings[0]);
+    }
+
+    # Select variant at run-time; values out of range use the first one.
+    else {
+        push @code,
+            "// Select one of ".scalar(@codeStrings)." loop variants.",
+            "switch ($OPT{variantVar}) {";
+        for my $i (0 .. $#codeStrings) {
+            print "info: generating loop variant $i...\n";
+            push @code, "default:" if $i == 0;
+            push @code, "case $i:";
+            push @code, processCode($codeStrings[$i]);
+            push @code, "break;";
+        }
+        push @code, "}";
+    }
+
     # Back matter.
     push @code,
-        "}",
         "#undef OMP_PRAGMA_PREFIX",
         "#undef OMP_PRAGMA_SUFFIX",
         "// End of generated code.";
@@ -899,13 +1004,16 @@ sub processCode($) {
         " * N = ",$#dims,";\n";
 
     # format input to show in the header.
-    my $cmd2 = "echo '$codeString'";
-    $cmd2 .= " | $indent -" if (defined $indent);
-    open IN, "$cmd2 |" or die "error: cannot run '$cmd2'.\n";
-    while (<IN>) {
-        print OUT " * $_";
+    for my $i (0 .. $#codeStrings) {
+        print OUT " * Variant $i:\n" if @codeStrings > 1;
+        my $cmd2 = "echo '$codeStrings[$i]'";
+        $cmd2 .= " | $indent -" if (defined $indent);
+        open IN, "$cmd2 |" or die "error: cannot run '$cmd2'.\n";
+        while (<IN>) {
+            print OUT " * $_";
+        }
+        close IN;
     }
-    close IN;
     print OUT " *\n */";
 
     # print out code.
@@ -928,6 +1036,7 @@ sub main() {
         [ "callPrefix=s", "Common prefix for function call(s).", ''],
         [ "ompConstruct=s", "Pragma to use before 'omp' loop(s).", "omp parallel for"],
         [ "innerMod=s", "Code to insert before inner loops.", ''],
+        [ "variantVar=s", "Expression selecting the code variant to run when more than one is given.", ''],
         [ "output=s", "Name of output file.", 'loops.h'],
         );
     my($command_line) = process_command_line(\%OPT, \@KNOBS);
@@ -943,11 +1052,16 @@ sub main() {
             "  using the variable 'N' as needed.\n",
             "Inner loops should contain call statements that generate calls to calculation functions.\n",
             "A loop statement with more than one argument will generate a single collapsed loop.\n",
+            "Alternative code variants may be separated by '|' in the <code-string>.\n",
+            "  All variants are generated, and the one to run is selected by the value\n",
+            "  of the -variantVar expression at run-time (0 for the first variant).\n",
             "Optional loop modifiers:\n",
             "  omp:             generate an OpenMP for loop (distribute work across SW threads).\n",
             "  grouped:         generate grouped scan within a collapsed loop.\n",
             "  serpentine:      generate reverse scan when enclosing loop dimension is odd.\n",
             "  square_wave:     generate 2D square-wave scan for two innermost dimensions of a collapsed loop.\n",
+            "  morton:          generate Z-order scan within a collapsed loop, padding each dimension\n",
+            "                   to a power of 2 and skipping the padding.\n",
             "A 'ScanIndices' var must be defined in C++ code prior to including the generated code.\n",
             "  This struct contains the following 'Indices' elements:\n",
             "  'begin':       [in] first index to scan in each dim.\n",
@@ -969,8 +1083,10 @@ sub main() {
             "  $script -ndims 3 'omp loop(0,1) { loop(2) { call(f); } }'\n",
             "  $script -ndims 3 'omp loop(0) { loop(1,2) { call(f); } }'\n",
             "  $script -ndims 3 'grouped omp loop(0..N-1) { call(f); }'\n",
+            "  $script -ndims 3 'morton omp loop(0..N-1) { call(f); }'\n",
             "  $script -ndims 3 'omp loop(0) { serpentine loop(1..N-1) { call(f); } }'\n",
-            "  $script -ndims 4 'omp loop(0..N+1) { serpentine loop(N+2,N-1) { call(f); } }'\n";
+            "  $script -ndims 4 'omp loop(0..N+1) { serpentine loop(N+2,N-1) { call(f); } }'\n",
+            "  $script -ndims 3 -variantVar v 'omp loop(0,1) { call(f); } | omp loop(1,0) { call(f); }'\n";
         exit 1;
     }
 
@@ -979,7 +1095,13 @@ sub main() {
     $inputVar = $OPT{inVar};
 
     my $codeString = join(' ', @ARGV); # just concat all non-options params together.
-    processCode($codeString);
+
+    # Split into variants, ignoring empty ones.
+    my @codeStrings = grep { /\S/ } split /\|/, $codeString;
+    die "error: no code given.\n" if !@codeStrings;
+    die "error: '-variantVar' must be set when multiple code variants are given.\n"
+        if @codeStrings > 1 && $OPT{variantVar} eq '';
+    writeCode(@codeStrings);
 }
 
 main();
@@ -618,9 +618,12 @@ namespace yask {
         /**
            Under normal operation, an auto-tuner is invoked automatically during calls to
            run_solution().
-           Currently, only the block size is set by the auto-tuner, and the search begins from the 
+           By default, only the block size is set by the auto-tuner, and the search begins from the 
            sizes set via set_block_size() or the default size if set_block_size() has
            not been called.
+           Other levels of tiling and the number of threads per block may be
+           searched by setting the `-auto_tune_levels` option via
+           apply_command_line_options().
            This function is used to apply the current best-known settings if the tuner has
            been running, reset the state of the auto-tuner, and either
            restart its search or disable it from running.
@@ -654,10 +657,14 @@ namespace yask {
            until the auto-tuner converges on all ranks.
            It is useful for benchmarking, where performance is to be timed
            for a given number of steps after the best settings are found.
+           If the `-ts` option sets a sample size smaller than the rank domain,
+           only a sub-domain of that size in the center of each rank is evaluated,
+           which makes each measurement faster for large domains.
            This function should be called only *after* calling prepare_solution().
            This call must be made on each rank.
            @warning Modifies the contents of the grids by calling run_solution()
-           an arbitrary number of times, but without halo exchange.
+           an arbitrary number of times, but without halo exchange
+           unless the `-tune_halo_exchange` option is set.
            (See run_solution() for other restrictions and warnings.)
            Thus, grid data should be set *after* calling this function when
            used in a production or test setting where correct results are expected.
@@ -666,6 +673,37 @@ namespace yask {
         run_auto_tuner_now(bool verbose = true
                            /**< [in] If _true_, print progress information to the debug object
                               set via set_debug_output(). */ ) =0;
+
+        /// **[Advanced]** Apply settings from a file of previous auto-tuner results.
+        /**
+           Each entry in the file holds the tuned settings for one
+           combination of stencil name, target architecture, vector fold and
+           cluster sizes, rank-domain sizes, number of ranks and threads, and element size.
+           If an entry matches this solution, its region, block, sub-block,
+           and group sizes and block-thread count are applied.
+           The auto-tuner, if enabled, will start its search from these settings;
+           call reset_auto_tuner(false) to use them without further tuning.
+           This function should be called only *after* calling prepare_solution().
+           This call must be made on each rank. Since the entry includes the
+           rank-domain sizes, ranks may match different entries; the settings are
+           applied only if every rank finds a match.
+           @returns _true_ if a matching entry was found and applied on all ranks.
+        */
+        virtual bool
+        load_auto_tuner_db(const std::string& file_name
+                           /**< [in] Name of file written by save_auto_tuner_db().
+                              A missing file is treated as having no entries. */ ) =0;
+
+        /// **[Advanced]** Save current settings to a file of auto-tuner results.
+        /**
+           Adds or replaces the entry matching this solution as described in
+           load_auto_tuner_db(), keeping all other entries.
+           Typically called after run_auto_tuner_now().
+           This call must be made on each rank; ranks update the file one at a time.
+        */
+        virtual void
+        save_auto_tuner_db(const std::string& file_name
+                           /**< [in] Name of file to create or update. */ ) =0;
         
         /// **[Advanced]** Use data-storage from existing grids in specified solution.
         /**
@@ -918,7 +956,8 @@ namespace yask {
         /// Get the halo size in the specified dimension.
         /**
            This value is typically set by the stencil compiler.
-           @returns Elements in halo in given dimension both before and after the domain.
+           @returns The larger of the halo sizes before and after the domain
+           in the given dimension.
         */
         virtual idx_t
         get_halo_size(const std::string& dim
@@ -926,16 +965,40 @@ namespace yask {
                          Must be one of
                          the names from yk_solution::get_domain_dim_names(). */ ) const =0;
         
+        /// Get the halo size before the domain in the specified dimension.
+        /**
+           This value is typically set by the stencil compiler
+           based on the negative offsets used to read this grid.
+           @returns Elements in halo in given dimension before the domain.
+        */
+        virtual idx_t
+        get_left_halo_size(const std::string& dim
+                           /**< [in] Name of dimension to get.
+                              Must be one of
+                              the names from yk_solution::get_domain_dim_names(). */ ) const =0;
+        
+        /// Get the halo size after the domain in the specified dimension.
+        /**
+           This value is typically set by the stencil compiler
+           based on the positive offsets used to read this grid.
+           @returns Elements in halo in given dimension after the domain.
+        */
+        virtual idx_t
+        get_right_halo_size(const std::string& dim
+                            /**< [in] Name of dimension to get.
+                               Must be one of
+                               the names from yk_solution::get_domain_dim_names(). */ ) const =0;
+        
         /// **[Advanced]** Set the halo size in the specified dimension.
         /**
            This value is typically set by the stencil compiler, but
            this function allows you to override that value.
+           The same size is used both before and after the domain.
            If the halo is set to a value larger than the padding size, the
            padding size will be automatically increase to accomodate it.
            @note After data storage has been allocated, the halo size
            can only be set to a value less than or equal to the padding size
            in the given dimension.
-           @returns Elements in halo in given dimension both before and after the domain.
         */
         virtual void
         set_halo_size(const std::string& dim
@@ -945,6 +1008,30 @@ namespace yask {
                       idx_t size
                       /**< [in] Number of elements in the halo. */ ) =0;
 
+        /// **[Advanced]** Set the halo size before the domain in the specified dimension.
+        /**
+           Same as set_halo_size(), but only affects the halo before the domain.
+        */
+        virtual void
+        set_left_halo_size(const std::string& dim
+                           /**< [in] Name of dimension to set.
+                              Must be one of
+                              the names from yk_solution::get_domain_dim_names(). */,
+                           idx_t size
+                           /**< [in] Number of elements in the halo. */ ) =0;
+
+        /// **[Advanced]** Set the halo size after the domain in the specified dimension.
+        /**
+           Same as set_halo_size(), but only affects the halo after the domain.
+        */
+        virtual void
+        set_right_halo_size(const std::string& dim
+                            /**< [in] Name of dimension to set.
+                               Must be one of
+                               the names from yk_solution::get_domain_dim_names(). */,
+                            idx_t size
+                            /**< [in] Number of elements in the halo. */ ) =0;
+
         /// Get the first index of the halo in this rank in the specified dimension.
         /**
            @returns The first index of halo in this rank or
@@ -975,9 +1062,8 @@ namespace yask {
            The value may be slightly
            larger than that provided via set_min_pad_size()
            or yk_solution::set_min_pad_size() due to rounding.
-           @returns Elements in padding in given dimension before the
-           domain. The number of elements after the domain will be
-           equal to or greater than this.
+           @returns The smaller of the elements in padding in given dimension
+           before and after the domain.
         */
         virtual idx_t
         get_pad_size(const std::string& dim
@@ -985,12 +1071,31 @@ namespace yask {
                          Must be one of
                          the names from yk_solution::get_domain_dim_names(). */ ) const =0;
 
+        /// Get the padding before the domain in the specified dimension.
+        /**
+           @returns Elements in padding in given dimension before the domain.
+        */
+        virtual idx_t
+        get_left_pad_size(const std::string& dim
+                          /**< [in] Name of dimension to get.
+                             Must be one of
+                             the names from yk_solution::get_domain_dim_names(). */ ) const =0;
+
+        /// Get the padding after the domain in the specified dimension.
+        /**
+           @returns Elements in padding in given dimension after the domain.
+        */
+        virtual idx_t
+        get_right_pad_size(const std::string& dim
+                           /**< [in] Name of dimension to get.
+                              Must be one of
+                              the names from yk_solution::get_domain_dim_names(). */ ) const =0;
+
         /// Get the extra padding in the specified dimension.
         /**
            The *extra* padding size is the padding size minus the halo size.
-           @returns Elements in padding in given dimension before the
-           halo region. The number of elements after the halo will be
-           equal to or greater than this.
+           @returns The smaller of the elements in padding in given dimension
+           before and after the halo regions.
         */
         virtual idx_t
         get_extra_pad_size(const std::string& dim
@@ -1291,6 +1396,38 @@ namespace yask {
                               const std::vector<idx_t>& last_indices
                               /**< [in] List of final indices, one for each grid dimension. */ ) =0;
         
+        /// **[Advanced]** Set the NUMA placement of this grid's data.
+        /**
+           Applies to storage allocated by yk_solution::prepare_solution()
+           and overrides any policy for this grid from the `-mem_policy`
+           command-line option.
+           Grids with the same policy share one allocation.
+           Policies:
+           - "default": OS default, usually first-touch.
+           - "hbm": bind to the fast-tier nodes,
+           given by the `-fast_mem_nodes` option or,
+           by default, the nodes with memory but no CPUs.
+           - "ddr": bind to the nodes with memory not in the fast tier.
+           - "bind:<nodes>", "interleave:<nodes>", or "preferred:<node>":
+           apply the given policy to explicit nodes, e.g., "interleave:0-1,4".
+           - "auto": choose "hbm" or "ddr" so that the most frequently read
+           grids are in the fast tier as long as they fit within its capacity.
+           - "": use the `-mem_policy` option (the default).
+
+           If the requested nodes are not available, the default policy is used.
+           Has no effect on storage that is already allocated.
+        */
+        virtual void
+        set_mem_policy(const std::string& policy
+                       /**< [in] Policy as described above. */) =0;
+
+        /// Get the NUMA placement requested via set_mem_policy().
+        /**
+           @returns Policy string or empty string if not set.
+        */
+        virtual const std::string&
+        get_mem_policy() const =0;
+
         /// **[Advanced]** Explicitly allocate data-storage memory for this grid.
         /**
            Amount of allocation is calculated based on domain, padding, and 
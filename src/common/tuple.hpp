@@ -36,6 +36,7 @@ IN THE SOFTWARE.
 #include <sstream>
 #include <functional>
 #include <map>
+#include <mutex>
 #include <set>
 #include <deque>
 #include <vector>
@@ -59,9 +60,12 @@ namespace yask {
         // Use a map instead of a set to have reliable pointers
         // for the string values.
         static std::map<std::string, std::string> _allNames;
+        static std::mutex _allNamesLock;
 
         // Look up names in the pool.
+        // Locked because ranks may be threads in one process.
         static const std::string* _getPoolPtr(const std::string& name) {
+            std::lock_guard<std::mutex> lock(_allNamesLock);
 
             // Get existing entry or add.
             // Add the value to be the same as the key because
@@ -929,5 +933,7 @@ namespace yask {
     // Declare static member.
     template <typename T>
     std::map<std::string, std::string> Scalar<T>::_allNames;
+    template <typename T>
+    std::mutex Scalar<T>::_allNamesLock;
     
 } // namespace yask.
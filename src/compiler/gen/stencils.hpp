@@ -0,0 +1,9 @@
+// Stencil-definition files.
+// Automatically-generated code; do not edit.
+#include "AwpElasticStencil.hpp"
+#include "AwpStencil.hpp"
+#include "ExampleStencil.hpp"
+#include "FSGElasticStencil.hpp"
+#include "Iso3dfdStencil.hpp"
+#include "SSGElasticStencil.hpp"
+#include "SimpleTestStencils.hpp"
@@ -265,6 +265,8 @@ namespace yask {
     // Print prefetches for each base pointer.
     // 'level': cache level.
     // 'ahead': prefetch PF distance ahead instead of up to PF dist.
+    // The distances are read at run-time from the 'pfd_l1' and 'pfd_l2'
+    // vars, so they may be changed without regenerating the code.
     void CppVecPrintHelper::printPrefetches(ostream& os,
                                             bool ahead, string ptrVar) {
 
@@ -273,9 +275,10 @@ namespace yask {
         string imult = "CMULT_" + PrinterBase::allCaps(idim);
 
         for (int level = 1; level <= 2; level++) {
+            string pfd = "pfd_l" + to_string(level);
         
             os << "\n // Prefetch to L" << level << " cache if enabled.\n";
-                os << _linePrefix << "#if PFD_L" << level << " > 0\n";
+                os << _linePrefix << "if (" << pfd << " > 0) {\n";
 
                 // Loop thru vec ptrs.
                 for (auto vp : _vecPtrs) {
@@ -297,23 +300,23 @@ namespace yask {
 
                     // First offset.
                     if (ahead)
-                        os << "(PFD_L" << level << "*" << imult << ")" << hi;
+                        os << "(" << pfd << "*" << imult << ")" << hi;
                     else
                         os << lo;
 
                     // End of offsets.
                     os << "; ofs < ";
                     if (ahead)
-                        os << "((PFD_L" << level << "+1)*" << imult << ")" << hi;
+                        os << "((" << pfd << "+1)*" << imult << ")" << hi;
                     else
-                        os << "(PFD_L" << level << "*" << imult << ")" << hi;
+                        os << "(" << pfd << "*" << imult << ")" << hi;
 
                     // Continue loop.
                     os << "; ofs++)\n" <<
                         _linePrefix << "  prefetch<L" << level << "_HINT>(&" << ptr <<
                         "[" << idim << " + ofs])" << _lineSuffix;
                 }
-                os << _linePrefix << "#endif // L" << level << " prefetch.\n";
+                os << _linePrefix << "} // L" << level << " prefetch.\n";
         }
     }
     
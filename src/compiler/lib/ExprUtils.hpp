@@ -77,7 +77,7 @@ namespace yask {
     // example: a+b+c * b+d+a => c+(a+b) * d+(a+b) w/expr a+b combined.
     class CseVisitor : public OptVisitor {
     protected:
-        set<NumExprPtr> _seen;
+        set<NumExprPtr, std::owner_less<NumExprPtr>> _seen;
     
         // If 'ep' has already been seen, just return true.
         // Else if 'ep' has a match, change pointer to that match, return true.
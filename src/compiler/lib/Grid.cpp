@@ -184,24 +184,41 @@ namespace yask {
             if (p)
                 stepVal = *p;
         }
-        auto& halos = _halos[stepVal];
+        auto& lhalos = _halos[true][stepVal];
+        auto& rhalos = _halos[false][stepVal];
+
+        // Number of domain dims with non-zero offsets.
+        int ndist = 0;
 
         // Update halo vals.
         for (auto& dim : offsets.getDims()) {
             auto& dname = dim.getName();
-            int val = abs(dim.getVal());
+            int ofs = dim.getVal();
 
             // Don't keep halo in step dim.
             if (stepDim && dname == stepDim->getName())
                 continue;
 
-            auto* p = halos.lookup(dname);
-            if (!p)
-                halos.addDimBack(dname, val);
-            else if (val > *p)
-                *p = val;
-            // else, current value is larger than val, so don't update.
+            if (ofs != 0)
+                ndist++;
+
+            // Negative offsets need a left halo; positive offsets
+            // need a right halo. Update both so that dims and
+            // step-vals stay in sync between them.
+            for (bool left : { true, false }) {
+                auto& halos = left ? lhalos : rhalos;
+                int val = left ? std::max(-ofs, 0) : std::max(ofs, 0);
+                auto* p = halos.lookup(dname);
+                if (!p)
+                    halos.addDimBack(dname, val);
+                else if (val > *p)
+                    *p = val;
+                // else, current value is larger than val, so don't update.
+            }
         }
+
+        // Update footprint.
+        _maxExchDist = std::max(_maxExchDist, ndist);
     }
 
     // Update const indices based on 'indices'.
@@ -238,15 +255,21 @@ namespace yask {
         // No info stored?
         if (_halos.size() == 0)
             return 1;
+        auto& lhalos = _halos.at(true);
+        auto& rhalos = _halos.at(false);
+        assert(lhalos.size() == rhalos.size());
+        if (lhalos.size() == 0)
+            return 1;
 
         // Find halos at min and max step-dim points.
         // These should correspond to the 1st read and only write points.
-        auto first_i = _halos.cbegin(); // begin == first.
-        auto last_i = _halos.crbegin(); // reverse-begin == last.
-        int first_ofs = first_i->first;
-        int last_ofs = last_i->first;
-        auto& first_halo = first_i->second;
-        auto& last_halo = last_i->second;
+        // The step-vals are the same for left and right halos.
+        int first_ofs = lhalos.cbegin()->first; // begin == first.
+        int last_ofs = lhalos.crbegin()->first; // reverse-begin == last.
+        int first_halo = std::max(lhalos.at(first_ofs).max(),
+                                  rhalos.at(first_ofs).max());
+        int last_halo = std::max(lhalos.at(last_ofs).max(),
+                                 rhalos.at(last_ofs).max());
 
         // Default step-dim size is range of offsets.
         assert(last_ofs >= first_ofs);
@@ -255,8 +278,8 @@ namespace yask {
         // If first and last halos are zero, we can further optimize storage by
         // immediately reusing memory location.
         if (sz > 1 &&
-            first_halo.max() == 0 &&
-            last_halo.max() == 0)
+            first_halo == 0 &&
+            last_halo == 0)
             sz--;
 
         // TODO: recognize that reading in one equation and then writing in
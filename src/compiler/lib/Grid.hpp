@@ -62,10 +62,15 @@ namespace yask {
         IntTuple _minIndices, _maxIndices;
         
         // Max abs-value of domain-index halos required by all eqs at
-        // various step-index values.
-        // TODO: keep separate 'before' and 'after' halos.
+        // various step-index values, kept separately for the 'before'
+        // (left) and 'after' (right) sides of the domain.
         // TODO: keep separate halos for each equation group.
-        map<int, IntTuple> _halos;  // key: step-dim offset.
+        map<bool, map<int, IntTuple>> _halos;  // keys: is-left, step-dim offset.
+
+        // Max number of domain dims with non-zero offsets in any one
+        // access, i.e., the L1-norm of the farthest neighbor whose data is
+        // needed: 0 => none, 1 => faces, 2 => edges, 3 => corners.
+        int _maxExchDist = 0;
     
     public:
         // Ctors.
@@ -115,10 +120,12 @@ namespace yask {
         virtual const IntTuple& getMinIndices() const { return _minIndices; }
         virtual const IntTuple& getMaxIndices() const { return _maxIndices; }
 
-        // Get the max size in 'dim' of halo across all step dims.
-        virtual int getHaloSize(const string& dim) const {
+        // Get the max size in 'dim' of left or right halo across all step dims.
+        virtual int getHaloSize(const string& dim, bool left) const {
             int h = 0;
-            for (auto i : _halos) {
+            if (_halos.count(left) == 0)
+                return h;
+            for (auto i : _halos.at(left)) {
                 auto& hi = i.second; // halo at step-val 'i'.
                 auto* p = hi.lookup(dim);
                 if (p)
@@ -127,6 +134,9 @@ namespace yask {
             return h;
         }
 
+        // Get the max L1-norm of neighbors whose halo data is read.
+        virtual int getMaxExchDist() const { return _maxExchDist; }
+
         // Determine how many values in step-dim are needed.
         virtual int getStepDimSize() const;
 
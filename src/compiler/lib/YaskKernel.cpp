@@ -338,14 +338,18 @@ namespace yask {
                 // domain dimension.
                 if (dtype == DOMAIN_INDEX) {
 
-                    // Halo for this dimension.
-                    string hvar = grid + "_halo_" + dname;
-                    int hval = _settings._haloSize > 0 ?
-                        _settings._haloSize : gp->getHaloSize(dname);
-                    os << " const idx_t " << hvar << " = " << hval <<
-                        "; // default halo size in '" << dname << "' dimension.\n";
-                    ctorCode += " " + grid + "->set_halo_size(\"" + dname +
-                        "\", " + hvar + ");\n";
+                    // Halos for this dimension.
+                    for (bool left : { true, false }) {
+                        string side = left ? "left" : "right";
+                        string hvar = grid + "_" + side + "_halo_" + dname;
+                        int hval = _settings._haloSize > 0 ?
+                            _settings._haloSize : gp->getHaloSize(dname, left);
+                        os << " const idx_t " << hvar << " = " << hval <<
+                            "; // default " << side << " halo size in '" <<
+                            dname << "' dimension.\n";
+                        ctorCode += " " + grid + "->set_" + side + "_halo_size(\"" + dname +
+                            "\", " + hvar + ");\n";
+                    }
                 }
 
                 // non-domain dimension.
@@ -377,6 +381,12 @@ namespace yask {
                     }
                 }
             }
+
+            // Neighbor footprint for halo exchange.
+            string evar = grid + "_max_exch_dist";
+            os << " const int " << evar << " = " << gp->getMaxExchDist() <<
+                "; // max L1-norm of neighbors needing halo exchange.\n";
+            ctorCode += " " + grid + "->set_max_exch_dist(" + evar + ");\n";
         }
 
         // Ctor.
@@ -564,6 +574,8 @@ namespace yask {
                 os << " idx_t " << iestep << " = " << nelems << "; // number of elements per iter.\n";
                 if (do_cluster)
                     os << " idx_t write_mask = idx_t(-1); // no masking for clusters.\n";
+                os << " const idx_t pfd_l1 = _context->get_prefetch_dist(1); // L1 prefetch distance.\n"
+                    " const idx_t pfd_l2 = _context->get_prefetch_dist(2); // L2 prefetch distance.\n";
 
                 // C++ vector print assistant.
                 CppVecPrintHelper* vp = newCppVecPrintHelper(vv, cv);
@@ -0,0 +1,320 @@
+/*
+ * 4-D grid-scanning code.
+ * Generated automatically from the following pseudo-code:
+ *
+ * N = 3;
+ * Variant 0:
+ * grouped omp loop(1 .. N-1) {  call(calc_sub_block); } 
+ * Variant 1:
+ *  omp loop(1 .. N-1) {  call(calc_sub_block); } 
+ * Variant 2:
+ *  morton omp loop(1 .. N-1) {  call(calc_sub_block); }
+ *
+ */ #ifndef OMP_PRAGMA_PREFIX
+ #define OMP_PRAGMA_PREFIX omp parallel for schedule(static,1) proc_bind(close)
+ #endif
+ #ifndef OMP_PRAGMA_SUFFIX
+ #define OMP_PRAGMA_SUFFIX
+ #endif
+
+ // 'ScanIndices block_idxs' must be set before the following code.
+
+ // Select one of 3 loop variants.
+ switch (opts->_block_loop_variant) {
+ default:
+ case 0:
+ {
+
+  // Indices for function calls.
+  ScanIndices local_indices(block_idxs);
+
+  // ** Begin scan over dimensions 1, 2, 3. **
+
+  // Number of iterations to get from block_idxs.begin[1] to (but not including) block_idxs.end[1], stepping by block_idxs.step[1]. This value is rounded up because the last iteration may cover fewer than block_idxs.step[1] steps.
+  const idx_t num_iters_1 = ((block_idxs.end[1] - block_idxs.begin[1]) + (block_idxs.step[1] - 1)) / block_idxs.step[1];
+
+  // Number of iterations in one full group in 1 dimension. This value is rounded up, effectively increasing the group size if needed to a multiple of block_idxs.step[1].
+  const idx_t num_iters_in_full_group_1 = std::min((block_idxs.group_size[1] + (block_idxs.step[1] - 1)) / block_idxs.step[1], num_iters_1);
+
+  // Number of *full* groups in 1 dimension.
+  const idx_t num_full_groups_1 = num_iters_1 / num_iters_in_full_group_1;
+
+  // Number of iterations to get from block_idxs.begin[2] to (but not including) block_idxs.end[2], stepping by block_idxs.step[2]. This value is rounded up because the last iteration may cover fewer than block_idxs.step[2] steps.
+  const idx_t num_iters_2 = ((block_idxs.end[2] - block_idxs.begin[2]) + (block_idxs.step[2] - 1)) / block_idxs.step[2];
+
+  // Number of iterations in one full group in 2 dimension. This value is rounded up, effectively increasing the group size if needed to a multiple of block_idxs.step[2].
+  const idx_t num_iters_in_full_group_2 = std::min((block_idxs.group_size[2] + (block_idxs.step[2] - 1)) / block_idxs.step[2], num_iters_2);
+
+  // Number of *full* groups in 2 dimension.
+  const idx_t num_full_groups_2 = num_iters_2 / num_iters_in_full_group_2;
+
+  // Number of iterations to get from block_idxs.begin[3] to (but not including) block_idxs.end[3], stepping by block_idxs.step[3]. This value is rounded up because the last iteration may cover fewer than block_idxs.step[3] steps.
+  const idx_t num_iters_3 = ((block_idxs.end[3] - block_idxs.begin[3]) + (block_idxs.step[3] - 1)) / block_idxs.step[3];
+
+  // Number of iterations in one full group in 3 dimension. This value is rounded up, effectively increasing the group size if needed to a multiple of block_idxs.step[3].
+  const idx_t num_iters_in_full_group_3 = std::min((block_idxs.group_size[3] + (block_idxs.step[3] - 1)) / block_idxs.step[3], num_iters_3);
+
+  // Number of *full* groups in 3 dimension.
+  const idx_t num_full_groups_3 = num_iters_3 / num_iters_in_full_group_3;
+
+  // Number of iterations in dimensions 1, 2, 3
+  const idx_t num_iters_1_2_3 = num_iters_1 * num_iters_2 * num_iters_3;
+
+  // Number of iterations in dimensions 2, 3
+  const idx_t num_iters_2_3 = num_iters_2 * num_iters_3;
+
+  // Inner loop.
+ 
+
+  // Distribute iterations among OpenMP threads.
+ #pragma OMP_PRAGMA_PREFIX firstprivate(local_indices) OMP_PRAGMA_SUFFIX
+  for (idx_t loop_index_1_2_3 = 0; loop_index_1_2_3 < num_iters_1_2_3; loop_index_1_2_3++) {
+
+  // Working vars for iterations in groups. These are initialized to full-group counts and then reduced if we are in a partial group.
+  idx_t num_iters_in_group_1 = num_iters_in_full_group_1;
+  idx_t num_iters_in_group_2 = num_iters_in_full_group_2;
+  idx_t num_iters_in_group_3 = num_iters_in_full_group_3;
+
+  // Number of iterations in the set of groups across dimensions 2, 3.
+  idx_t num_iters_in_group_set_2_3 = num_iters_in_group_1 * num_iters_2 * num_iters_3;
+
+  // Index of this group in 1 dimension.
+  idx_t index_of_group_1 = loop_index_1_2_3 / num_iters_in_group_set_2_3;
+
+  // Linear offset within the set of groups across dimensions 2, 3.
+  idx_t index_offset_within_group_set_2_3 = loop_index_1_2_3 % num_iters_in_group_set_2_3;
+
+  // Adjust number of iterations in this group in 1 dimension.
+  if (index_of_group_1 >= num_full_groups_1)  num_iters_in_group_1 = num_iters_1 - (num_full_groups_1 * num_iters_in_full_group_1);
+
+  // Number of iterations in the set of groups across dimension 3.
+  idx_t num_iters_in_group_set_3 = num_iters_in_group_1 * num_iters_in_group_2 * num_iters_3;
+
+  // Index of this group in 2 dimension.
+  idx_t index_of_group_2 = index_offset_within_group_set_2_3 / num_iters_in_group_set_3;
+
+  // Linear offset within the set of groups across dimension 3.
+  idx_t index_offset_within_group_set_3 = index_offset_within_group_set_2_3 % num_iters_in_group_set_3;
+
+  // Adjust number of iterations in this group in 2 dimension.
+  if (index_of_group_2 >= num_full_groups_2)  num_iters_in_group_2 = num_iters_2 - (num_full_groups_2 * num_iters_in_full_group_2);
+
+  // Number of iterations in this group.
+  idx_t num_iters_in_full_group = num_iters_in_group_1 * num_iters_in_group_2 * num_iters_in_group_3;
+
+  // Index of this group in 3 dimension.
+  idx_t index_of_group_3 = index_offset_within_group_set_3 / num_iters_in_full_group;
+
+  // Linear offset within this group.
+  idx_t index_offset_within_this_group = index_offset_within_group_set_3 % num_iters_in_full_group;
+
+  // Adjust number of iterations in this group in 3 dimension.
+  if (index_of_group_3 >= num_full_groups_3)  num_iters_in_group_3 = num_iters_3 - (num_full_groups_3 * num_iters_in_full_group_3);
+
+  // Offset within this group in 1 dimension.
+  idx_t index_offset_within_this_group_1 = index_offset_within_this_group / (num_iters_in_group_2 * num_iters_in_group_3);
+
+  // Zero-based, unit-stride index for dimension 1.
+  idx_t index_1 = num_iters_in_full_group_1 * index_of_group_1 + index_offset_within_this_group_1;
+
+  // Offset within this group in 2 dimension.
+  idx_t index_offset_within_this_group_2 = (index_offset_within_this_group / (num_iters_in_group_3)) % num_iters_in_group_2;
+
+  // Zero-based, unit-stride index for dimension 2.
+  idx_t index_2 = num_iters_in_full_group_2 * index_of_group_2 + index_offset_within_this_group_2;
+
+  // Offset within this group in 3 dimension.
+  idx_t index_offset_within_this_group_3 = (index_offset_within_this_group) % num_iters_in_group_3;
+
+  // Zero-based, unit-stride index for dimension 3.
+  idx_t index_3 = num_iters_in_full_group_3 * index_of_group_3 + index_offset_within_this_group_3;
+
+  // This value of index_1 covers dimension 1 from start_1 to stop_1-1.
+  idx_t start_1 = block_idxs.begin[1] + (index_1 * block_idxs.step[1]);
+  idx_t stop_1 = std::min(start_1 + block_idxs.step[1], block_idxs.end[1]);
+
+  // This value of index_2 covers dimension 2 from start_2 to stop_2-1.
+  idx_t start_2 = block_idxs.begin[2] + (index_2 * block_idxs.step[2]);
+  idx_t stop_2 = std::min(start_2 + block_idxs.step[2], block_idxs.end[2]);
+
+  // This value of index_3 covers dimension 3 from start_3 to stop_3-1.
+  idx_t start_3 = block_idxs.begin[3] + (index_3 * block_idxs.step[3]);
+  idx_t stop_3 = std::min(start_3 + block_idxs.step[3], block_idxs.end[3]);
+  local_indices.start[1] = start_1;
+  local_indices.stop[1] = stop_1;
+  local_indices.index[1] = index_1;
+  local_indices.start[2] = start_2;
+  local_indices.stop[2] = stop_2;
+  local_indices.index[2] = index_2;
+  local_indices.start[3] = start_3;
+  local_indices.stop[3] = stop_3;
+  local_indices.index[3] = index_3;
+   calc_sub_block(local_indices);
+  }
+ }
+ break;
+ case 1:
+ {
+
+  // Indices for function calls.
+  ScanIndices local_indices(block_idxs);
+
+  // ** Begin scan over dimensions 1, 2, 3. **
+
+  // Number of iterations to get from block_idxs.begin[1] to (but not including) block_idxs.end[1], stepping by block_idxs.step[1]. This value is rounded up because the last iteration may cover fewer than block_idxs.step[1] steps.
+  const idx_t num_iters_1 = ((block_idxs.end[1] - block_idxs.begin[1]) + (block_idxs.step[1] - 1)) / block_idxs.step[1];
+
+  // Number of iterations to get from block_idxs.begin[2] to (but not including) block_idxs.end[2], stepping by block_idxs.step[2]. This value is rounded up because the last iteration may cover fewer than block_idxs.step[2] steps.
+  const idx_t num_iters_2 = ((block_idxs.end[2] - block_idxs.begin[2]) + (block_idxs.step[2] - 1)) / block_idxs.step[2];
+
+  // Number of iterations to get from block_idxs.begin[3] to (but not including) block_idxs.end[3], stepping by block_idxs.step[3]. This value is rounded up because the last iteration may cover fewer than block_idxs.step[3] steps.
+  const idx_t num_iters_3 = ((block_idxs.end[3] - block_idxs.begin[3]) + (block_idxs.step[3] - 1)) / block_idxs.step[3];
+
+  // Number of iterations in dimensions 1, 2, 3
+  const idx_t num_iters_1_2_3 = num_iters_1 * num_iters_2 * num_iters_3;
+
+  // Number of iterations in dimensions 2, 3
+  const idx_t num_iters_2_3 = num_iters_2 * num_iters_3;
+
+  // Inner loop.
+ 
+
+  // Distribute iterations among OpenMP threads.
+ #pragma OMP_PRAGMA_PREFIX firstprivate(local_indices) OMP_PRAGMA_SUFFIX
+  for (idx_t loop_index_1_2_3 = 0; loop_index_1_2_3 < num_iters_1_2_3; loop_index_1_2_3++) {
+
+  // Zero-based, unit-stride index for dimension 1.
+  idx_t index_1 = loop_index_1_2_3 / num_iters_2_3;
+
+  // Zero-based, unit-stride index for dimension 2.
+  idx_t index_2 = (loop_index_1_2_3 / num_iters_3) % num_iters_2;
+
+  // Zero-based, unit-stride index for dimension 3.
+  idx_t index_3 = (loop_index_1_2_3) % num_iters_3;
+
+  // This value of index_1 covers dimension 1 from start_1 to stop_1-1.
+  idx_t start_1 = block_idxs.begin[1] + (index_1 * block_idxs.step[1]);
+  idx_t stop_1 = std::min(start_1 + block_idxs.step[1], block_idxs.end[1]);
+
+  // This value of index_2 covers dimension 2 from start_2 to stop_2-1.
+  idx_t start_2 = block_idxs.begin[2] + (index_2 * block_idxs.step[2]);
+  idx_t stop_2 = std::min(start_2 + block_idxs.step[2], block_idxs.end[2]);
+
+  // This value of index_3 covers dimension 3 from start_3 to stop_3-1.
+  idx_t start_3 = block_idxs.begin[3] + (index_3 * block_idxs.step[3]);
+  idx_t stop_3 = std::min(start_3 + block_idxs.step[3], block_idxs.end[3]);
+  local_indices.start[1] = start_1;
+  local_indices.stop[1] = stop_1;
+  local_indices.index[1] = index_1;
+  local_indices.start[2] = start_2;
+  local_indices.stop[2] = stop_2;
+  local_indices.index[2] = index_2;
+  local_indices.start[3] = start_3;
+  local_indices.stop[3] = stop_3;
+  local_indices.index[3] = index_3;
+   calc_sub_block(local_indices);
+  }
+ }
+ break;
+ case 2:
+ {
+
+  // Indices for function calls.
+  ScanIndices local_indices(block_idxs);
+
+  // ** Begin scan over dimensions 1, 2, 3. **
+
+  // Number of iterations to get from block_idxs.begin[1] to (but not including) block_idxs.end[1], stepping by block_idxs.step[1]. This value is rounded up because the last iteration may cover fewer than block_idxs.step[1] steps.
+  const idx_t num_iters_1 = ((block_idxs.end[1] - block_idxs.begin[1]) + (block_idxs.step[1] - 1)) / block_idxs.step[1];
+
+  // Number of bits needed for index in 1 dimension.
+  int num_bits_1 = 0;
+  while ((idx_t(1) << num_bits_1) < num_iters_1) num_bits_1++;
+
+  // Number of iterations to get from block_idxs.begin[2] to (but not including) block_idxs.end[2], stepping by block_idxs.step[2]. This value is rounded up because the last iteration may cover fewer than block_idxs.step[2] steps.
+  const idx_t num_iters_2 = ((block_idxs.end[2] - block_idxs.begin[2]) + (block_idxs.step[2] - 1)) / block_idxs.step[2];
+
+  // Number of bits needed for index in 2 dimension.
+  int num_bits_2 = 0;
+  while ((idx_t(1) << num_bits_2) < num_iters_2) num_bits_2++;
+
+  // Number of iterations to get from block_idxs.begin[3] to (but not including) block_idxs.end[3], stepping by block_idxs.step[3]. This value is rounded up because the last iteration may cover fewer than block_idxs.step[3] steps.
+  const idx_t num_iters_3 = ((block_idxs.end[3] - block_idxs.begin[3]) + (block_idxs.step[3] - 1)) / block_idxs.step[3];
+
+  // Number of bits needed for index in 3 dimension.
+  int num_bits_3 = 0;
+  while ((idx_t(1) << num_bits_3) < num_iters_3) num_bits_3++;
+
+  // Number of iterations in dimensions 1, 2, 3
+  const idx_t num_iters_1_2_3 = num_iters_1 * num_iters_2 * num_iters_3;
+
+  // Number of iterations in dimensions 2, 3
+  const idx_t num_iters_2_3 = num_iters_2 * num_iters_3;
+
+  // Number of iterations in dimensions 1, 2, 3 after padding each to a power of 2 for 'morton' path.
+  const idx_t num_morton_iters_1_2_3 = idx_t(1) << (num_bits_1 + num_bits_2 + num_bits_3);
+
+  // Inner loop.
+ 
+
+  // Distribute iterations among OpenMP threads.
+ #pragma OMP_PRAGMA_PREFIX firstprivate(local_indices) OMP_PRAGMA_SUFFIX
+  for (idx_t loop_index_1_2_3 = 0; loop_index_1_2_3 < num_morton_iters_1_2_3; loop_index_1_2_3++) {
+
+  // Zero-based, unit-stride indices for dimensions 1, 2, 3.
+  idx_t index_1 = 0;
+  idx_t index_2 = 0;
+  idx_t index_3 = 0;
+
+  // Distribute bits of loop_index_1_2_3 among dimensions for 'morton' path.
+  {
+   idx_t morton_bits = loop_index_1_2_3;
+   for (int bit = 0; morton_bits; bit++) {
+    if (bit < num_bits_3) {
+     index_3 |= (morton_bits & 1) << bit;
+     morton_bits >>= 1;
+    }
+    if (bit < num_bits_2) {
+     index_2 |= (morton_bits & 1) << bit;
+     morton_bits >>= 1;
+    }
+    if (bit < num_bits_1) {
+     index_1 |= (morton_bits & 1) << bit;
+     morton_bits >>= 1;
+    }
+   }
+  }
+
+  // Skip indices in the padding.
+  if (index_1 >= num_iters_1 || index_2 >= num_iters_2 || index_3 >= num_iters_3)
+   continue;
+
+  // This value of index_1 covers dimension 1 from start_1 to stop_1-1.
+  idx_t start_1 = block_idxs.begin[1] + (index_1 * block_idxs.step[1]);
+  idx_t stop_1 = std::min(start_1 + block_idxs.step[1], block_idxs.end[1]);
+
+  // This value of index_2 covers dimension 2 from start_2 to stop_2-1.
+  idx_t start_2 = block_idxs.begin[2] + (index_2 * block_idxs.step[2]);
+  idx_t stop_2 = std::min(start_2 + block_idxs.step[2], block_idxs.end[2]);
+
+  // This value of index_3 covers dimension 3 from start_3 to stop_3-1.
+  idx_t start_3 = block_idxs.begin[3] + (index_3 * block_idxs.step[3]);
+  idx_t stop_3 = std::min(start_3 + block_idxs.step[3], block_idxs.end[3]);
+  local_indices.start[1] = start_1;
+  local_indices.stop[1] = stop_1;
+  local_indices.index[1] = index_1;
+  local_indices.start[2] = start_2;
+  local_indices.stop[2] = stop_2;
+  local_indices.index[2] = index_2;
+  local_indices.start[3] = start_3;
+  local_indices.stop[3] = stop_3;
+  local_indices.index[3] = index_3;
+   calc_sub_block(local_indices);
+  }
+ }
+ break;
+ }
+ #undef OMP_PRAGMA_PREFIX
+ #undef OMP_PRAGMA_SUFFIX
+
+ // End of generated code.
@@ -0,0 +1,328 @@
+// Automatically generated; do not edit.
+
+
+// 1-D <-> 1-D layout macros.
+// 'LAYOUT' macros return 1-D offset from 1-D 'j' indices.
+// 'UNLAYOUT' macros set 1 'j' indices based on 1-D 'ai' input.
+#define LAYOUT_1(j1, d1) ((j1))
+#define UNLAYOUT_1(ai, j1, d1) (j1 = (ai))
+
+// 2-D <-> 1-D layout macros.
+// 'LAYOUT' macros return 1-D offset from 2-D 'j' indices.
+// 'UNLAYOUT' macros set 2 'j' indices based on 1-D 'ai' input.
+#define LAYOUT_12(j1, j2, d1, d2) ((j1) * (d2) + (j2))
+#define UNLAYOUT_12(ai, j1, j2, d1, d2) (j1 = (ai)/((d2)), j2 = (ai) % (d2))
+#define LAYOUT_21(j1, j2, d1, d2) ((j2) * (d1) + (j1))
+#define UNLAYOUT_21(ai, j1, j2, d1, d2) (j2 = (ai)/((d1)), j1 = (ai) % (d1))
+
+// 3-D <-> 1-D layout macros.
+// 'LAYOUT' macros return 1-D offset from 3-D 'j' indices.
+// 'UNLAYOUT' macros set 3 'j' indices based on 1-D 'ai' input.
+#define LAYOUT_123(j1, j2, j3, d1, d2, d3) ((j1) * (d2) * (d3) + (j2) * (d3) + (j3))
+#define UNLAYOUT_123(ai, j1, j2, j3, d1, d2, d3) (j1 = (ai)/((d2) * (d3)), j2 = (ai)/((d3)) % (d2), j3 = (ai) % (d3))
+#define LAYOUT_132(j1, j2, j3, d1, d2, d3) ((j1) * (d3) * (d2) + (j3) * (d2) + (j2))
+#define UNLAYOUT_132(ai, j1, j2, j3, d1, d2, d3) (j1 = (ai)/((d3) * (d2)), j3 = (ai)/((d2)) % (d3), j2 = (ai) % (d2))
+#define LAYOUT_213(j1, j2, j3, d1, d2, d3) ((j2) * (d1) * (d3) + (j1) * (d3) + (j3))
+#define UNLAYOUT_213(ai, j1, j2, j3, d1, d2, d3) (j2 = (ai)/((d1) * (d3)), j1 = (ai)/((d3)) % (d1), j3 = (ai) % (d3))
+#define LAYOUT_231(j1, j2, j3, d1, d2, d3) ((j2) * (d3) * (d1) + (j3) * (d1) + (j1))
+#define UNLAYOUT_231(ai, j1, j2, j3, d1, d2, d3) (j2 = (ai)/((d3) * (d1)), j3 = (ai)/((d1)) % (d3), j1 = (ai) % (d1))
+#define LAYOUT_312(j1, j2, j3, d1, d2, d3) ((j3) * (d1) * (d2) + (j1) * (d2) + (j2))
+#define UNLAYOUT_312(ai, j1, j2, j3, d1, d2, d3) (j3 = (ai)/((d1) * (d2)), j1 = (ai)/((d2)) % (d1), j2 = (ai) % (d2))
+#define LAYOUT_321(j1, j2, j3, d1, d2, d3) ((j3) * (d2) * (d1) + (j2) * (d1) + (j1))
+#define UNLAYOUT_321(ai, j1, j2, j3, d1, d2, d3) (j3 = (ai)/((d2) * (d1)), j2 = (ai)/((d1)) % (d2), j1 = (ai) % (d1))
+
+// 4-D <-> 1-D layout macros.
+// 'LAYOUT' macros return 1-D offset from 4-D 'j' indices.
+// 'UNLAYOUT' macros set 4 'j' indices based on 1-D 'ai' input.
+#define LAYOUT_1234(j1, j2, j3, j4, d1, d2, d3, d4) ((j1) * (d2) * (d3) * (d4) + (j2) * (d3) * (d4) + (j3) * (d4) + (j4))
+#define UNLAYOUT_1234(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j1 = (ai)/((d2) * (d3) * (d4)), j2 = (ai)/((d3) * (d4)) % (d2), j3 = (ai)/((d4)) % (d3), j4 = (ai) % (d4))
+#define LAYOUT_1243(j1, j2, j3, j4, d1, d2, d3, d4) ((j1) * (d2) * (d4) * (d3) + (j2) * (d4) * (d3) + (j4) * (d3) + (j3))
+#define UNLAYOUT_1243(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j1 = (ai)/((d2) * (d4) * (d3)), j2 = (ai)/((d4) * (d3)) % (d2), j4 = (ai)/((d3)) % (d4), j3 = (ai) % (d3))
+#define LAYOUT_1324(j1, j2, j3, j4, d1, d2, d3, d4) ((j1) * (d3) * (d2) * (d4) + (j3) * (d2) * (d4) + (j2) * (d4) + (j4))
+#define UNLAYOUT_1324(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j1 = (ai)/((d3) * (d2) * (d4)), j3 = (ai)/((d2) * (d4)) % (d3), j2 = (ai)/((d4)) % (d2), j4 = (ai) % (d4))
+#define LAYOUT_1342(j1, j2, j3, j4, d1, d2, d3, d4) ((j1) * (d3) * (d4) * (d2) + (j3) * (d4) * (d2) + (j4) * (d2) + (j2))
+#define UNLAYOUT_1342(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j1 = (ai)/((d3) * (d4) * (d2)), j3 = (ai)/((d4) * (d2)) % (d3), j4 = (ai)/((d2)) % (d4), j2 = (ai) % (d2))
+#define LAYOUT_1423(j1, j2, j3, j4, d1, d2, d3, d4) ((j1) * (d4) * (d2) * (d3) + (j4) * (d2) * (d3) + (j2) * (d3) + (j3))
+#define UNLAYOUT_1423(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j1 = (ai)/((d4) * (d2) * (d3)), j4 = (ai)/((d2) * (d3)) % (d4), j2 = (ai)/((d3)) % (d2), j3 = (ai) % (d3))
+#define LAYOUT_1432(j1, j2, j3, j4, d1, d2, d3, d4) ((j1) * (d4) * (d3) * (d2) + (j4) * (d3) * (d2) + (j3) * (d2) + (j2))
+#define UNLAYOUT_1432(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j1 = (ai)/((d4) * (d3) * (d2)), j4 = (ai)/((d3) * (d2)) % (d4), j3 = (ai)/((d2)) % (d3), j2 = (ai) % (d2))
+#define LAYOUT_2134(j1, j2, j3, j4, d1, d2, d3, d4) ((j2) * (d1) * (d3) * (d4) + (j1) * (d3) * (d4) + (j3) * (d4) + (j4))
+#define UNLAYOUT_2134(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j2 = (ai)/((d1) * (d3) * (d4)), j1 = (ai)/((d3) * (d4)) % (d1), j3 = (ai)/((d4)) % (d3), j4 = (ai) % (d4))
+#define LAYOUT_2143(j1, j2, j3, j4, d1, d2, d3, d4) ((j2) * (d1) * (d4) * (d3) + (j1) * (d4) * (d3) + (j4) * (d3) + (j3))
+#define UNLAYOUT_2143(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j2 = (ai)/((d1) * (d4) * (d3)), j1 = (ai)/((d4) * (d3)) % (d1), j4 = (ai)/((d3)) % (d4), j3 = (ai) % (d3))
+#define LAYOUT_2314(j1, j2, j3, j4, d1, d2, d3, d4) ((j2) * (d3) * (d1) * (d4) + (j3) * (d1) * (d4) + (j1) * (d4) + (j4))
+#define UNLAYOUT_2314(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j2 = (ai)/((d3) * (d1) * (d4)), j3 = (ai)/((d1) * (d4)) % (d3), j1 = (ai)/((d4)) % (d1), j4 = (ai) % (d4))
+#define LAYOUT_2341(j1, j2, j3, j4, d1, d2, d3, d4) ((j2) * (d3) * (d4) * (d1) + (j3) * (d4) * (d1) + (j4) * (d1) + (j1))
+#define UNLAYOUT_2341(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j2 = (ai)/((d3) * (d4) * (d1)), j3 = (ai)/((d4) * (d1)) % (d3), j4 = (ai)/((d1)) % (d4), j1 = (ai) % (d1))
+#define LAYOUT_2413(j1, j2, j3, j4, d1, d2, d3, d4) ((j2) * (d4) * (d1) * (d3) + (j4) * (d1) * (d3) + (j1) * (d3) + (j3))
+#define UNLAYOUT_2413(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j2 = (ai)/((d4) * (d1) * (d3)), j4 = (ai)/((d1) * (d3)) % (d4), j1 = (ai)/((d3)) % (d1), j3 = (ai) % (d3))
+#define LAYOUT_2431(j1, j2, j3, j4, d1, d2, d3, d4) ((j2) * (d4) * (d3) * (d1) + (j4) * (d3) * (d1) + (j3) * (d1) + (j1))
+#define UNLAYOUT_2431(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j2 = (ai)/((d4) * (d3) * (d1)), j4 = (ai)/((d3) * (d1)) % (d4), j3 = (ai)/((d1)) % (d3), j1 = (ai) % (d1))
+#define LAYOUT_3124(j1, j2, j3, j4, d1, d2, d3, d4) ((j3) * (d1) * (d2) * (d4) + (j1) * (d2) * (d4) + (j2) * (d4) + (j4))
+#define UNLAYOUT_3124(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j3 = (ai)/((d1) * (d2) * (d4)), j1 = (ai)/((d2) * (d4)) % (d1), j2 = (ai)/((d4)) % (d2), j4 = (ai) % (d4))
+#define LAYOUT_3142(j1, j2, j3, j4, d1, d2, d3, d4) ((j3) * (d1) * (d4) * (d2) + (j1) * (d4) * (d2) + (j4) * (d2) + (j2))
+#define UNLAYOUT_3142(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j3 = (ai)/((d1) * (d4) * (d2)), j1 = (ai)/((d4) * (d2)) % (d1), j4 = (ai)/((d2)) % (d4), j2 = (ai) % (d2))
+#define LAYOUT_3214(j1, j2, j3, j4, d1, d2, d3, d4) ((j3) * (d2) * (d1) * (d4) + (j2) * (d1) * (d4) + (j1) * (d4) + (j4))
+#define UNLAYOUT_3214(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j3 = (ai)/((d2) * (d1) * (d4)), j2 = (ai)/((d1) * (d4)) % (d2), j1 = (ai)/((d4)) % (d1), j4 = (ai) % (d4))
+#define LAYOUT_3241(j1, j2, j3, j4, d1, d2, d3, d4) ((j3) * (d2) * (d4) * (d1) + (j2) * (d4) * (d1) + (j4) * (d1) + (j1))
+#define UNLAYOUT_3241(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j3 = (ai)/((d2) * (d4) * (d1)), j2 = (ai)/((d4) * (d1)) % (d2), j4 = (ai)/((d1)) % (d4), j1 = (ai) % (d1))
+#define LAYOUT_3412(j1, j2, j3, j4, d1, d2, d3, d4) ((j3) * (d4) * (d1) * (d2) + (j4) * (d1) * (d2) + (j1) * (d2) + (j2))
+#define UNLAYOUT_3412(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j3 = (ai)/((d4) * (d1) * (d2)), j4 = (ai)/((d1) * (d2)) % (d4), j1 = (ai)/((d2)) % (d1), j2 = (ai) % (d2))
+#define LAYOUT_3421(j1, j2, j3, j4, d1, d2, d3, d4) ((j3) * (d4) * (d2) * (d1) + (j4) * (d2) * (d1) + (j2) * (d1) + (j1))
+#define UNLAYOUT_3421(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j3 = (ai)/((d4) * (d2) * (d1)), j4 = (ai)/((d2) * (d1)) % (d4), j2 = (ai)/((d1)) % (d2), j1 = (ai) % (d1))
+#define LAYOUT_4123(j1, j2, j3, j4, d1, d2, d3, d4) ((j4) * (d1) * (d2) * (d3) + (j1) * (d2) * (d3) + (j2) * (d3) + (j3))
+#define UNLAYOUT_4123(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j4 = (ai)/((d1) * (d2) * (d3)), j1 = (ai)/((d2) * (d3)) % (d1), j2 = (ai)/((d3)) % (d2), j3 = (ai) % (d3))
+#define LAYOUT_4132(j1, j2, j3, j4, d1, d2, d3, d4) ((j4) * (d1) * (d3) * (d2) + (j1) * (d3) * (d2) + (j3) * (d2) + (j2))
+#define UNLAYOUT_4132(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j4 = (ai)/((d1) * (d3) * (d2)), j1 = (ai)/((d3) * (d2)) % (d1), j3 = (ai)/((d2)) % (d3), j2 = (ai) % (d2))
+#define LAYOUT_4213(j1, j2, j3, j4, d1, d2, d3, d4) ((j4) * (d2) * (d1) * (d3) + (j2) * (d1) * (d3) + (j1) * (d3) + (j3))
+#define UNLAYOUT_4213(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j4 = (ai)/((d2) * (d1) * (d3)), j2 = (ai)/((d1) * (d3)) % (d2), j1 = (ai)/((d3)) % (d1), j3 = (ai) % (d3))
+#define LAYOUT_4231(j1, j2, j3, j4, d1, d2, d3, d4) ((j4) * (d2) * (d3) * (d1) + (j2) * (d3) * (d1) + (j3) * (d1) + (j1))
+#define UNLAYOUT_4231(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j4 = (ai)/((d2) * (d3) * (d1)), j2 = (ai)/((d3) * (d1)) % (d2), j3 = (ai)/((d1)) % (d3), j1 = (ai) % (d1))
+#define LAYOUT_4312(j1, j2, j3, j4, d1, d2, d3, d4) ((j4) * (d3) * (d1) * (d2) + (j3) * (d1) * (d2) + (j1) * (d2) + (j2))
+#define UNLAYOUT_4312(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j4 = (ai)/((d3) * (d1) * (d2)), j3 = (ai)/((d1) * (d2)) % (d3), j1 = (ai)/((d2)) % (d1), j2 = (ai) % (d2))
+#define LAYOUT_4321(j1, j2, j3, j4, d1, d2, d3, d4) ((j4) * (d3) * (d2) * (d1) + (j3) * (d2) * (d1) + (j2) * (d1) + (j1))
+#define UNLAYOUT_4321(ai, j1, j2, j3, j4, d1, d2, d3, d4) (j4 = (ai)/((d3) * (d2) * (d1)), j3 = (ai)/((d2) * (d1)) % (d3), j2 = (ai)/((d1)) % (d2), j1 = (ai) % (d1))
+
+// 5-D <-> 1-D layout macros.
+// 'LAYOUT' macros return 1-D offset from 5-D 'j' indices.
+// 'UNLAYOUT' macros set 5 'j' indices based on 1-D 'ai' input.
+#define LAYOUT_12345(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d2) * (d3) * (d4) * (d5) + (j2) * (d3) * (d4) * (d5) + (j3) * (d4) * (d5) + (j4) * (d5) + (j5))
+#define UNLAYOUT_12345(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d2) * (d3) * (d4) * (d5)), j2 = (ai)/((d3) * (d4) * (d5)) % (d2), j3 = (ai)/((d4) * (d5)) % (d3), j4 = (ai)/((d5)) % (d4), j5 = (ai) % (d5))
+#define LAYOUT_12354(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d2) * (d3) * (d5) * (d4) + (j2) * (d3) * (d5) * (d4) + (j3) * (d5) * (d4) + (j5) * (d4) + (j4))
+#define UNLAYOUT_12354(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d2) * (d3) * (d5) * (d4)), j2 = (ai)/((d3) * (d5) * (d4)) % (d2), j3 = (ai)/((d5) * (d4)) % (d3), j5 = (ai)/((d4)) % (d5), j4 = (ai) % (d4))
+#define LAYOUT_12435(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d2) * (d4) * (d3) * (d5) + (j2) * (d4) * (d3) * (d5) + (j4) * (d3) * (d5) + (j3) * (d5) + (j5))
+#define UNLAYOUT_12435(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d2) * (d4) * (d3) * (d5)), j2 = (ai)/((d4) * (d3) * (d5)) % (d2), j4 = (ai)/((d3) * (d5)) % (d4), j3 = (ai)/((d5)) % (d3), j5 = (ai) % (d5))
+#define LAYOUT_12453(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d2) * (d4) * (d5) * (d3) + (j2) * (d4) * (d5) * (d3) + (j4) * (d5) * (d3) + (j5) * (d3) + (j3))
+#define UNLAYOUT_12453(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d2) * (d4) * (d5) * (d3)), j2 = (ai)/((d4) * (d5) * (d3)) % (d2), j4 = (ai)/((d5) * (d3)) % (d4), j5 = (ai)/((d3)) % (d5), j3 = (ai) % (d3))
+#define LAYOUT_12534(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d2) * (d5) * (d3) * (d4) + (j2) * (d5) * (d3) * (d4) + (j5) * (d3) * (d4) + (j3) * (d4) + (j4))
+#define UNLAYOUT_12534(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d2) * (d5) * (d3) * (d4)), j2 = (ai)/((d5) * (d3) * (d4)) % (d2), j5 = (ai)/((d3) * (d4)) % (d5), j3 = (ai)/((d4)) % (d3), j4 = (ai) % (d4))
+#define LAYOUT_12543(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d2) * (d5) * (d4) * (d3) + (j2) * (d5) * (d4) * (d3) + (j5) * (d4) * (d3) + (j4) * (d3) + (j3))
+#define UNLAYOUT_12543(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d2) * (d5) * (d4) * (d3)), j2 = (ai)/((d5) * (d4) * (d3)) % (d2), j5 = (ai)/((d4) * (d3)) % (d5), j4 = (ai)/((d3)) % (d4), j3 = (ai) % (d3))
+#define LAYOUT_13245(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d3) * (d2) * (d4) * (d5) + (j3) * (d2) * (d4) * (d5) + (j2) * (d4) * (d5) + (j4) * (d5) + (j5))
+#define UNLAYOUT_13245(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d3) * (d2) * (d4) * (d5)), j3 = (ai)/((d2) * (d4) * (d5)) % (d3), j2 = (ai)/((d4) * (d5)) % (d2), j4 = (ai)/((d5)) % (d4), j5 = (ai) % (d5))
+#define LAYOUT_13254(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d3) * (d2) * (d5) * (d4) + (j3) * (d2) * (d5) * (d4) + (j2) * (d5) * (d4) + (j5) * (d4) + (j4))
+#define UNLAYOUT_13254(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d3) * (d2) * (d5) * (d4)), j3 = (ai)/((d2) * (d5) * (d4)) % (d3), j2 = (ai)/((d5) * (d4)) % (d2), j5 = (ai)/((d4)) % (d5), j4 = (ai) % (d4))
+#define LAYOUT_13425(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d3) * (d4) * (d2) * (d5) + (j3) * (d4) * (d2) * (d5) + (j4) * (d2) * (d5) + (j2) * (d5) + (j5))
+#define UNLAYOUT_13425(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d3) * (d4) * (d2) * (d5)), j3 = (ai)/((d4) * (d2) * (d5)) % (d3), j4 = (ai)/((d2) * (d5)) % (d4), j2 = (ai)/((d5)) % (d2), j5 = (ai) % (d5))
+#define LAYOUT_13452(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d3) * (d4) * (d5) * (d2) + (j3) * (d4) * (d5) * (d2) + (j4) * (d5) * (d2) + (j5) * (d2) + (j2))
+#define UNLAYOUT_13452(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d3) * (d4) * (d5) * (d2)), j3 = (ai)/((d4) * (d5) * (d2)) % (d3), j4 = (ai)/((d5) * (d2)) % (d4), j5 = (ai)/((d2)) % (d5), j2 = (ai) % (d2))
+#define LAYOUT_13524(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d3) * (d5) * (d2) * (d4) + (j3) * (d5) * (d2) * (d4) + (j5) * (d2) * (d4) + (j2) * (d4) + (j4))
+#define UNLAYOUT_13524(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d3) * (d5) * (d2) * (d4)), j3 = (ai)/((d5) * (d2) * (d4)) % (d3), j5 = (ai)/((d2) * (d4)) % (d5), j2 = (ai)/((d4)) % (d2), j4 = (ai) % (d4))
+#define LAYOUT_13542(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d3) * (d5) * (d4) * (d2) + (j3) * (d5) * (d4) * (d2) + (j5) * (d4) * (d2) + (j4) * (d2) + (j2))
+#define UNLAYOUT_13542(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d3) * (d5) * (d4) * (d2)), j3 = (ai)/((d5) * (d4) * (d2)) % (d3), j5 = (ai)/((d4) * (d2)) % (d5), j4 = (ai)/((d2)) % (d4), j2 = (ai) % (d2))
+#define LAYOUT_14235(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d4) * (d2) * (d3) * (d5) + (j4) * (d2) * (d3) * (d5) + (j2) * (d3) * (d5) + (j3) * (d5) + (j5))
+#define UNLAYOUT_14235(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d4) * (d2) * (d3) * (d5)), j4 = (ai)/((d2) * (d3) * (d5)) % (d4), j2 = (ai)/((d3) * (d5)) % (d2), j3 = (ai)/((d5)) % (d3), j5 = (ai) % (d5))
+#define LAYOUT_14253(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d4) * (d2) * (d5) * (d3) + (j4) * (d2) * (d5) * (d3) + (j2) * (d5) * (d3) + (j5) * (d3) + (j3))
+#define UNLAYOUT_14253(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d4) * (d2) * (d5) * (d3)), j4 = (ai)/((d2) * (d5) * (d3)) % (d4), j2 = (ai)/((d5) * (d3)) % (d2), j5 = (ai)/((d3)) % (d5), j3 = (ai) % (d3))
+#define LAYOUT_14325(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d4) * (d3) * (d2) * (d5) + (j4) * (d3) * (d2) * (d5) + (j3) * (d2) * (d5) + (j2) * (d5) + (j5))
+#define UNLAYOUT_14325(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d4) * (d3) * (d2) * (d5)), j4 = (ai)/((d3) * (d2) * (d5)) % (d4), j3 = (ai)/((d2) * (d5)) % (d3), j2 = (ai)/((d5)) % (d2), j5 = (ai) % (d5))
+#define LAYOUT_14352(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d4) * (d3) * (d5) * (d2) + (j4) * (d3) * (d5) * (d2) + (j3) * (d5) * (d2) + (j5) * (d2) + (j2))
+#define UNLAYOUT_14352(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d4) * (d3) * (d5) * (d2)), j4 = (ai)/((d3) * (d5) * (d2)) % (d4), j3 = (ai)/((d5) * (d2)) % (d3), j5 = (ai)/((d2)) % (d5), j2 = (ai) % (d2))
+#define LAYOUT_14523(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d4) * (d5) * (d2) * (d3) + (j4) * (d5) * (d2) * (d3) + (j5) * (d2) * (d3) + (j2) * (d3) + (j3))
+#define UNLAYOUT_14523(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d4) * (d5) * (d2) * (d3)), j4 = (ai)/((d5) * (d2) * (d3)) % (d4), j5 = (ai)/((d2) * (d3)) % (d5), j2 = (ai)/((d3)) % (d2), j3 = (ai) % (d3))
+#define LAYOUT_14532(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d4) * (d5) * (d3) * (d2) + (j4) * (d5) * (d3) * (d2) + (j5) * (d3) * (d2) + (j3) * (d2) + (j2))
+#define UNLAYOUT_14532(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d4) * (d5) * (d3) * (d2)), j4 = (ai)/((d5) * (d3) * (d2)) % (d4), j5 = (ai)/((d3) * (d2)) % (d5), j3 = (ai)/((d2)) % (d3), j2 = (ai) % (d2))
+#define LAYOUT_15234(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d5) * (d2) * (d3) * (d4) + (j5) * (d2) * (d3) * (d4) + (j2) * (d3) * (d4) + (j3) * (d4) + (j4))
+#define UNLAYOUT_15234(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d5) * (d2) * (d3) * (d4)), j5 = (ai)/((d2) * (d3) * (d4)) % (d5), j2 = (ai)/((d3) * (d4)) % (d2), j3 = (ai)/((d4)) % (d3), j4 = (ai) % (d4))
+#define LAYOUT_15243(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d5) * (d2) * (d4) * (d3) + (j5) * (d2) * (d4) * (d3) + (j2) * (d4) * (d3) + (j4) * (d3) + (j3))
+#define UNLAYOUT_15243(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d5) * (d2) * (d4) * (d3)), j5 = (ai)/((d2) * (d4) * (d3)) % (d5), j2 = (ai)/((d4) * (d3)) % (d2), j4 = (ai)/((d3)) % (d4), j3 = (ai) % (d3))
+#define LAYOUT_15324(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d5) * (d3) * (d2) * (d4) + (j5) * (d3) * (d2) * (d4) + (j3) * (d2) * (d4) + (j2) * (d4) + (j4))
+#define UNLAYOUT_15324(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d5) * (d3) * (d2) * (d4)), j5 = (ai)/((d3) * (d2) * (d4)) % (d5), j3 = (ai)/((d2) * (d4)) % (d3), j2 = (ai)/((d4)) % (d2), j4 = (ai) % (d4))
+#define LAYOUT_15342(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d5) * (d3) * (d4) * (d2) + (j5) * (d3) * (d4) * (d2) + (j3) * (d4) * (d2) + (j4) * (d2) + (j2))
+#define UNLAYOUT_15342(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d5) * (d3) * (d4) * (d2)), j5 = (ai)/((d3) * (d4) * (d2)) % (d5), j3 = (ai)/((d4) * (d2)) % (d3), j4 = (ai)/((d2)) % (d4), j2 = (ai) % (d2))
+#define LAYOUT_15423(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d5) * (d4) * (d2) * (d3) + (j5) * (d4) * (d2) * (d3) + (j4) * (d2) * (d3) + (j2) * (d3) + (j3))
+#define UNLAYOUT_15423(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d5) * (d4) * (d2) * (d3)), j5 = (ai)/((d4) * (d2) * (d3)) % (d5), j4 = (ai)/((d2) * (d3)) % (d4), j2 = (ai)/((d3)) % (d2), j3 = (ai) % (d3))
+#define LAYOUT_15432(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j1) * (d5) * (d4) * (d3) * (d2) + (j5) * (d4) * (d3) * (d2) + (j4) * (d3) * (d2) + (j3) * (d2) + (j2))
+#define UNLAYOUT_15432(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j1 = (ai)/((d5) * (d4) * (d3) * (d2)), j5 = (ai)/((d4) * (d3) * (d2)) % (d5), j4 = (ai)/((d3) * (d2)) % (d4), j3 = (ai)/((d2)) % (d3), j2 = (ai) % (d2))
+#define LAYOUT_21345(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d1) * (d3) * (d4) * (d5) + (j1) * (d3) * (d4) * (d5) + (j3) * (d4) * (d5) + (j4) * (d5) + (j5))
+#define UNLAYOUT_21345(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d1) * (d3) * (d4) * (d5)), j1 = (ai)/((d3) * (d4) * (d5)) % (d1), j3 = (ai)/((d4) * (d5)) % (d3), j4 = (ai)/((d5)) % (d4), j5 = (ai) % (d5))
+#define LAYOUT_21354(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d1) * (d3) * (d5) * (d4) + (j1) * (d3) * (d5) * (d4) + (j3) * (d5) * (d4) + (j5) * (d4) + (j4))
+#define UNLAYOUT_21354(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d1) * (d3) * (d5) * (d4)), j1 = (ai)/((d3) * (d5) * (d4)) % (d1), j3 = (ai)/((d5) * (d4)) % (d3), j5 = (ai)/((d4)) % (d5), j4 = (ai) % (d4))
+#define LAYOUT_21435(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d1) * (d4) * (d3) * (d5) + (j1) * (d4) * (d3) * (d5) + (j4) * (d3) * (d5) + (j3) * (d5) + (j5))
+#define UNLAYOUT_21435(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d1) * (d4) * (d3) * (d5)), j1 = (ai)/((d4) * (d3) * (d5)) % (d1), j4 = (ai)/((d3) * (d5)) % (d4), j3 = (ai)/((d5)) % (d3), j5 = (ai) % (d5))
+#define LAYOUT_21453(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d1) * (d4) * (d5) * (d3) + (j1) * (d4) * (d5) * (d3) + (j4) * (d5) * (d3) + (j5) * (d3) + (j3))
+#define UNLAYOUT_21453(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d1) * (d4) * (d5) * (d3)), j1 = (ai)/((d4) * (d5) * (d3)) % (d1), j4 = (ai)/((d5) * (d3)) % (d4), j5 = (ai)/((d3)) % (d5), j3 = (ai) % (d3))
+#define LAYOUT_21534(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d1) * (d5) * (d3) * (d4) + (j1) * (d5) * (d3) * (d4) + (j5) * (d3) * (d4) + (j3) * (d4) + (j4))
+#define UNLAYOUT_21534(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d1) * (d5) * (d3) * (d4)), j1 = (ai)/((d5) * (d3) * (d4)) % (d1), j5 = (ai)/((d3) * (d4)) % (d5), j3 = (ai)/((d4)) % (d3), j4 = (ai) % (d4))
+#define LAYOUT_21543(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d1) * (d5) * (d4) * (d3) + (j1) * (d5) * (d4) * (d3) + (j5) * (d4) * (d3) + (j4) * (d3) + (j3))
+#define UNLAYOUT_21543(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d1) * (d5) * (d4) * (d3)), j1 = (ai)/((d5) * (d4) * (d3)) % (d1), j5 = (ai)/((d4) * (d3)) % (d5), j4 = (ai)/((d3)) % (d4), j3 = (ai) % (d3))
+#define LAYOUT_23145(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d3) * (d1) * (d4) * (d5) + (j3) * (d1) * (d4) * (d5) + (j1) * (d4) * (d5) + (j4) * (d5) + (j5))
+#define UNLAYOUT_23145(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d3) * (d1) * (d4) * (d5)), j3 = (ai)/((d1) * (d4) * (d5)) % (d3), j1 = (ai)/((d4) * (d5)) % (d1), j4 = (ai)/((d5)) % (d4), j5 = (ai) % (d5))
+#define LAYOUT_23154(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d3) * (d1) * (d5) * (d4) + (j3) * (d1) * (d5) * (d4) + (j1) * (d5) * (d4) + (j5) * (d4) + (j4))
+#define UNLAYOUT_23154(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d3) * (d1) * (d5) * (d4)), j3 = (ai)/((d1) * (d5) * (d4)) % (d3), j1 = (ai)/((d5) * (d4)) % (d1), j5 = (ai)/((d4)) % (d5), j4 = (ai) % (d4))
+#define LAYOUT_23415(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d3) * (d4) * (d1) * (d5) + (j3) * (d4) * (d1) * (d5) + (j4) * (d1) * (d5) + (j1) * (d5) + (j5))
+#define UNLAYOUT_23415(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d3) * (d4) * (d1) * (d5)), j3 = (ai)/((d4) * (d1) * (d5)) % (d3), j4 = (ai)/((d1) * (d5)) % (d4), j1 = (ai)/((d5)) % (d1), j5 = (ai) % (d5))
+#define LAYOUT_23451(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d3) * (d4) * (d5) * (d1) + (j3) * (d4) * (d5) * (d1) + (j4) * (d5) * (d1) + (j5) * (d1) + (j1))
+#define UNLAYOUT_23451(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d3) * (d4) * (d5) * (d1)), j3 = (ai)/((d4) * (d5) * (d1)) % (d3), j4 = (ai)/((d5) * (d1)) % (d4), j5 = (ai)/((d1)) % (d5), j1 = (ai) % (d1))
+#define LAYOUT_23514(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d3) * (d5) * (d1) * (d4) + (j3) * (d5) * (d1) * (d4) + (j5) * (d1) * (d4) + (j1) * (d4) + (j4))
+#define UNLAYOUT_23514(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d3) * (d5) * (d1) * (d4)), j3 = (ai)/((d5) * (d1) * (d4)) % (d3), j5 = (ai)/((d1) * (d4)) % (d5), j1 = (ai)/((d4)) % (d1), j4 = (ai) % (d4))
+#define LAYOUT_23541(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d3) * (d5) * (d4) * (d1) + (j3) * (d5) * (d4) * (d1) + (j5) * (d4) * (d1) + (j4) * (d1) + (j1))
+#define UNLAYOUT_23541(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d3) * (d5) * (d4) * (d1)), j3 = (ai)/((d5) * (d4) * (d1)) % (d3), j5 = (ai)/((d4) * (d1)) % (d5), j4 = (ai)/((d1)) % (d4), j1 = (ai) % (d1))
+#define LAYOUT_24135(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d4) * (d1) * (d3) * (d5) + (j4) * (d1) * (d3) * (d5) + (j1) * (d3) * (d5) + (j3) * (d5) + (j5))
+#define UNLAYOUT_24135(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d4) * (d1) * (d3) * (d5)), j4 = (ai)/((d1) * (d3) * (d5)) % (d4), j1 = (ai)/((d3) * (d5)) % (d1), j3 = (ai)/((d5)) % (d3), j5 = (ai) % (d5))
+#define LAYOUT_24153(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d4) * (d1) * (d5) * (d3) + (j4) * (d1) * (d5) * (d3) + (j1) * (d5) * (d3) + (j5) * (d3) + (j3))
+#define UNLAYOUT_24153(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d4) * (d1) * (d5) * (d3)), j4 = (ai)/((d1) * (d5) * (d3)) % (d4), j1 = (ai)/((d5) * (d3)) % (d1), j5 = (ai)/((d3)) % (d5), j3 = (ai) % (d3))
+#define LAYOUT_24315(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d4) * (d3) * (d1) * (d5) + (j4) * (d3) * (d1) * (d5) + (j3) * (d1) * (d5) + (j1) * (d5) + (j5))
+#define UNLAYOUT_24315(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d4) * (d3) * (d1) * (d5)), j4 = (ai)/((d3) * (d1) * (d5)) % (d4), j3 = (ai)/((d1) * (d5)) % (d3), j1 = (ai)/((d5)) % (d1), j5 = (ai) % (d5))
+#define LAYOUT_24351(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d4) * (d3) * (d5) * (d1) + (j4) * (d3) * (d5) * (d1) + (j3) * (d5) * (d1) + (j5) * (d1) + (j1))
+#define UNLAYOUT_24351(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d4) * (d3) * (d5) * (d1)), j4 = (ai)/((d3) * (d5) * (d1)) % (d4), j3 = (ai)/((d5) * (d1)) % (d3), j5 = (ai)/((d1)) % (d5), j1 = (ai) % (d1))
+#define LAYOUT_24513(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d4) * (d5) * (d1) * (d3) + (j4) * (d5) * (d1) * (d3) + (j5) * (d1) * (d3) + (j1) * (d3) + (j3))
+#define UNLAYOUT_24513(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d4) * (d5) * (d1) * (d3)), j4 = (ai)/((d5) * (d1) * (d3)) % (d4), j5 = (ai)/((d1) * (d3)) % (d5), j1 = (ai)/((d3)) % (d1), j3 = (ai) % (d3))
+#define LAYOUT_24531(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d4) * (d5) * (d3) * (d1) + (j4) * (d5) * (d3) * (d1) + (j5) * (d3) * (d1) + (j3) * (d1) + (j1))
+#define UNLAYOUT_24531(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d4) * (d5) * (d3) * (d1)), j4 = (ai)/((d5) * (d3) * (d1)) % (d4), j5 = (ai)/((d3) * (d1)) % (d5), j3 = (ai)/((d1)) % (d3), j1 = (ai) % (d1))
+#define LAYOUT_25134(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d5) * (d1) * (d3) * (d4) + (j5) * (d1) * (d3) * (d4) + (j1) * (d3) * (d4) + (j3) * (d4) + (j4))
+#define UNLAYOUT_25134(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d5) * (d1) * (d3) * (d4)), j5 = (ai)/((d1) * (d3) * (d4)) % (d5), j1 = (ai)/((d3) * (d4)) % (d1), j3 = (ai)/((d4)) % (d3), j4 = (ai) % (d4))
+#define LAYOUT_25143(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d5) * (d1) * (d4) * (d3) + (j5) * (d1) * (d4) * (d3) + (j1) * (d4) * (d3) + (j4) * (d3) + (j3))
+#define UNLAYOUT_25143(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d5) * (d1) * (d4) * (d3)), j5 = (ai)/((d1) * (d4) * (d3)) % (d5), j1 = (ai)/((d4) * (d3)) % (d1), j4 = (ai)/((d3)) % (d4), j3 = (ai) % (d3))
+#define LAYOUT_25314(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d5) * (d3) * (d1) * (d4) + (j5) * (d3) * (d1) * (d4) + (j3) * (d1) * (d4) + (j1) * (d4) + (j4))
+#define UNLAYOUT_25314(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d5) * (d3) * (d1) * (d4)), j5 = (ai)/((d3) * (d1) * (d4)) % (d5), j3 = (ai)/((d1) * (d4)) % (d3), j1 = (ai)/((d4)) % (d1), j4 = (ai) % (d4))
+#define LAYOUT_25341(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d5) * (d3) * (d4) * (d1) + (j5) * (d3) * (d4) * (d1) + (j3) * (d4) * (d1) + (j4) * (d1) + (j1))
+#define UNLAYOUT_25341(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d5) * (d3) * (d4) * (d1)), j5 = (ai)/((d3) * (d4) * (d1)) % (d5), j3 = (ai)/((d4) * (d1)) % (d3), j4 = (ai)/((d1)) % (d4), j1 = (ai) % (d1))
+#define LAYOUT_25413(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d5) * (d4) * (d1) * (d3) + (j5) * (d4) * (d1) * (d3) + (j4) * (d1) * (d3) + (j1) * (d3) + (j3))
+#define UNLAYOUT_25413(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d5) * (d4) * (d1) * (d3)), j5 = (ai)/((d4) * (d1) * (d3)) % (d5), j4 = (ai)/((d1) * (d3)) % (d4), j1 = (ai)/((d3)) % (d1), j3 = (ai) % (d3))
+#define LAYOUT_25431(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j2) * (d5) * (d4) * (d3) * (d1) + (j5) * (d4) * (d3) * (d1) + (j4) * (d3) * (d1) + (j3) * (d1) + (j1))
+#define UNLAYOUT_25431(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j2 = (ai)/((d5) * (d4) * (d3) * (d1)), j5 = (ai)/((d4) * (d3) * (d1)) % (d5), j4 = (ai)/((d3) * (d1)) % (d4), j3 = (ai)/((d1)) % (d3), j1 = (ai) % (d1))
+#define LAYOUT_31245(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d1) * (d2) * (d4) * (d5) + (j1) * (d2) * (d4) * (d5) + (j2) * (d4) * (d5) + (j4) * (d5) + (j5))
+#define UNLAYOUT_31245(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d1) * (d2) * (d4) * (d5)), j1 = (ai)/((d2) * (d4) * (d5)) % (d1), j2 = (ai)/((d4) * (d5)) % (d2), j4 = (ai)/((d5)) % (d4), j5 = (ai) % (d5))
+#define LAYOUT_31254(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d1) * (d2) * (d5) * (d4) + (j1) * (d2) * (d5) * (d4) + (j2) * (d5) * (d4) + (j5) * (d4) + (j4))
+#define UNLAYOUT_31254(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d1) * (d2) * (d5) * (d4)), j1 = (ai)/((d2) * (d5) * (d4)) % (d1), j2 = (ai)/((d5) * (d4)) % (d2), j5 = (ai)/((d4)) % (d5), j4 = (ai) % (d4))
+#define LAYOUT_31425(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d1) * (d4) * (d2) * (d5) + (j1) * (d4) * (d2) * (d5) + (j4) * (d2) * (d5) + (j2) * (d5) + (j5))
+#define UNLAYOUT_31425(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d1) * (d4) * (d2) * (d5)), j1 = (ai)/((d4) * (d2) * (d5)) % (d1), j4 = (ai)/((d2) * (d5)) % (d4), j2 = (ai)/((d5)) % (d2), j5 = (ai) % (d5))
+#define LAYOUT_31452(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d1) * (d4) * (d5) * (d2) + (j1) * (d4) * (d5) * (d2) + (j4) * (d5) * (d2) + (j5) * (d2) + (j2))
+#define UNLAYOUT_31452(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d1) * (d4) * (d5) * (d2)), j1 = (ai)/((d4) * (d5) * (d2)) % (d1), j4 = (ai)/((d5) * (d2)) % (d4), j5 = (ai)/((d2)) % (d5), j2 = (ai) % (d2))
+#define LAYOUT_31524(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d1) * (d5) * (d2) * (d4) + (j1) * (d5) * (d2) * (d4) + (j5) * (d2) * (d4) + (j2) * (d4) + (j4))
+#define UNLAYOUT_31524(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d1) * (d5) * (d2) * (d4)), j1 = (ai)/((d5) * (d2) * (d4)) % (d1), j5 = (ai)/((d2) * (d4)) % (d5), j2 = (ai)/((d4)) % (d2), j4 = (ai) % (d4))
+#define LAYOUT_31542(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d1) * (d5) * (d4) * (d2) + (j1) * (d5) * (d4) * (d2) + (j5) * (d4) * (d2) + (j4) * (d2) + (j2))
+#define UNLAYOUT_31542(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d1) * (d5) * (d4) * (d2)), j1 = (ai)/((d5) * (d4) * (d2)) % (d1), j5 = (ai)/((d4) * (d2)) % (d5), j4 = (ai)/((d2)) % (d4), j2 = (ai) % (d2))
+#define LAYOUT_32145(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d2) * (d1) * (d4) * (d5) + (j2) * (d1) * (d4) * (d5) + (j1) * (d4) * (d5) + (j4) * (d5) + (j5))
+#define UNLAYOUT_32145(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d2) * (d1) * (d4) * (d5)), j2 = (ai)/((d1) * (d4) * (d5)) % (d2), j1 = (ai)/((d4) * (d5)) % (d1), j4 = (ai)/((d5)) % (d4), j5 = (ai) % (d5))
+#define LAYOUT_32154(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d2) * (d1) * (d5) * (d4) + (j2) * (d1) * (d5) * (d4) + (j1) * (d5) * (d4) + (j5) * (d4) + (j4))
+#define UNLAYOUT_32154(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d2) * (d1) * (d5) * (d4)), j2 = (ai)/((d1) * (d5) * (d4)) % (d2), j1 = (ai)/((d5) * (d4)) % (d1), j5 = (ai)/((d4)) % (d5), j4 = (ai) % (d4))
+#define LAYOUT_32415(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d2) * (d4) * (d1) * (d5) + (j2) * (d4) * (d1) * (d5) + (j4) * (d1) * (d5) + (j1) * (d5) + (j5))
+#define UNLAYOUT_32415(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d2) * (d4) * (d1) * (d5)), j2 = (ai)/((d4) * (d1) * (d5)) % (d2), j4 = (ai)/((d1) * (d5)) % (d4), j1 = (ai)/((d5)) % (d1), j5 = (ai) % (d5))
+#define LAYOUT_32451(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d2) * (d4) * (d5) * (d1) + (j2) * (d4) * (d5) * (d1) + (j4) * (d5) * (d1) + (j5) * (d1) + (j1))
+#define UNLAYOUT_32451(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d2) * (d4) * (d5) * (d1)), j2 = (ai)/((d4) * (d5) * (d1)) % (d2), j4 = (ai)/((d5) * (d1)) % (d4), j5 = (ai)/((d1)) % (d5), j1 = (ai) % (d1))
+#define LAYOUT_32514(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d2) * (d5) * (d1) * (d4) + (j2) * (d5) * (d1) * (d4) + (j5) * (d1) * (d4) + (j1) * (d4) + (j4))
+#define UNLAYOUT_32514(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d2) * (d5) * (d1) * (d4)), j2 = (ai)/((d5) * (d1) * (d4)) % (d2), j5 = (ai)/((d1) * (d4)) % (d5), j1 = (ai)/((d4)) % (d1), j4 = (ai) % (d4))
+#define LAYOUT_32541(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d2) * (d5) * (d4) * (d1) + (j2) * (d5) * (d4) * (d1) + (j5) * (d4) * (d1) + (j4) * (d1) + (j1))
+#define UNLAYOUT_32541(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d2) * (d5) * (d4) * (d1)), j2 = (ai)/((d5) * (d4) * (d1)) % (d2), j5 = (ai)/((d4) * (d1)) % (d5), j4 = (ai)/((d1)) % (d4), j1 = (ai) % (d1))
+#define LAYOUT_34125(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d4) * (d1) * (d2) * (d5) + (j4) * (d1) * (d2) * (d5) + (j1) * (d2) * (d5) + (j2) * (d5) + (j5))
+#define UNLAYOUT_34125(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d4) * (d1) * (d2) * (d5)), j4 = (ai)/((d1) * (d2) * (d5)) % (d4), j1 = (ai)/((d2) * (d5)) % (d1), j2 = (ai)/((d5)) % (d2), j5 = (ai) % (d5))
+#define LAYOUT_34152(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d4) * (d1) * (d5) * (d2) + (j4) * (d1) * (d5) * (d2) + (j1) * (d5) * (d2) + (j5) * (d2) + (j2))
+#define UNLAYOUT_34152(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d4) * (d1) * (d5) * (d2)), j4 = (ai)/((d1) * (d5) * (d2)) % (d4), j1 = (ai)/((d5) * (d2)) % (d1), j5 = (ai)/((d2)) % (d5), j2 = (ai) % (d2))
+#define LAYOUT_34215(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d4) * (d2) * (d1) * (d5) + (j4) * (d2) * (d1) * (d5) + (j2) * (d1) * (d5) + (j1) * (d5) + (j5))
+#define UNLAYOUT_34215(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d4) * (d2) * (d1) * (d5)), j4 = (ai)/((d2) * (d1) * (d5)) % (d4), j2 = (ai)/((d1) * (d5)) % (d2), j1 = (ai)/((d5)) % (d1), j5 = (ai) % (d5))
+#define LAYOUT_34251(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d4) * (d2) * (d5) * (d1) + (j4) * (d2) * (d5) * (d1) + (j2) * (d5) * (d1) + (j5) * (d1) + (j1))
+#define UNLAYOUT_34251(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d4) * (d2) * (d5) * (d1)), j4 = (ai)/((d2) * (d5) * (d1)) % (d4), j2 = (ai)/((d5) * (d1)) % (d2), j5 = (ai)/((d1)) % (d5), j1 = (ai) % (d1))
+#define LAYOUT_34512(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d4) * (d5) * (d1) * (d2) + (j4) * (d5) * (d1) * (d2) + (j5) * (d1) * (d2) + (j1) * (d2) + (j2))
+#define UNLAYOUT_34512(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d4) * (d5) * (d1) * (d2)), j4 = (ai)/((d5) * (d1) * (d2)) % (d4), j5 = (ai)/((d1) * (d2)) % (d5), j1 = (ai)/((d2)) % (d1), j2 = (ai) % (d2))
+#define LAYOUT_34521(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d4) * (d5) * (d2) * (d1) + (j4) * (d5) * (d2) * (d1) + (j5) * (d2) * (d1) + (j2) * (d1) + (j1))
+#define UNLAYOUT_34521(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d4) * (d5) * (d2) * (d1)), j4 = (ai)/((d5) * (d2) * (d1)) % (d4), j5 = (ai)/((d2) * (d1)) % (d5), j2 = (ai)/((d1)) % (d2), j1 = (ai) % (d1))
+#define LAYOUT_35124(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d5) * (d1) * (d2) * (d4) + (j5) * (d1) * (d2) * (d4) + (j1) * (d2) * (d4) + (j2) * (d4) + (j4))
+#define UNLAYOUT_35124(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d5) * (d1) * (d2) * (d4)), j5 = (ai)/((d1) * (d2) * (d4)) % (d5), j1 = (ai)/((d2) * (d4)) % (d1), j2 = (ai)/((d4)) % (d2), j4 = (ai) % (d4))
+#define LAYOUT_35142(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d5) * (d1) * (d4) * (d2) + (j5) * (d1) * (d4) * (d2) + (j1) * (d4) * (d2) + (j4) * (d2) + (j2))
+#define UNLAYOUT_35142(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d5) * (d1) * (d4) * (d2)), j5 = (ai)/((d1) * (d4) * (d2)) % (d5), j1 = (ai)/((d4) * (d2)) % (d1), j4 = (ai)/((d2)) % (d4), j2 = (ai) % (d2))
+#define LAYOUT_35214(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d5) * (d2) * (d1) * (d4) + (j5) * (d2) * (d1) * (d4) + (j2) * (d1) * (d4) + (j1) * (d4) + (j4))
+#define UNLAYOUT_35214(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d5) * (d2) * (d1) * (d4)), j5 = (ai)/((d2) * (d1) * (d4)) % (d5), j2 = (ai)/((d1) * (d4)) % (d2), j1 = (ai)/((d4)) % (d1), j4 = (ai) % (d4))
+#define LAYOUT_35241(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d5) * (d2) * (d4) * (d1) + (j5) * (d2) * (d4) * (d1) + (j2) * (d4) * (d1) + (j4) * (d1) + (j1))
+#define UNLAYOUT_35241(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d5) * (d2) * (d4) * (d1)), j5 = (ai)/((d2) * (d4) * (d1)) % (d5), j2 = (ai)/((d4) * (d1)) % (d2), j4 = (ai)/((d1)) % (d4), j1 = (ai) % (d1))
+#define LAYOUT_35412(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d5) * (d4) * (d1) * (d2) + (j5) * (d4) * (d1) * (d2) + (j4) * (d1) * (d2) + (j1) * (d2) + (j2))
+#define UNLAYOUT_35412(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d5) * (d4) * (d1) * (d2)), j5 = (ai)/((d4) * (d1) * (d2)) % (d5), j4 = (ai)/((d1) * (d2)) % (d4), j1 = (ai)/((d2)) % (d1), j2 = (ai) % (d2))
+#define LAYOUT_35421(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j3) * (d5) * (d4) * (d2) * (d1) + (j5) * (d4) * (d2) * (d1) + (j4) * (d2) * (d1) + (j2) * (d1) + (j1))
+#define UNLAYOUT_35421(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j3 = (ai)/((d5) * (d4) * (d2) * (d1)), j5 = (ai)/((d4) * (d2) * (d1)) % (d5), j4 = (ai)/((d2) * (d1)) % (d4), j2 = (ai)/((d1)) % (d2), j1 = (ai) % (d1))
+#define LAYOUT_41235(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d1) * (d2) * (d3) * (d5) + (j1) * (d2) * (d3) * (d5) + (j2) * (d3) * (d5) + (j3) * (d5) + (j5))
+#define UNLAYOUT_41235(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d1) * (d2) * (d3) * (d5)), j1 = (ai)/((d2) * (d3) * (d5)) % (d1), j2 = (ai)/((d3) * (d5)) % (d2), j3 = (ai)/((d5)) % (d3), j5 = (ai) % (d5))
+#define LAYOUT_41253(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d1) * (d2) * (d5) * (d3) + (j1) * (d2) * (d5) * (d3) + (j2) * (d5) * (d3) + (j5) * (d3) + (j3))
+#define UNLAYOUT_41253(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d1) * (d2) * (d5) * (d3)), j1 = (ai)/((d2) * (d5) * (d3)) % (d1), j2 = (ai)/((d5) * (d3)) % (d2), j5 = (ai)/((d3)) % (d5), j3 = (ai) % (d3))
+#define LAYOUT_41325(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d1) * (d3) * (d2) * (d5) + (j1) * (d3) * (d2) * (d5) + (j3) * (d2) * (d5) + (j2) * (d5) + (j5))
+#define UNLAYOUT_41325(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d1) * (d3) * (d2) * (d5)), j1 = (ai)/((d3) * (d2) * (d5)) % (d1), j3 = (ai)/((d2) * (d5)) % (d3), j2 = (ai)/((d5)) % (d2), j5 = (ai) % (d5))
+#define LAYOUT_41352(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d1) * (d3) * (d5) * (d2) + (j1) * (d3) * (d5) * (d2) + (j3) * (d5) * (d2) + (j5) * (d2) + (j2))
+#define UNLAYOUT_41352(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d1) * (d3) * (d5) * (d2)), j1 = (ai)/((d3) * (d5) * (d2)) % (d1), j3 = (ai)/((d5) * (d2)) % (d3), j5 = (ai)/((d2)) % (d5), j2 = (ai) % (d2))
+#define LAYOUT_41523(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d1) * (d5) * (d2) * (d3) + (j1) * (d5) * (d2) * (d3) + (j5) * (d2) * (d3) + (j2) * (d3) + (j3))
+#define UNLAYOUT_41523(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d1) * (d5) * (d2) * (d3)), j1 = (ai)/((d5) * (d2) * (d3)) % (d1), j5 = (ai)/((d2) * (d3)) % (d5), j2 = (ai)/((d3)) % (d2), j3 = (ai) % (d3))
+#define LAYOUT_41532(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d1) * (d5) * (d3) * (d2) + (j1) * (d5) * (d3) * (d2) + (j5) * (d3) * (d2) + (j3) * (d2) + (j2))
+#define UNLAYOUT_41532(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d1) * (d5) * (d3) * (d2)), j1 = (ai)/((d5) * (d3) * (d2)) % (d1), j5 = (ai)/((d3) * (d2)) % (d5), j3 = (ai)/((d2)) % (d3), j2 = (ai) % (d2))
+#define LAYOUT_42135(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d2) * (d1) * (d3) * (d5) + (j2) * (d1) * (d3) * (d5) + (j1) * (d3) * (d5) + (j3) * (d5) + (j5))
+#define UNLAYOUT_42135(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d2) * (d1) * (d3) * (d5)), j2 = (ai)/((d1) * (d3) * (d5)) % (d2), j1 = (ai)/((d3) * (d5)) % (d1), j3 = (ai)/((d5)) % (d3), j5 = (ai) % (d5))
+#define LAYOUT_42153(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d2) * (d1) * (d5) * (d3) + (j2) * (d1) * (d5) * (d3) + (j1) * (d5) * (d3) + (j5) * (d3) + (j3))
+#define UNLAYOUT_42153(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d2) * (d1) * (d5) * (d3)), j2 = (ai)/((d1) * (d5) * (d3)) % (d2), j1 = (ai)/((d5) * (d3)) % (d1), j5 = (ai)/((d3)) % (d5), j3 = (ai) % (d3))
+#define LAYOUT_42315(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d2) * (d3) * (d1) * (d5) + (j2) * (d3) * (d1) * (d5) + (j3) * (d1) * (d5) + (j1) * (d5) + (j5))
+#define UNLAYOUT_42315(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d2) * (d3) * (d1) * (d5)), j2 = (ai)/((d3) * (d1) * (d5)) % (d2), j3 = (ai)/((d1) * (d5)) % (d3), j1 = (ai)/((d5)) % (d1), j5 = (ai) % (d5))
+#define LAYOUT_42351(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d2) * (d3) * (d5) * (d1) + (j2) * (d3) * (d5) * (d1) + (j3) * (d5) * (d1) + (j5) * (d1) + (j1))
+#define UNLAYOUT_42351(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d2) * (d3) * (d5) * (d1)), j2 = (ai)/((d3) * (d5) * (d1)) % (d2), j3 = (ai)/((d5) * (d1)) % (d3), j5 = (ai)/((d1)) % (d5), j1 = (ai) % (d1))
+#define LAYOUT_42513(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d2) * (d5) * (d1) * (d3) + (j2) * (d5) * (d1) * (d3) + (j5) * (d1) * (d3) + (j1) * (d3) + (j3))
+#define UNLAYOUT_42513(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d2) * (d5) * (d1) * (d3)), j2 = (ai)/((d5) * (d1) * (d3)) % (d2), j5 = (ai)/((d1) * (d3)) % (d5), j1 = (ai)/((d3)) % (d1), j3 = (ai) % (d3))
+#define LAYOUT_42531(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d2) * (d5) * (d3) * (d1) + (j2) * (d5) * (d3) * (d1) + (j5) * (d3) * (d1) + (j3) * (d1) + (j1))
+#define UNLAYOUT_42531(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d2) * (d5) * (d3) * (d1)), j2 = (ai)/((d5) * (d3) * (d1)) % (d2), j5 = (ai)/((d3) * (d1)) % (d5), j3 = (ai)/((d1)) % (d3), j1 = (ai) % (d1))
+#define LAYOUT_43125(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d3) * (d1) * (d2) * (d5) + (j3) * (d1) * (d2) * (d5) + (j1) * (d2) * (d5) + (j2) * (d5) + (j5))
+#define UNLAYOUT_43125(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d3) * (d1) * (d2) * (d5)), j3 = (ai)/((d1) * (d2) * (d5)) % (d3), j1 = (ai)/((d2) * (d5)) % (d1), j2 = (ai)/((d5)) % (d2), j5 = (ai) % (d5))
+#define LAYOUT_43152(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d3) * (d1) * (d5) * (d2) + (j3) * (d1) * (d5) * (d2) + (j1) * (d5) * (d2) + (j5) * (d2) + (j2))
+#define UNLAYOUT_43152(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d3) * (d1) * (d5) * (d2)), j3 = (ai)/((d1) * (d5) * (d2)) % (d3), j1 = (ai)/((d5) * (d2)) % (d1), j5 = (ai)/((d2)) % (d5), j2 = (ai) % (d2))
+#define LAYOUT_43215(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d3) * (d2) * (d1) * (d5) + (j3) * (d2) * (d1) * (d5) + (j2) * (d1) * (d5) + (j1) * (d5) + (j5))
+#define UNLAYOUT_43215(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d3) * (d2) * (d1) * (d5)), j3 = (ai)/((d2) * (d1) * (d5)) % (d3), j2 = (ai)/((d1) * (d5)) % (d2), j1 = (ai)/((d5)) % (d1), j5 = (ai) % (d5))
+#define LAYOUT_43251(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d3) * (d2) * (d5) * (d1) + (j3) * (d2) * (d5) * (d1) + (j2) * (d5) * (d1) + (j5) * (d1) + (j1))
+#define UNLAYOUT_43251(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d3) * (d2) * (d5) * (d1)), j3 = (ai)/((d2) * (d5) * (d1)) % (d3), j2 = (ai)/((d5) * (d1)) % (d2), j5 = (ai)/((d1)) % (d5), j1 = (ai) % (d1))
+#define LAYOUT_43512(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d3) * (d5) * (d1) * (d2) + (j3) * (d5) * (d1) * (d2) + (j5) * (d1) * (d2) + (j1) * (d2) + (j2))
+#define UNLAYOUT_43512(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d3) * (d5) * (d1) * (d2)), j3 = (ai)/((d5) * (d1) * (d2)) % (d3), j5 = (ai)/((d1) * (d2)) % (d5), j1 = (ai)/((d2)) % (d1), j2 = (ai) % (d2))
+#define LAYOUT_43521(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d3) * (d5) * (d2) * (d1) + (j3) * (d5) * (d2) * (d1) + (j5) * (d2) * (d1) + (j2) * (d1) + (j1))
+#define UNLAYOUT_43521(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d3) * (d5) * (d2) * (d1)), j3 = (ai)/((d5) * (d2) * (d1)) % (d3), j5 = (ai)/((d2) * (d1)) % (d5), j2 = (ai)/((d1)) % (d2), j1 = (ai) % (d1))
+#define LAYOUT_45123(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d5) * (d1) * (d2) * (d3) + (j5) * (d1) * (d2) * (d3) + (j1) * (d2) * (d3) + (j2) * (d3) + (j3))
+#define UNLAYOUT_45123(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d5) * (d1) * (d2) * (d3)), j5 = (ai)/((d1) * (d2) * (d3)) % (d5), j1 = (ai)/((d2) * (d3)) % (d1), j2 = (ai)/((d3)) % (d2), j3 = (ai) % (d3))
+#define LAYOUT_45132(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d5) * (d1) * (d3) * (d2) + (j5) * (d1) * (d3) * (d2) + (j1) * (d3) * (d2) + (j3) * (d2) + (j2))
+#define UNLAYOUT_45132(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d5) * (d1) * (d3) * (d2)), j5 = (ai)/((d1) * (d3) * (d2)) % (d5), j1 = (ai)/((d3) * (d2)) % (d1), j3 = (ai)/((d2)) % (d3), j2 = (ai) % (d2))
+#define LAYOUT_45213(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d5) * (d2) * (d1) * (d3) + (j5) * (d2) * (d1) * (d3) + (j2) * (d1) * (d3) + (j1) * (d3) + (j3))
+#define UNLAYOUT_45213(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d5) * (d2) * (d1) * (d3)), j5 = (ai)/((d2) * (d1) * (d3)) % (d5), j2 = (ai)/((d1) * (d3)) % (d2), j1 = (ai)/((d3)) % (d1), j3 = (ai) % (d3))
+#define LAYOUT_45231(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d5) * (d2) * (d3) * (d1) + (j5) * (d2) * (d3) * (d1) + (j2) * (d3) * (d1) + (j3) * (d1) + (j1))
+#define UNLAYOUT_45231(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d5) * (d2) * (d3) * (d1)), j5 = (ai)/((d2) * (d3) * (d1)) % (d5), j2 = (ai)/((d3) * (d1)) % (d2), j3 = (ai)/((d1)) % (d3), j1 = (ai) % (d1))
+#define LAYOUT_45312(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d5) * (d3) * (d1) * (d2) + (j5) * (d3) * (d1) * (d2) + (j3) * (d1) * (d2) + (j1) * (d2) + (j2))
+#define UNLAYOUT_45312(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d5) * (d3) * (d1) * (d2)), j5 = (ai)/((d3) * (d1) * (d2)) % (d5), j3 = (ai)/((d1) * (d2)) % (d3), j1 = (ai)/((d2)) % (d1), j2 = (ai) % (d2))
+#define LAYOUT_45321(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j4) * (d5) * (d3) * (d2) * (d1) + (j5) * (d3) * (d2) * (d1) + (j3) * (d2) * (d1) + (j2) * (d1) + (j1))
+#define UNLAYOUT_45321(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j4 = (ai)/((d5) * (d3) * (d2) * (d1)), j5 = (ai)/((d3) * (d2) * (d1)) % (d5), j3 = (ai)/((d2) * (d1)) % (d3), j2 = (ai)/((d1)) % (d2), j1 = (ai) % (d1))
+#define LAYOUT_51234(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d1) * (d2) * (d3) * (d4) + (j1) * (d2) * (d3) * (d4) + (j2) * (d3) * (d4) + (j3) * (d4) + (j4))
+#define UNLAYOUT_51234(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d1) * (d2) * (d3) * (d4)), j1 = (ai)/((d2) * (d3) * (d4)) % (d1), j2 = (ai)/((d3) * (d4)) % (d2), j3 = (ai)/((d4)) % (d3), j4 = (ai) % (d4))
+#define LAYOUT_51243(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d1) * (d2) * (d4) * (d3) + (j1) * (d2) * (d4) * (d3) + (j2) * (d4) * (d3) + (j4) * (d3) + (j3))
+#define UNLAYOUT_51243(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d1) * (d2) * (d4) * (d3)), j1 = (ai)/((d2) * (d4) * (d3)) % (d1), j2 = (ai)/((d4) * (d3)) % (d2), j4 = (ai)/((d3)) % (d4), j3 = (ai) % (d3))
+#define LAYOUT_51324(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d1) * (d3) * (d2) * (d4) + (j1) * (d3) * (d2) * (d4) + (j3) * (d2) * (d4) + (j2) * (d4) + (j4))
+#define UNLAYOUT_51324(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d1) * (d3) * (d2) * (d4)), j1 = (ai)/((d3) * (d2) * (d4)) % (d1), j3 = (ai)/((d2) * (d4)) % (d3), j2 = (ai)/((d4)) % (d2), j4 = (ai) % (d4))
+#define LAYOUT_51342(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d1) * (d3) * (d4) * (d2) + (j1) * (d3) * (d4) * (d2) + (j3) * (d4) * (d2) + (j4) * (d2) + (j2))
+#define UNLAYOUT_51342(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d1) * (d3) * (d4) * (d2)), j1 = (ai)/((d3) * (d4) * (d2)) % (d1), j3 = (ai)/((d4) * (d2)) % (d3), j4 = (ai)/((d2)) % (d4), j2 = (ai) % (d2))
+#define LAYOUT_51423(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d1) * (d4) * (d2) * (d3) + (j1) * (d4) * (d2) * (d3) + (j4) * (d2) * (d3) + (j2) * (d3) + (j3))
+#define UNLAYOUT_51423(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d1) * (d4) * (d2) * (d3)), j1 = (ai)/((d4) * (d2) * (d3)) % (d1), j4 = (ai)/((d2) * (d3)) % (d4), j2 = (ai)/((d3)) % (d2), j3 = (ai) % (d3))
+#define LAYOUT_51432(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d1) * (d4) * (d3) * (d2) + (j1) * (d4) * (d3) * (d2) + (j4) * (d3) * (d2) + (j3) * (d2) + (j2))
+#define UNLAYOUT_51432(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d1) * (d4) * (d3) * (d2)), j1 = (ai)/((d4) * (d3) * (d2)) % (d1), j4 = (ai)/((d3) * (d2)) % (d4), j3 = (ai)/((d2)) % (d3), j2 = (ai) % (d2))
+#define LAYOUT_52134(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d2) * (d1) * (d3) * (d4) + (j2) * (d1) * (d3) * (d4) + (j1) * (d3) * (d4) + (j3) * (d4) + (j4))
+#define UNLAYOUT_52134(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d2) * (d1) * (d3) * (d4)), j2 = (ai)/((d1) * (d3) * (d4)) % (d2), j1 = (ai)/((d3) * (d4)) % (d1), j3 = (ai)/((d4)) % (d3), j4 = (ai) % (d4))
+#define LAYOUT_52143(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d2) * (d1) * (d4) * (d3) + (j2) * (d1) * (d4) * (d3) + (j1) * (d4) * (d3) + (j4) * (d3) + (j3))
+#define UNLAYOUT_52143(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d2) * (d1) * (d4) * (d3)), j2 = (ai)/((d1) * (d4) * (d3)) % (d2), j1 = (ai)/((d4) * (d3)) % (d1), j4 = (ai)/((d3)) % (d4), j3 = (ai) % (d3))
+#define LAYOUT_52314(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d2) * (d3) * (d1) * (d4) + (j2) * (d3) * (d1) * (d4) + (j3) * (d1) * (d4) + (j1) * (d4) + (j4))
+#define UNLAYOUT_52314(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d2) * (d3) * (d1) * (d4)), j2 = (ai)/((d3) * (d1) * (d4)) % (d2), j3 = (ai)/((d1) * (d4)) % (d3), j1 = (ai)/((d4)) % (d1), j4 = (ai) % (d4))
+#define LAYOUT_52341(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d2) * (d3) * (d4) * (d1) + (j2) * (d3) * (d4) * (d1) + (j3) * (d4) * (d1) + (j4) * (d1) + (j1))
+#define UNLAYOUT_52341(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d2) * (d3) * (d4) * (d1)), j2 = (ai)/((d3) * (d4) * (d1)) % (d2), j3 = (ai)/((d4) * (d1)) % (d3), j4 = (ai)/((d1)) % (d4), j1 = (ai) % (d1))
+#define LAYOUT_52413(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d2) * (d4) * (d1) * (d3) + (j2) * (d4) * (d1) * (d3) + (j4) * (d1) * (d3) + (j1) * (d3) + (j3))
+#define UNLAYOUT_52413(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d2) * (d4) * (d1) * (d3)), j2 = (ai)/((d4) * (d1) * (d3)) % (d2), j4 = (ai)/((d1) * (d3)) % (d4), j1 = (ai)/((d3)) % (d1), j3 = (ai) % (d3))
+#define LAYOUT_52431(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d2) * (d4) * (d3) * (d1) + (j2) * (d4) * (d3) * (d1) + (j4) * (d3) * (d1) + (j3) * (d1) + (j1))
+#define UNLAYOUT_52431(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d2) * (d4) * (d3) * (d1)), j2 = (ai)/((d4) * (d3) * (d1)) % (d2), j4 = (ai)/((d3) * (d1)) % (d4), j3 = (ai)/((d1)) % (d3), j1 = (ai) % (d1))
+#define LAYOUT_53124(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d3) * (d1) * (d2) * (d4) + (j3) * (d1) * (d2) * (d4) + (j1) * (d2) * (d4) + (j2) * (d4) + (j4))
+#define UNLAYOUT_53124(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d3) * (d1) * (d2) * (d4)), j3 = (ai)/((d1) * (d2) * (d4)) % (d3), j1 = (ai)/((d2) * (d4)) % (d1), j2 = (ai)/((d4)) % (d2), j4 = (ai) % (d4))
+#define LAYOUT_53142(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d3) * (d1) * (d4) * (d2) + (j3) * (d1) * (d4) * (d2) + (j1) * (d4) * (d2) + (j4) * (d2) + (j2))
+#define UNLAYOUT_53142(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d3) * (d1) * (d4) * (d2)), j3 = (ai)/((d1) * (d4) * (d2)) % (d3), j1 = (ai)/((d4) * (d2)) % (d1), j4 = (ai)/((d2)) % (d4), j2 = (ai) % (d2))
+#define LAYOUT_53214(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d3) * (d2) * (d1) * (d4) + (j3) * (d2) * (d1) * (d4) + (j2) * (d1) * (d4) + (j1) * (d4) + (j4))
+#define UNLAYOUT_53214(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d3) * (d2) * (d1) * (d4)), j3 = (ai)/((d2) * (d1) * (d4)) % (d3), j2 = (ai)/((d1) * (d4)) % (d2), j1 = (ai)/((d4)) % (d1), j4 = (ai) % (d4))
+#define LAYOUT_53241(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d3) * (d2) * (d4) * (d1) + (j3) * (d2) * (d4) * (d1) + (j2) * (d4) * (d1) + (j4) * (d1) + (j1))
+#define UNLAYOUT_53241(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d3) * (d2) * (d4) * (d1)), j3 = (ai)/((d2) * (d4) * (d1)) % (d3), j2 = (ai)/((d4) * (d1)) % (d2), j4 = (ai)/((d1)) % (d4), j1 = (ai) % (d1))
+#define LAYOUT_53412(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d3) * (d4) * (d1) * (d2) + (j3) * (d4) * (d1) * (d2) + (j4) * (d1) * (d2) + (j1) * (d2) + (j2))
+#define UNLAYOUT_53412(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d3) * (d4) * (d1) * (d2)), j3 = (ai)/((d4) * (d1) * (d2)) % (d3), j4 = (ai)/((d1) * (d2)) % (d4), j1 = (ai)/((d2)) % (d1), j2 = (ai) % (d2))
+#define LAYOUT_53421(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d3) * (d4) * (d2) * (d1) + (j3) * (d4) * (d2) * (d1) + (j4) * (d2) * (d1) + (j2) * (d1) + (j1))
+#define UNLAYOUT_53421(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d3) * (d4) * (d2) * (d1)), j3 = (ai)/((d4) * (d2) * (d1)) % (d3), j4 = (ai)/((d2) * (d1)) % (d4), j2 = (ai)/((d1)) % (d2), j1 = (ai) % (d1))
+#define LAYOUT_54123(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d4) * (d1) * (d2) * (d3) + (j4) * (d1) * (d2) * (d3) + (j1) * (d2) * (d3) + (j2) * (d3) + (j3))
+#define UNLAYOUT_54123(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d4) * (d1) * (d2) * (d3)), j4 = (ai)/((d1) * (d2) * (d3)) % (d4), j1 = (ai)/((d2) * (d3)) % (d1), j2 = (ai)/((d3)) % (d2), j3 = (ai) % (d3))
+#define LAYOUT_54132(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d4) * (d1) * (d3) * (d2) + (j4) * (d1) * (d3) * (d2) + (j1) * (d3) * (d2) + (j3) * (d2) + (j2))
+#define UNLAYOUT_54132(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d4) * (d1) * (d3) * (d2)), j4 = (ai)/((d1) * (d3) * (d2)) % (d4), j1 = (ai)/((d3) * (d2)) % (d1), j3 = (ai)/((d2)) % (d3), j2 = (ai) % (d2))
+#define LAYOUT_54213(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d4) * (d2) * (d1) * (d3) + (j4) * (d2) * (d1) * (d3) + (j2) * (d1) * (d3) + (j1) * (d3) + (j3))
+#define UNLAYOUT_54213(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d4) * (d2) * (d1) * (d3)), j4 = (ai)/((d2) * (d1) * (d3)) % (d4), j2 = (ai)/((d1) * (d3)) % (d2), j1 = (ai)/((d3)) % (d1), j3 = (ai) % (d3))
+#define LAYOUT_54231(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d4) * (d2) * (d3) * (d1) + (j4) * (d2) * (d3) * (d1) + (j2) * (d3) * (d1) + (j3) * (d1) + (j1))
+#define UNLAYOUT_54231(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d4) * (d2) * (d3) * (d1)), j4 = (ai)/((d2) * (d3) * (d1)) % (d4), j2 = (ai)/((d3) * (d1)) % (d2), j3 = (ai)/((d1)) % (d3), j1 = (ai) % (d1))
+#define LAYOUT_54312(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d4) * (d3) * (d1) * (d2) + (j4) * (d3) * (d1) * (d2) + (j3) * (d1) * (d2) + (j1) * (d2) + (j2))
+#define UNLAYOUT_54312(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d4) * (d3) * (d1) * (d2)), j4 = (ai)/((d3) * (d1) * (d2)) % (d4), j3 = (ai)/((d1) * (d2)) % (d3), j1 = (ai)/((d2)) % (d1), j2 = (ai) % (d2))
+#define LAYOUT_54321(j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) ((j5) * (d4) * (d3) * (d2) * (d1) + (j4) * (d3) * (d2) * (d1) + (j3) * (d2) * (d1) + (j2) * (d1) + (j1))
+#define UNLAYOUT_54321(ai, j1, j2, j3, j4, j5, d1, d2, d3, d4, d5) (j5 = (ai)/((d4) * (d3) * (d2) * (d1)), j4 = (ai)/((d3) * (d2) * (d1)) % (d4), j3 = (ai)/((d2) * (d1)) % (d3), j2 = (ai)/((d1)) % (d2), j1 = (ai) % (d1))
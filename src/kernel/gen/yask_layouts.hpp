@@ -0,0 +1,3625 @@
+// Automatically generated; do not edit.
+
+#pragma once
+
+ // Layout base class.
+ class Layout {
+
+ protected:
+  Indices _sizes;   // Size of each dimension.
+  Layout(int n, const Indices& sizes) :
+   _sizes(sizes) { _sizes.setNumDims(n); }
+
+ public:
+  Layout(int nsizes) :
+   _sizes(idx_t(0), nsizes) { }
+  virtual ~Layout() { }
+
+  // Access sizes.
+  const Indices& get_sizes() const { return _sizes; }
+  void set_sizes(const Indices& sizes) { _sizes = sizes; }
+  idx_t get_size(int i) const {
+    assert(i >= 0);
+    assert(i < _sizes.getNumDims());
+    return _sizes[i]; 
+  }
+  void set_size(int i, idx_t size) {
+    assert(i >= 0);
+    assert(i < _sizes.getNumDims());
+    _sizes[i] = size; 
+  }
+  virtual int get_num_sizes() const {
+    return _sizes.getNumDims(); 
+  }
+
+  // Product of valid sizes.
+  virtual idx_t get_num_elements() const {
+    idx_t nelems = 1;
+    for (int i = 0; i < _sizes.getNumDims(); i++)
+      nelems *= _sizes[i];
+    return nelems;
+  }
+
+  // Return 1-D offset from n-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const =0;
+
+  // Return n indices based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const =0;
+ };
+
+ // 0-D <-> 1-D layout class.
+ // (Trivial layout.)
+ class Layout_0d : public Layout {
+ public:
+  Layout_0d() : Layout(0) { }
+  Layout_0d(const Indices& sizes) : Layout(0, sizes) { }
+  virtual int get_num_sizes() const final {
+    return 0;
+  }
+
+  // Return 1-D offset from 0-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return 0; 
+  }
+
+  // Return 0 indices based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(idx_t(0), 0);
+    return j;
+  }
+ };
+
+
+ // 1-D <-> 1-D layout base class.
+ class Layout_1d : public Layout {
+ public:
+  Layout_1d() : Layout(1) { }
+  Layout_1d(const Indices& sizes) : Layout(1, sizes) { }
+ };
+
+ // 1-D <-> 1-D layout class with dimensions in d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_1 : public Layout_1d {
+ public:
+  Layout_1() { }
+  Layout_1(const Indices& sizes) : Layout_1d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 1;
+  }
+
+  // Return 1-D offset from 1-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0];
+  }
+
+  // Return 1 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai);
+    return j;
+  }
+ };
+
+ // 2-D <-> 1-D layout base class.
+ class Layout_2d : public Layout {
+ public:
+  Layout_2d() : Layout(2) { }
+  Layout_2d(const Indices& sizes) : Layout(2, sizes) { }
+ };
+
+ // 2-D <-> 1-D layout class with dimensions in d1, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_12 : public Layout_2d {
+ public:
+  Layout_12() { }
+  Layout_12(const Indices& sizes) : Layout_2d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 2;
+  }
+
+  // Return 1-D offset from 2-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[1] + j[1];
+  }
+
+  // Return 2 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[1]); j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 2-D <-> 1-D layout class with dimensions in d2, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_21 : public Layout_2d {
+ public:
+  Layout_21() { }
+  Layout_21(const Indices& sizes) : Layout_2d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 2;
+  }
+
+  // Return 1-D offset from 2-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[0] + j[0];
+  }
+
+  // Return 2 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[0]); j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 3-D <-> 1-D layout base class.
+ class Layout_3d : public Layout {
+ public:
+  Layout_3d() : Layout(3) { }
+  Layout_3d(const Indices& sizes) : Layout(3, sizes) { }
+ };
+
+ // 3-D <-> 1-D layout class with dimensions in d1, d2, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_123 : public Layout_3d {
+ public:
+  Layout_123() { }
+  Layout_123(const Indices& sizes) : Layout_3d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 3;
+  }
+
+  // Return 1-D offset from 3-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[1] * _sizes[2] + j[1] * _sizes[2] + j[2];
+  }
+
+  // Return 3 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[1] * _sizes[2]); j[1] = (ai)/(_sizes[2]) % _sizes[1]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 3-D <-> 1-D layout class with dimensions in d1, d3, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_132 : public Layout_3d {
+ public:
+  Layout_132() { }
+  Layout_132(const Indices& sizes) : Layout_3d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 3;
+  }
+
+  // Return 1-D offset from 3-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[2] * _sizes[1] + j[2] * _sizes[1] + j[1];
+  }
+
+  // Return 3 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[2] * _sizes[1]); j[2] = (ai)/(_sizes[1]) % _sizes[2]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 3-D <-> 1-D layout class with dimensions in d2, d1, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_213 : public Layout_3d {
+ public:
+  Layout_213() { }
+  Layout_213(const Indices& sizes) : Layout_3d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 3;
+  }
+
+  // Return 1-D offset from 3-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[0] * _sizes[2] + j[0] * _sizes[2] + j[2];
+  }
+
+  // Return 3 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[0] * _sizes[2]); j[0] = (ai)/(_sizes[2]) % _sizes[0]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 3-D <-> 1-D layout class with dimensions in d2, d3, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_231 : public Layout_3d {
+ public:
+  Layout_231() { }
+  Layout_231(const Indices& sizes) : Layout_3d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 3;
+  }
+
+  // Return 1-D offset from 3-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[2] * _sizes[0] + j[2] * _sizes[0] + j[0];
+  }
+
+  // Return 3 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[2] * _sizes[0]); j[2] = (ai)/(_sizes[0]) % _sizes[2]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 3-D <-> 1-D layout class with dimensions in d3, d1, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_312 : public Layout_3d {
+ public:
+  Layout_312() { }
+  Layout_312(const Indices& sizes) : Layout_3d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 3;
+  }
+
+  // Return 1-D offset from 3-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[0] * _sizes[1] + j[0] * _sizes[1] + j[1];
+  }
+
+  // Return 3 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[0] * _sizes[1]); j[0] = (ai)/(_sizes[1]) % _sizes[0]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 3-D <-> 1-D layout class with dimensions in d3, d2, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_321 : public Layout_3d {
+ public:
+  Layout_321() { }
+  Layout_321(const Indices& sizes) : Layout_3d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 3;
+  }
+
+  // Return 1-D offset from 3-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[1] * _sizes[0] + j[1] * _sizes[0] + j[0];
+  }
+
+  // Return 3 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[1] * _sizes[0]); j[1] = (ai)/(_sizes[0]) % _sizes[1]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout base class.
+ class Layout_4d : public Layout {
+ public:
+  Layout_4d() : Layout(4) { }
+  Layout_4d(const Indices& sizes) : Layout(4, sizes) { }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d1, d2, d3, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_1234 : public Layout_4d {
+ public:
+  Layout_1234() { }
+  Layout_1234(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[1] * _sizes[2] * _sizes[3] + j[1] * _sizes[2] * _sizes[3] + j[2] * _sizes[3] + j[3];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[1] * _sizes[2] * _sizes[3]); j[1] = (ai)/(_sizes[2] * _sizes[3]) % _sizes[1]; j[2] = (ai)/(_sizes[3]) % _sizes[2]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d1, d2, d4, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_1243 : public Layout_4d {
+ public:
+  Layout_1243() { }
+  Layout_1243(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[1] * _sizes[3] * _sizes[2] + j[1] * _sizes[3] * _sizes[2] + j[3] * _sizes[2] + j[2];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[1] * _sizes[3] * _sizes[2]); j[1] = (ai)/(_sizes[3] * _sizes[2]) % _sizes[1]; j[3] = (ai)/(_sizes[2]) % _sizes[3]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d1, d3, d2, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_1324 : public Layout_4d {
+ public:
+  Layout_1324() { }
+  Layout_1324(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[2] * _sizes[1] * _sizes[3] + j[2] * _sizes[1] * _sizes[3] + j[1] * _sizes[3] + j[3];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[2] * _sizes[1] * _sizes[3]); j[2] = (ai)/(_sizes[1] * _sizes[3]) % _sizes[2]; j[1] = (ai)/(_sizes[3]) % _sizes[1]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d1, d3, d4, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_1342 : public Layout_4d {
+ public:
+  Layout_1342() { }
+  Layout_1342(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[2] * _sizes[3] * _sizes[1] + j[2] * _sizes[3] * _sizes[1] + j[3] * _sizes[1] + j[1];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[2] * _sizes[3] * _sizes[1]); j[2] = (ai)/(_sizes[3] * _sizes[1]) % _sizes[2]; j[3] = (ai)/(_sizes[1]) % _sizes[3]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d1, d4, d2, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_1423 : public Layout_4d {
+ public:
+  Layout_1423() { }
+  Layout_1423(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[3] * _sizes[1] * _sizes[2] + j[3] * _sizes[1] * _sizes[2] + j[1] * _sizes[2] + j[2];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[3] * _sizes[1] * _sizes[2]); j[3] = (ai)/(_sizes[1] * _sizes[2]) % _sizes[3]; j[1] = (ai)/(_sizes[2]) % _sizes[1]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d1, d4, d3, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_1432 : public Layout_4d {
+ public:
+  Layout_1432() { }
+  Layout_1432(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[3] * _sizes[2] * _sizes[1] + j[3] * _sizes[2] * _sizes[1] + j[2] * _sizes[1] + j[1];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[3] * _sizes[2] * _sizes[1]); j[3] = (ai)/(_sizes[2] * _sizes[1]) % _sizes[3]; j[2] = (ai)/(_sizes[1]) % _sizes[2]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d2, d1, d3, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_2134 : public Layout_4d {
+ public:
+  Layout_2134() { }
+  Layout_2134(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[0] * _sizes[2] * _sizes[3] + j[0] * _sizes[2] * _sizes[3] + j[2] * _sizes[3] + j[3];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[0] * _sizes[2] * _sizes[3]); j[0] = (ai)/(_sizes[2] * _sizes[3]) % _sizes[0]; j[2] = (ai)/(_sizes[3]) % _sizes[2]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d2, d1, d4, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_2143 : public Layout_4d {
+ public:
+  Layout_2143() { }
+  Layout_2143(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[0] * _sizes[3] * _sizes[2] + j[0] * _sizes[3] * _sizes[2] + j[3] * _sizes[2] + j[2];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[0] * _sizes[3] * _sizes[2]); j[0] = (ai)/(_sizes[3] * _sizes[2]) % _sizes[0]; j[3] = (ai)/(_sizes[2]) % _sizes[3]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d2, d3, d1, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_2314 : public Layout_4d {
+ public:
+  Layout_2314() { }
+  Layout_2314(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[2] * _sizes[0] * _sizes[3] + j[2] * _sizes[0] * _sizes[3] + j[0] * _sizes[3] + j[3];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[2] * _sizes[0] * _sizes[3]); j[2] = (ai)/(_sizes[0] * _sizes[3]) % _sizes[2]; j[0] = (ai)/(_sizes[3]) % _sizes[0]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d2, d3, d4, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_2341 : public Layout_4d {
+ public:
+  Layout_2341() { }
+  Layout_2341(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[2] * _sizes[3] * _sizes[0] + j[2] * _sizes[3] * _sizes[0] + j[3] * _sizes[0] + j[0];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[2] * _sizes[3] * _sizes[0]); j[2] = (ai)/(_sizes[3] * _sizes[0]) % _sizes[2]; j[3] = (ai)/(_sizes[0]) % _sizes[3]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d2, d4, d1, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_2413 : public Layout_4d {
+ public:
+  Layout_2413() { }
+  Layout_2413(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[3] * _sizes[0] * _sizes[2] + j[3] * _sizes[0] * _sizes[2] + j[0] * _sizes[2] + j[2];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[3] * _sizes[0] * _sizes[2]); j[3] = (ai)/(_sizes[0] * _sizes[2]) % _sizes[3]; j[0] = (ai)/(_sizes[2]) % _sizes[0]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d2, d4, d3, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_2431 : public Layout_4d {
+ public:
+  Layout_2431() { }
+  Layout_2431(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[3] * _sizes[2] * _sizes[0] + j[3] * _sizes[2] * _sizes[0] + j[2] * _sizes[0] + j[0];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[3] * _sizes[2] * _sizes[0]); j[3] = (ai)/(_sizes[2] * _sizes[0]) % _sizes[3]; j[2] = (ai)/(_sizes[0]) % _sizes[2]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d3, d1, d2, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_3124 : public Layout_4d {
+ public:
+  Layout_3124() { }
+  Layout_3124(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[0] * _sizes[1] * _sizes[3] + j[0] * _sizes[1] * _sizes[3] + j[1] * _sizes[3] + j[3];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[0] * _sizes[1] * _sizes[3]); j[0] = (ai)/(_sizes[1] * _sizes[3]) % _sizes[0]; j[1] = (ai)/(_sizes[3]) % _sizes[1]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d3, d1, d4, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_3142 : public Layout_4d {
+ public:
+  Layout_3142() { }
+  Layout_3142(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[0] * _sizes[3] * _sizes[1] + j[0] * _sizes[3] * _sizes[1] + j[3] * _sizes[1] + j[1];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[0] * _sizes[3] * _sizes[1]); j[0] = (ai)/(_sizes[3] * _sizes[1]) % _sizes[0]; j[3] = (ai)/(_sizes[1]) % _sizes[3]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d3, d2, d1, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_3214 : public Layout_4d {
+ public:
+  Layout_3214() { }
+  Layout_3214(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[1] * _sizes[0] * _sizes[3] + j[1] * _sizes[0] * _sizes[3] + j[0] * _sizes[3] + j[3];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[1] * _sizes[0] * _sizes[3]); j[1] = (ai)/(_sizes[0] * _sizes[3]) % _sizes[1]; j[0] = (ai)/(_sizes[3]) % _sizes[0]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d3, d2, d4, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_3241 : public Layout_4d {
+ public:
+  Layout_3241() { }
+  Layout_3241(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[1] * _sizes[3] * _sizes[0] + j[1] * _sizes[3] * _sizes[0] + j[3] * _sizes[0] + j[0];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[1] * _sizes[3] * _sizes[0]); j[1] = (ai)/(_sizes[3] * _sizes[0]) % _sizes[1]; j[3] = (ai)/(_sizes[0]) % _sizes[3]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d3, d4, d1, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_3412 : public Layout_4d {
+ public:
+  Layout_3412() { }
+  Layout_3412(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[3] * _sizes[0] * _sizes[1] + j[3] * _sizes[0] * _sizes[1] + j[0] * _sizes[1] + j[1];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[3] * _sizes[0] * _sizes[1]); j[3] = (ai)/(_sizes[0] * _sizes[1]) % _sizes[3]; j[0] = (ai)/(_sizes[1]) % _sizes[0]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d3, d4, d2, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_3421 : public Layout_4d {
+ public:
+  Layout_3421() { }
+  Layout_3421(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[3] * _sizes[1] * _sizes[0] + j[3] * _sizes[1] * _sizes[0] + j[1] * _sizes[0] + j[0];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[3] * _sizes[1] * _sizes[0]); j[3] = (ai)/(_sizes[1] * _sizes[0]) % _sizes[3]; j[1] = (ai)/(_sizes[0]) % _sizes[1]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d4, d1, d2, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_4123 : public Layout_4d {
+ public:
+  Layout_4123() { }
+  Layout_4123(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[0] * _sizes[1] * _sizes[2] + j[0] * _sizes[1] * _sizes[2] + j[1] * _sizes[2] + j[2];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[0] * _sizes[1] * _sizes[2]); j[0] = (ai)/(_sizes[1] * _sizes[2]) % _sizes[0]; j[1] = (ai)/(_sizes[2]) % _sizes[1]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d4, d1, d3, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_4132 : public Layout_4d {
+ public:
+  Layout_4132() { }
+  Layout_4132(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[0] * _sizes[2] * _sizes[1] + j[0] * _sizes[2] * _sizes[1] + j[2] * _sizes[1] + j[1];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[0] * _sizes[2] * _sizes[1]); j[0] = (ai)/(_sizes[2] * _sizes[1]) % _sizes[0]; j[2] = (ai)/(_sizes[1]) % _sizes[2]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d4, d2, d1, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_4213 : public Layout_4d {
+ public:
+  Layout_4213() { }
+  Layout_4213(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[1] * _sizes[0] * _sizes[2] + j[1] * _sizes[0] * _sizes[2] + j[0] * _sizes[2] + j[2];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[1] * _sizes[0] * _sizes[2]); j[1] = (ai)/(_sizes[0] * _sizes[2]) % _sizes[1]; j[0] = (ai)/(_sizes[2]) % _sizes[0]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d4, d2, d3, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_4231 : public Layout_4d {
+ public:
+  Layout_4231() { }
+  Layout_4231(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[1] * _sizes[2] * _sizes[0] + j[1] * _sizes[2] * _sizes[0] + j[2] * _sizes[0] + j[0];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[1] * _sizes[2] * _sizes[0]); j[1] = (ai)/(_sizes[2] * _sizes[0]) % _sizes[1]; j[2] = (ai)/(_sizes[0]) % _sizes[2]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d4, d3, d1, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_4312 : public Layout_4d {
+ public:
+  Layout_4312() { }
+  Layout_4312(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[2] * _sizes[0] * _sizes[1] + j[2] * _sizes[0] * _sizes[1] + j[0] * _sizes[1] + j[1];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[2] * _sizes[0] * _sizes[1]); j[2] = (ai)/(_sizes[0] * _sizes[1]) % _sizes[2]; j[0] = (ai)/(_sizes[1]) % _sizes[0]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 4-D <-> 1-D layout class with dimensions in d4, d3, d2, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_4321 : public Layout_4d {
+ public:
+  Layout_4321() { }
+  Layout_4321(const Indices& sizes) : Layout_4d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 4;
+  }
+
+  // Return 1-D offset from 4-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[2] * _sizes[1] * _sizes[0] + j[2] * _sizes[1] * _sizes[0] + j[1] * _sizes[0] + j[0];
+  }
+
+  // Return 4 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[2] * _sizes[1] * _sizes[0]); j[2] = (ai)/(_sizes[1] * _sizes[0]) % _sizes[2]; j[1] = (ai)/(_sizes[0]) % _sizes[1]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout base class.
+ class Layout_5d : public Layout {
+ public:
+  Layout_5d() : Layout(5) { }
+  Layout_5d(const Indices& sizes) : Layout(5, sizes) { }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d2, d3, d4, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_12345 : public Layout_5d {
+ public:
+  Layout_12345() { }
+  Layout_12345(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[1] * _sizes[2] * _sizes[3] * _sizes[4] + j[1] * _sizes[2] * _sizes[3] * _sizes[4] + j[2] * _sizes[3] * _sizes[4] + j[3] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[1] * _sizes[2] * _sizes[3] * _sizes[4]); j[1] = (ai)/(_sizes[2] * _sizes[3] * _sizes[4]) % _sizes[1]; j[2] = (ai)/(_sizes[3] * _sizes[4]) % _sizes[2]; j[3] = (ai)/(_sizes[4]) % _sizes[3]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d2, d3, d5, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_12354 : public Layout_5d {
+ public:
+  Layout_12354() { }
+  Layout_12354(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[1] * _sizes[2] * _sizes[4] * _sizes[3] + j[1] * _sizes[2] * _sizes[4] * _sizes[3] + j[2] * _sizes[4] * _sizes[3] + j[4] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[1] * _sizes[2] * _sizes[4] * _sizes[3]); j[1] = (ai)/(_sizes[2] * _sizes[4] * _sizes[3]) % _sizes[1]; j[2] = (ai)/(_sizes[4] * _sizes[3]) % _sizes[2]; j[4] = (ai)/(_sizes[3]) % _sizes[4]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d2, d4, d3, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_12435 : public Layout_5d {
+ public:
+  Layout_12435() { }
+  Layout_12435(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[1] * _sizes[3] * _sizes[2] * _sizes[4] + j[1] * _sizes[3] * _sizes[2] * _sizes[4] + j[3] * _sizes[2] * _sizes[4] + j[2] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[1] * _sizes[3] * _sizes[2] * _sizes[4]); j[1] = (ai)/(_sizes[3] * _sizes[2] * _sizes[4]) % _sizes[1]; j[3] = (ai)/(_sizes[2] * _sizes[4]) % _sizes[3]; j[2] = (ai)/(_sizes[4]) % _sizes[2]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d2, d4, d5, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_12453 : public Layout_5d {
+ public:
+  Layout_12453() { }
+  Layout_12453(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[1] * _sizes[3] * _sizes[4] * _sizes[2] + j[1] * _sizes[3] * _sizes[4] * _sizes[2] + j[3] * _sizes[4] * _sizes[2] + j[4] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[1] * _sizes[3] * _sizes[4] * _sizes[2]); j[1] = (ai)/(_sizes[3] * _sizes[4] * _sizes[2]) % _sizes[1]; j[3] = (ai)/(_sizes[4] * _sizes[2]) % _sizes[3]; j[4] = (ai)/(_sizes[2]) % _sizes[4]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d2, d5, d3, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_12534 : public Layout_5d {
+ public:
+  Layout_12534() { }
+  Layout_12534(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[1] * _sizes[4] * _sizes[2] * _sizes[3] + j[1] * _sizes[4] * _sizes[2] * _sizes[3] + j[4] * _sizes[2] * _sizes[3] + j[2] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[1] * _sizes[4] * _sizes[2] * _sizes[3]); j[1] = (ai)/(_sizes[4] * _sizes[2] * _sizes[3]) % _sizes[1]; j[4] = (ai)/(_sizes[2] * _sizes[3]) % _sizes[4]; j[2] = (ai)/(_sizes[3]) % _sizes[2]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d2, d5, d4, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_12543 : public Layout_5d {
+ public:
+  Layout_12543() { }
+  Layout_12543(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[1] * _sizes[4] * _sizes[3] * _sizes[2] + j[1] * _sizes[4] * _sizes[3] * _sizes[2] + j[4] * _sizes[3] * _sizes[2] + j[3] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[1] * _sizes[4] * _sizes[3] * _sizes[2]); j[1] = (ai)/(_sizes[4] * _sizes[3] * _sizes[2]) % _sizes[1]; j[4] = (ai)/(_sizes[3] * _sizes[2]) % _sizes[4]; j[3] = (ai)/(_sizes[2]) % _sizes[3]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d3, d2, d4, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_13245 : public Layout_5d {
+ public:
+  Layout_13245() { }
+  Layout_13245(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[2] * _sizes[1] * _sizes[3] * _sizes[4] + j[2] * _sizes[1] * _sizes[3] * _sizes[4] + j[1] * _sizes[3] * _sizes[4] + j[3] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[2] * _sizes[1] * _sizes[3] * _sizes[4]); j[2] = (ai)/(_sizes[1] * _sizes[3] * _sizes[4]) % _sizes[2]; j[1] = (ai)/(_sizes[3] * _sizes[4]) % _sizes[1]; j[3] = (ai)/(_sizes[4]) % _sizes[3]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d3, d2, d5, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_13254 : public Layout_5d {
+ public:
+  Layout_13254() { }
+  Layout_13254(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[2] * _sizes[1] * _sizes[4] * _sizes[3] + j[2] * _sizes[1] * _sizes[4] * _sizes[3] + j[1] * _sizes[4] * _sizes[3] + j[4] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[2] * _sizes[1] * _sizes[4] * _sizes[3]); j[2] = (ai)/(_sizes[1] * _sizes[4] * _sizes[3]) % _sizes[2]; j[1] = (ai)/(_sizes[4] * _sizes[3]) % _sizes[1]; j[4] = (ai)/(_sizes[3]) % _sizes[4]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d3, d4, d2, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_13425 : public Layout_5d {
+ public:
+  Layout_13425() { }
+  Layout_13425(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[2] * _sizes[3] * _sizes[1] * _sizes[4] + j[2] * _sizes[3] * _sizes[1] * _sizes[4] + j[3] * _sizes[1] * _sizes[4] + j[1] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[2] * _sizes[3] * _sizes[1] * _sizes[4]); j[2] = (ai)/(_sizes[3] * _sizes[1] * _sizes[4]) % _sizes[2]; j[3] = (ai)/(_sizes[1] * _sizes[4]) % _sizes[3]; j[1] = (ai)/(_sizes[4]) % _sizes[1]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d3, d4, d5, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_13452 : public Layout_5d {
+ public:
+  Layout_13452() { }
+  Layout_13452(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[2] * _sizes[3] * _sizes[4] * _sizes[1] + j[2] * _sizes[3] * _sizes[4] * _sizes[1] + j[3] * _sizes[4] * _sizes[1] + j[4] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[2] * _sizes[3] * _sizes[4] * _sizes[1]); j[2] = (ai)/(_sizes[3] * _sizes[4] * _sizes[1]) % _sizes[2]; j[3] = (ai)/(_sizes[4] * _sizes[1]) % _sizes[3]; j[4] = (ai)/(_sizes[1]) % _sizes[4]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d3, d5, d2, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_13524 : public Layout_5d {
+ public:
+  Layout_13524() { }
+  Layout_13524(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[2] * _sizes[4] * _sizes[1] * _sizes[3] + j[2] * _sizes[4] * _sizes[1] * _sizes[3] + j[4] * _sizes[1] * _sizes[3] + j[1] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[2] * _sizes[4] * _sizes[1] * _sizes[3]); j[2] = (ai)/(_sizes[4] * _sizes[1] * _sizes[3]) % _sizes[2]; j[4] = (ai)/(_sizes[1] * _sizes[3]) % _sizes[4]; j[1] = (ai)/(_sizes[3]) % _sizes[1]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d3, d5, d4, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_13542 : public Layout_5d {
+ public:
+  Layout_13542() { }
+  Layout_13542(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[2] * _sizes[4] * _sizes[3] * _sizes[1] + j[2] * _sizes[4] * _sizes[3] * _sizes[1] + j[4] * _sizes[3] * _sizes[1] + j[3] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[2] * _sizes[4] * _sizes[3] * _sizes[1]); j[2] = (ai)/(_sizes[4] * _sizes[3] * _sizes[1]) % _sizes[2]; j[4] = (ai)/(_sizes[3] * _sizes[1]) % _sizes[4]; j[3] = (ai)/(_sizes[1]) % _sizes[3]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d4, d2, d3, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_14235 : public Layout_5d {
+ public:
+  Layout_14235() { }
+  Layout_14235(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[3] * _sizes[1] * _sizes[2] * _sizes[4] + j[3] * _sizes[1] * _sizes[2] * _sizes[4] + j[1] * _sizes[2] * _sizes[4] + j[2] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[3] * _sizes[1] * _sizes[2] * _sizes[4]); j[3] = (ai)/(_sizes[1] * _sizes[2] * _sizes[4]) % _sizes[3]; j[1] = (ai)/(_sizes[2] * _sizes[4]) % _sizes[1]; j[2] = (ai)/(_sizes[4]) % _sizes[2]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d4, d2, d5, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_14253 : public Layout_5d {
+ public:
+  Layout_14253() { }
+  Layout_14253(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[3] * _sizes[1] * _sizes[4] * _sizes[2] + j[3] * _sizes[1] * _sizes[4] * _sizes[2] + j[1] * _sizes[4] * _sizes[2] + j[4] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[3] * _sizes[1] * _sizes[4] * _sizes[2]); j[3] = (ai)/(_sizes[1] * _sizes[4] * _sizes[2]) % _sizes[3]; j[1] = (ai)/(_sizes[4] * _sizes[2]) % _sizes[1]; j[4] = (ai)/(_sizes[2]) % _sizes[4]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d4, d3, d2, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_14325 : public Layout_5d {
+ public:
+  Layout_14325() { }
+  Layout_14325(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[3] * _sizes[2] * _sizes[1] * _sizes[4] + j[3] * _sizes[2] * _sizes[1] * _sizes[4] + j[2] * _sizes[1] * _sizes[4] + j[1] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[3] * _sizes[2] * _sizes[1] * _sizes[4]); j[3] = (ai)/(_sizes[2] * _sizes[1] * _sizes[4]) % _sizes[3]; j[2] = (ai)/(_sizes[1] * _sizes[4]) % _sizes[2]; j[1] = (ai)/(_sizes[4]) % _sizes[1]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d4, d3, d5, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_14352 : public Layout_5d {
+ public:
+  Layout_14352() { }
+  Layout_14352(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[3] * _sizes[2] * _sizes[4] * _sizes[1] + j[3] * _sizes[2] * _sizes[4] * _sizes[1] + j[2] * _sizes[4] * _sizes[1] + j[4] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[3] * _sizes[2] * _sizes[4] * _sizes[1]); j[3] = (ai)/(_sizes[2] * _sizes[4] * _sizes[1]) % _sizes[3]; j[2] = (ai)/(_sizes[4] * _sizes[1]) % _sizes[2]; j[4] = (ai)/(_sizes[1]) % _sizes[4]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d4, d5, d2, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_14523 : public Layout_5d {
+ public:
+  Layout_14523() { }
+  Layout_14523(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[3] * _sizes[4] * _sizes[1] * _sizes[2] + j[3] * _sizes[4] * _sizes[1] * _sizes[2] + j[4] * _sizes[1] * _sizes[2] + j[1] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[3] * _sizes[4] * _sizes[1] * _sizes[2]); j[3] = (ai)/(_sizes[4] * _sizes[1] * _sizes[2]) % _sizes[3]; j[4] = (ai)/(_sizes[1] * _sizes[2]) % _sizes[4]; j[1] = (ai)/(_sizes[2]) % _sizes[1]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d4, d5, d3, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_14532 : public Layout_5d {
+ public:
+  Layout_14532() { }
+  Layout_14532(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[3] * _sizes[4] * _sizes[2] * _sizes[1] + j[3] * _sizes[4] * _sizes[2] * _sizes[1] + j[4] * _sizes[2] * _sizes[1] + j[2] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[3] * _sizes[4] * _sizes[2] * _sizes[1]); j[3] = (ai)/(_sizes[4] * _sizes[2] * _sizes[1]) % _sizes[3]; j[4] = (ai)/(_sizes[2] * _sizes[1]) % _sizes[4]; j[2] = (ai)/(_sizes[1]) % _sizes[2]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d5, d2, d3, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_15234 : public Layout_5d {
+ public:
+  Layout_15234() { }
+  Layout_15234(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[4] * _sizes[1] * _sizes[2] * _sizes[3] + j[4] * _sizes[1] * _sizes[2] * _sizes[3] + j[1] * _sizes[2] * _sizes[3] + j[2] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[4] * _sizes[1] * _sizes[2] * _sizes[3]); j[4] = (ai)/(_sizes[1] * _sizes[2] * _sizes[3]) % _sizes[4]; j[1] = (ai)/(_sizes[2] * _sizes[3]) % _sizes[1]; j[2] = (ai)/(_sizes[3]) % _sizes[2]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d5, d2, d4, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_15243 : public Layout_5d {
+ public:
+  Layout_15243() { }
+  Layout_15243(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[4] * _sizes[1] * _sizes[3] * _sizes[2] + j[4] * _sizes[1] * _sizes[3] * _sizes[2] + j[1] * _sizes[3] * _sizes[2] + j[3] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[4] * _sizes[1] * _sizes[3] * _sizes[2]); j[4] = (ai)/(_sizes[1] * _sizes[3] * _sizes[2]) % _sizes[4]; j[1] = (ai)/(_sizes[3] * _sizes[2]) % _sizes[1]; j[3] = (ai)/(_sizes[2]) % _sizes[3]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d5, d3, d2, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_15324 : public Layout_5d {
+ public:
+  Layout_15324() { }
+  Layout_15324(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[4] * _sizes[2] * _sizes[1] * _sizes[3] + j[4] * _sizes[2] * _sizes[1] * _sizes[3] + j[2] * _sizes[1] * _sizes[3] + j[1] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[4] * _sizes[2] * _sizes[1] * _sizes[3]); j[4] = (ai)/(_sizes[2] * _sizes[1] * _sizes[3]) % _sizes[4]; j[2] = (ai)/(_sizes[1] * _sizes[3]) % _sizes[2]; j[1] = (ai)/(_sizes[3]) % _sizes[1]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d5, d3, d4, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_15342 : public Layout_5d {
+ public:
+  Layout_15342() { }
+  Layout_15342(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[4] * _sizes[2] * _sizes[3] * _sizes[1] + j[4] * _sizes[2] * _sizes[3] * _sizes[1] + j[2] * _sizes[3] * _sizes[1] + j[3] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[4] * _sizes[2] * _sizes[3] * _sizes[1]); j[4] = (ai)/(_sizes[2] * _sizes[3] * _sizes[1]) % _sizes[4]; j[2] = (ai)/(_sizes[3] * _sizes[1]) % _sizes[2]; j[3] = (ai)/(_sizes[1]) % _sizes[3]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d5, d4, d2, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_15423 : public Layout_5d {
+ public:
+  Layout_15423() { }
+  Layout_15423(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[4] * _sizes[3] * _sizes[1] * _sizes[2] + j[4] * _sizes[3] * _sizes[1] * _sizes[2] + j[3] * _sizes[1] * _sizes[2] + j[1] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[4] * _sizes[3] * _sizes[1] * _sizes[2]); j[4] = (ai)/(_sizes[3] * _sizes[1] * _sizes[2]) % _sizes[4]; j[3] = (ai)/(_sizes[1] * _sizes[2]) % _sizes[3]; j[1] = (ai)/(_sizes[2]) % _sizes[1]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d1, d5, d4, d3, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_15432 : public Layout_5d {
+ public:
+  Layout_15432() { }
+  Layout_15432(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[0] * _sizes[4] * _sizes[3] * _sizes[2] * _sizes[1] + j[4] * _sizes[3] * _sizes[2] * _sizes[1] + j[3] * _sizes[2] * _sizes[1] + j[2] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[0] = (ai)/(_sizes[4] * _sizes[3] * _sizes[2] * _sizes[1]); j[4] = (ai)/(_sizes[3] * _sizes[2] * _sizes[1]) % _sizes[4]; j[3] = (ai)/(_sizes[2] * _sizes[1]) % _sizes[3]; j[2] = (ai)/(_sizes[1]) % _sizes[2]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d1, d3, d4, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_21345 : public Layout_5d {
+ public:
+  Layout_21345() { }
+  Layout_21345(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[0] * _sizes[2] * _sizes[3] * _sizes[4] + j[0] * _sizes[2] * _sizes[3] * _sizes[4] + j[2] * _sizes[3] * _sizes[4] + j[3] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[0] * _sizes[2] * _sizes[3] * _sizes[4]); j[0] = (ai)/(_sizes[2] * _sizes[3] * _sizes[4]) % _sizes[0]; j[2] = (ai)/(_sizes[3] * _sizes[4]) % _sizes[2]; j[3] = (ai)/(_sizes[4]) % _sizes[3]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d1, d3, d5, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_21354 : public Layout_5d {
+ public:
+  Layout_21354() { }
+  Layout_21354(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[0] * _sizes[2] * _sizes[4] * _sizes[3] + j[0] * _sizes[2] * _sizes[4] * _sizes[3] + j[2] * _sizes[4] * _sizes[3] + j[4] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[0] * _sizes[2] * _sizes[4] * _sizes[3]); j[0] = (ai)/(_sizes[2] * _sizes[4] * _sizes[3]) % _sizes[0]; j[2] = (ai)/(_sizes[4] * _sizes[3]) % _sizes[2]; j[4] = (ai)/(_sizes[3]) % _sizes[4]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d1, d4, d3, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_21435 : public Layout_5d {
+ public:
+  Layout_21435() { }
+  Layout_21435(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[0] * _sizes[3] * _sizes[2] * _sizes[4] + j[0] * _sizes[3] * _sizes[2] * _sizes[4] + j[3] * _sizes[2] * _sizes[4] + j[2] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[0] * _sizes[3] * _sizes[2] * _sizes[4]); j[0] = (ai)/(_sizes[3] * _sizes[2] * _sizes[4]) % _sizes[0]; j[3] = (ai)/(_sizes[2] * _sizes[4]) % _sizes[3]; j[2] = (ai)/(_sizes[4]) % _sizes[2]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d1, d4, d5, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_21453 : public Layout_5d {
+ public:
+  Layout_21453() { }
+  Layout_21453(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[0] * _sizes[3] * _sizes[4] * _sizes[2] + j[0] * _sizes[3] * _sizes[4] * _sizes[2] + j[3] * _sizes[4] * _sizes[2] + j[4] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[0] * _sizes[3] * _sizes[4] * _sizes[2]); j[0] = (ai)/(_sizes[3] * _sizes[4] * _sizes[2]) % _sizes[0]; j[3] = (ai)/(_sizes[4] * _sizes[2]) % _sizes[3]; j[4] = (ai)/(_sizes[2]) % _sizes[4]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d1, d5, d3, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_21534 : public Layout_5d {
+ public:
+  Layout_21534() { }
+  Layout_21534(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[0] * _sizes[4] * _sizes[2] * _sizes[3] + j[0] * _sizes[4] * _sizes[2] * _sizes[3] + j[4] * _sizes[2] * _sizes[3] + j[2] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[0] * _sizes[4] * _sizes[2] * _sizes[3]); j[0] = (ai)/(_sizes[4] * _sizes[2] * _sizes[3]) % _sizes[0]; j[4] = (ai)/(_sizes[2] * _sizes[3]) % _sizes[4]; j[2] = (ai)/(_sizes[3]) % _sizes[2]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d1, d5, d4, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_21543 : public Layout_5d {
+ public:
+  Layout_21543() { }
+  Layout_21543(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[0] * _sizes[4] * _sizes[3] * _sizes[2] + j[0] * _sizes[4] * _sizes[3] * _sizes[2] + j[4] * _sizes[3] * _sizes[2] + j[3] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[0] * _sizes[4] * _sizes[3] * _sizes[2]); j[0] = (ai)/(_sizes[4] * _sizes[3] * _sizes[2]) % _sizes[0]; j[4] = (ai)/(_sizes[3] * _sizes[2]) % _sizes[4]; j[3] = (ai)/(_sizes[2]) % _sizes[3]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d3, d1, d4, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_23145 : public Layout_5d {
+ public:
+  Layout_23145() { }
+  Layout_23145(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[2] * _sizes[0] * _sizes[3] * _sizes[4] + j[2] * _sizes[0] * _sizes[3] * _sizes[4] + j[0] * _sizes[3] * _sizes[4] + j[3] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[2] * _sizes[0] * _sizes[3] * _sizes[4]); j[2] = (ai)/(_sizes[0] * _sizes[3] * _sizes[4]) % _sizes[2]; j[0] = (ai)/(_sizes[3] * _sizes[4]) % _sizes[0]; j[3] = (ai)/(_sizes[4]) % _sizes[3]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d3, d1, d5, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_23154 : public Layout_5d {
+ public:
+  Layout_23154() { }
+  Layout_23154(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[2] * _sizes[0] * _sizes[4] * _sizes[3] + j[2] * _sizes[0] * _sizes[4] * _sizes[3] + j[0] * _sizes[4] * _sizes[3] + j[4] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[2] * _sizes[0] * _sizes[4] * _sizes[3]); j[2] = (ai)/(_sizes[0] * _sizes[4] * _sizes[3]) % _sizes[2]; j[0] = (ai)/(_sizes[4] * _sizes[3]) % _sizes[0]; j[4] = (ai)/(_sizes[3]) % _sizes[4]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d3, d4, d1, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_23415 : public Layout_5d {
+ public:
+  Layout_23415() { }
+  Layout_23415(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[2] * _sizes[3] * _sizes[0] * _sizes[4] + j[2] * _sizes[3] * _sizes[0] * _sizes[4] + j[3] * _sizes[0] * _sizes[4] + j[0] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[2] * _sizes[3] * _sizes[0] * _sizes[4]); j[2] = (ai)/(_sizes[3] * _sizes[0] * _sizes[4]) % _sizes[2]; j[3] = (ai)/(_sizes[0] * _sizes[4]) % _sizes[3]; j[0] = (ai)/(_sizes[4]) % _sizes[0]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d3, d4, d5, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_23451 : public Layout_5d {
+ public:
+  Layout_23451() { }
+  Layout_23451(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[2] * _sizes[3] * _sizes[4] * _sizes[0] + j[2] * _sizes[3] * _sizes[4] * _sizes[0] + j[3] * _sizes[4] * _sizes[0] + j[4] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[2] * _sizes[3] * _sizes[4] * _sizes[0]); j[2] = (ai)/(_sizes[3] * _sizes[4] * _sizes[0]) % _sizes[2]; j[3] = (ai)/(_sizes[4] * _sizes[0]) % _sizes[3]; j[4] = (ai)/(_sizes[0]) % _sizes[4]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d3, d5, d1, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_23514 : public Layout_5d {
+ public:
+  Layout_23514() { }
+  Layout_23514(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[2] * _sizes[4] * _sizes[0] * _sizes[3] + j[2] * _sizes[4] * _sizes[0] * _sizes[3] + j[4] * _sizes[0] * _sizes[3] + j[0] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[2] * _sizes[4] * _sizes[0] * _sizes[3]); j[2] = (ai)/(_sizes[4] * _sizes[0] * _sizes[3]) % _sizes[2]; j[4] = (ai)/(_sizes[0] * _sizes[3]) % _sizes[4]; j[0] = (ai)/(_sizes[3]) % _sizes[0]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d3, d5, d4, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_23541 : public Layout_5d {
+ public:
+  Layout_23541() { }
+  Layout_23541(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[2] * _sizes[4] * _sizes[3] * _sizes[0] + j[2] * _sizes[4] * _sizes[3] * _sizes[0] + j[4] * _sizes[3] * _sizes[0] + j[3] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[2] * _sizes[4] * _sizes[3] * _sizes[0]); j[2] = (ai)/(_sizes[4] * _sizes[3] * _sizes[0]) % _sizes[2]; j[4] = (ai)/(_sizes[3] * _sizes[0]) % _sizes[4]; j[3] = (ai)/(_sizes[0]) % _sizes[3]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d4, d1, d3, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_24135 : public Layout_5d {
+ public:
+  Layout_24135() { }
+  Layout_24135(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[3] * _sizes[0] * _sizes[2] * _sizes[4] + j[3] * _sizes[0] * _sizes[2] * _sizes[4] + j[0] * _sizes[2] * _sizes[4] + j[2] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[3] * _sizes[0] * _sizes[2] * _sizes[4]); j[3] = (ai)/(_sizes[0] * _sizes[2] * _sizes[4]) % _sizes[3]; j[0] = (ai)/(_sizes[2] * _sizes[4]) % _sizes[0]; j[2] = (ai)/(_sizes[4]) % _sizes[2]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d4, d1, d5, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_24153 : public Layout_5d {
+ public:
+  Layout_24153() { }
+  Layout_24153(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[3] * _sizes[0] * _sizes[4] * _sizes[2] + j[3] * _sizes[0] * _sizes[4] * _sizes[2] + j[0] * _sizes[4] * _sizes[2] + j[4] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[3] * _sizes[0] * _sizes[4] * _sizes[2]); j[3] = (ai)/(_sizes[0] * _sizes[4] * _sizes[2]) % _sizes[3]; j[0] = (ai)/(_sizes[4] * _sizes[2]) % _sizes[0]; j[4] = (ai)/(_sizes[2]) % _sizes[4]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d4, d3, d1, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_24315 : public Layout_5d {
+ public:
+  Layout_24315() { }
+  Layout_24315(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[3] * _sizes[2] * _sizes[0] * _sizes[4] + j[3] * _sizes[2] * _sizes[0] * _sizes[4] + j[2] * _sizes[0] * _sizes[4] + j[0] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[3] * _sizes[2] * _sizes[0] * _sizes[4]); j[3] = (ai)/(_sizes[2] * _sizes[0] * _sizes[4]) % _sizes[3]; j[2] = (ai)/(_sizes[0] * _sizes[4]) % _sizes[2]; j[0] = (ai)/(_sizes[4]) % _sizes[0]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d4, d3, d5, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_24351 : public Layout_5d {
+ public:
+  Layout_24351() { }
+  Layout_24351(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[3] * _sizes[2] * _sizes[4] * _sizes[0] + j[3] * _sizes[2] * _sizes[4] * _sizes[0] + j[2] * _sizes[4] * _sizes[0] + j[4] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[3] * _sizes[2] * _sizes[4] * _sizes[0]); j[3] = (ai)/(_sizes[2] * _sizes[4] * _sizes[0]) % _sizes[3]; j[2] = (ai)/(_sizes[4] * _sizes[0]) % _sizes[2]; j[4] = (ai)/(_sizes[0]) % _sizes[4]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d4, d5, d1, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_24513 : public Layout_5d {
+ public:
+  Layout_24513() { }
+  Layout_24513(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[3] * _sizes[4] * _sizes[0] * _sizes[2] + j[3] * _sizes[4] * _sizes[0] * _sizes[2] + j[4] * _sizes[0] * _sizes[2] + j[0] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[3] * _sizes[4] * _sizes[0] * _sizes[2]); j[3] = (ai)/(_sizes[4] * _sizes[0] * _sizes[2]) % _sizes[3]; j[4] = (ai)/(_sizes[0] * _sizes[2]) % _sizes[4]; j[0] = (ai)/(_sizes[2]) % _sizes[0]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d4, d5, d3, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_24531 : public Layout_5d {
+ public:
+  Layout_24531() { }
+  Layout_24531(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[3] * _sizes[4] * _sizes[2] * _sizes[0] + j[3] * _sizes[4] * _sizes[2] * _sizes[0] + j[4] * _sizes[2] * _sizes[0] + j[2] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[3] * _sizes[4] * _sizes[2] * _sizes[0]); j[3] = (ai)/(_sizes[4] * _sizes[2] * _sizes[0]) % _sizes[3]; j[4] = (ai)/(_sizes[2] * _sizes[0]) % _sizes[4]; j[2] = (ai)/(_sizes[0]) % _sizes[2]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d5, d1, d3, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_25134 : public Layout_5d {
+ public:
+  Layout_25134() { }
+  Layout_25134(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[4] * _sizes[0] * _sizes[2] * _sizes[3] + j[4] * _sizes[0] * _sizes[2] * _sizes[3] + j[0] * _sizes[2] * _sizes[3] + j[2] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[4] * _sizes[0] * _sizes[2] * _sizes[3]); j[4] = (ai)/(_sizes[0] * _sizes[2] * _sizes[3]) % _sizes[4]; j[0] = (ai)/(_sizes[2] * _sizes[3]) % _sizes[0]; j[2] = (ai)/(_sizes[3]) % _sizes[2]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d5, d1, d4, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_25143 : public Layout_5d {
+ public:
+  Layout_25143() { }
+  Layout_25143(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[4] * _sizes[0] * _sizes[3] * _sizes[2] + j[4] * _sizes[0] * _sizes[3] * _sizes[2] + j[0] * _sizes[3] * _sizes[2] + j[3] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[4] * _sizes[0] * _sizes[3] * _sizes[2]); j[4] = (ai)/(_sizes[0] * _sizes[3] * _sizes[2]) % _sizes[4]; j[0] = (ai)/(_sizes[3] * _sizes[2]) % _sizes[0]; j[3] = (ai)/(_sizes[2]) % _sizes[3]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d5, d3, d1, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_25314 : public Layout_5d {
+ public:
+  Layout_25314() { }
+  Layout_25314(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[4] * _sizes[2] * _sizes[0] * _sizes[3] + j[4] * _sizes[2] * _sizes[0] * _sizes[3] + j[2] * _sizes[0] * _sizes[3] + j[0] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[4] * _sizes[2] * _sizes[0] * _sizes[3]); j[4] = (ai)/(_sizes[2] * _sizes[0] * _sizes[3]) % _sizes[4]; j[2] = (ai)/(_sizes[0] * _sizes[3]) % _sizes[2]; j[0] = (ai)/(_sizes[3]) % _sizes[0]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d5, d3, d4, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_25341 : public Layout_5d {
+ public:
+  Layout_25341() { }
+  Layout_25341(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[4] * _sizes[2] * _sizes[3] * _sizes[0] + j[4] * _sizes[2] * _sizes[3] * _sizes[0] + j[2] * _sizes[3] * _sizes[0] + j[3] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[4] * _sizes[2] * _sizes[3] * _sizes[0]); j[4] = (ai)/(_sizes[2] * _sizes[3] * _sizes[0]) % _sizes[4]; j[2] = (ai)/(_sizes[3] * _sizes[0]) % _sizes[2]; j[3] = (ai)/(_sizes[0]) % _sizes[3]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d5, d4, d1, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_25413 : public Layout_5d {
+ public:
+  Layout_25413() { }
+  Layout_25413(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[4] * _sizes[3] * _sizes[0] * _sizes[2] + j[4] * _sizes[3] * _sizes[0] * _sizes[2] + j[3] * _sizes[0] * _sizes[2] + j[0] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[4] * _sizes[3] * _sizes[0] * _sizes[2]); j[4] = (ai)/(_sizes[3] * _sizes[0] * _sizes[2]) % _sizes[4]; j[3] = (ai)/(_sizes[0] * _sizes[2]) % _sizes[3]; j[0] = (ai)/(_sizes[2]) % _sizes[0]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d2, d5, d4, d3, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_25431 : public Layout_5d {
+ public:
+  Layout_25431() { }
+  Layout_25431(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[1] * _sizes[4] * _sizes[3] * _sizes[2] * _sizes[0] + j[4] * _sizes[3] * _sizes[2] * _sizes[0] + j[3] * _sizes[2] * _sizes[0] + j[2] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[1] = (ai)/(_sizes[4] * _sizes[3] * _sizes[2] * _sizes[0]); j[4] = (ai)/(_sizes[3] * _sizes[2] * _sizes[0]) % _sizes[4]; j[3] = (ai)/(_sizes[2] * _sizes[0]) % _sizes[3]; j[2] = (ai)/(_sizes[0]) % _sizes[2]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d1, d2, d4, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_31245 : public Layout_5d {
+ public:
+  Layout_31245() { }
+  Layout_31245(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[0] * _sizes[1] * _sizes[3] * _sizes[4] + j[0] * _sizes[1] * _sizes[3] * _sizes[4] + j[1] * _sizes[3] * _sizes[4] + j[3] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[0] * _sizes[1] * _sizes[3] * _sizes[4]); j[0] = (ai)/(_sizes[1] * _sizes[3] * _sizes[4]) % _sizes[0]; j[1] = (ai)/(_sizes[3] * _sizes[4]) % _sizes[1]; j[3] = (ai)/(_sizes[4]) % _sizes[3]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d1, d2, d5, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_31254 : public Layout_5d {
+ public:
+  Layout_31254() { }
+  Layout_31254(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[0] * _sizes[1] * _sizes[4] * _sizes[3] + j[0] * _sizes[1] * _sizes[4] * _sizes[3] + j[1] * _sizes[4] * _sizes[3] + j[4] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[0] * _sizes[1] * _sizes[4] * _sizes[3]); j[0] = (ai)/(_sizes[1] * _sizes[4] * _sizes[3]) % _sizes[0]; j[1] = (ai)/(_sizes[4] * _sizes[3]) % _sizes[1]; j[4] = (ai)/(_sizes[3]) % _sizes[4]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d1, d4, d2, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_31425 : public Layout_5d {
+ public:
+  Layout_31425() { }
+  Layout_31425(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[0] * _sizes[3] * _sizes[1] * _sizes[4] + j[0] * _sizes[3] * _sizes[1] * _sizes[4] + j[3] * _sizes[1] * _sizes[4] + j[1] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[0] * _sizes[3] * _sizes[1] * _sizes[4]); j[0] = (ai)/(_sizes[3] * _sizes[1] * _sizes[4]) % _sizes[0]; j[3] = (ai)/(_sizes[1] * _sizes[4]) % _sizes[3]; j[1] = (ai)/(_sizes[4]) % _sizes[1]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d1, d4, d5, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_31452 : public Layout_5d {
+ public:
+  Layout_31452() { }
+  Layout_31452(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[0] * _sizes[3] * _sizes[4] * _sizes[1] + j[0] * _sizes[3] * _sizes[4] * _sizes[1] + j[3] * _sizes[4] * _sizes[1] + j[4] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[0] * _sizes[3] * _sizes[4] * _sizes[1]); j[0] = (ai)/(_sizes[3] * _sizes[4] * _sizes[1]) % _sizes[0]; j[3] = (ai)/(_sizes[4] * _sizes[1]) % _sizes[3]; j[4] = (ai)/(_sizes[1]) % _sizes[4]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d1, d5, d2, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_31524 : public Layout_5d {
+ public:
+  Layout_31524() { }
+  Layout_31524(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[0] * _sizes[4] * _sizes[1] * _sizes[3] + j[0] * _sizes[4] * _sizes[1] * _sizes[3] + j[4] * _sizes[1] * _sizes[3] + j[1] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[0] * _sizes[4] * _sizes[1] * _sizes[3]); j[0] = (ai)/(_sizes[4] * _sizes[1] * _sizes[3]) % _sizes[0]; j[4] = (ai)/(_sizes[1] * _sizes[3]) % _sizes[4]; j[1] = (ai)/(_sizes[3]) % _sizes[1]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d1, d5, d4, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_31542 : public Layout_5d {
+ public:
+  Layout_31542() { }
+  Layout_31542(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[0] * _sizes[4] * _sizes[3] * _sizes[1] + j[0] * _sizes[4] * _sizes[3] * _sizes[1] + j[4] * _sizes[3] * _sizes[1] + j[3] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[0] * _sizes[4] * _sizes[3] * _sizes[1]); j[0] = (ai)/(_sizes[4] * _sizes[3] * _sizes[1]) % _sizes[0]; j[4] = (ai)/(_sizes[3] * _sizes[1]) % _sizes[4]; j[3] = (ai)/(_sizes[1]) % _sizes[3]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d2, d1, d4, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_32145 : public Layout_5d {
+ public:
+  Layout_32145() { }
+  Layout_32145(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[1] * _sizes[0] * _sizes[3] * _sizes[4] + j[1] * _sizes[0] * _sizes[3] * _sizes[4] + j[0] * _sizes[3] * _sizes[4] + j[3] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[1] * _sizes[0] * _sizes[3] * _sizes[4]); j[1] = (ai)/(_sizes[0] * _sizes[3] * _sizes[4]) % _sizes[1]; j[0] = (ai)/(_sizes[3] * _sizes[4]) % _sizes[0]; j[3] = (ai)/(_sizes[4]) % _sizes[3]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d2, d1, d5, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_32154 : public Layout_5d {
+ public:
+  Layout_32154() { }
+  Layout_32154(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[1] * _sizes[0] * _sizes[4] * _sizes[3] + j[1] * _sizes[0] * _sizes[4] * _sizes[3] + j[0] * _sizes[4] * _sizes[3] + j[4] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[1] * _sizes[0] * _sizes[4] * _sizes[3]); j[1] = (ai)/(_sizes[0] * _sizes[4] * _sizes[3]) % _sizes[1]; j[0] = (ai)/(_sizes[4] * _sizes[3]) % _sizes[0]; j[4] = (ai)/(_sizes[3]) % _sizes[4]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d2, d4, d1, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_32415 : public Layout_5d {
+ public:
+  Layout_32415() { }
+  Layout_32415(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[1] * _sizes[3] * _sizes[0] * _sizes[4] + j[1] * _sizes[3] * _sizes[0] * _sizes[4] + j[3] * _sizes[0] * _sizes[4] + j[0] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[1] * _sizes[3] * _sizes[0] * _sizes[4]); j[1] = (ai)/(_sizes[3] * _sizes[0] * _sizes[4]) % _sizes[1]; j[3] = (ai)/(_sizes[0] * _sizes[4]) % _sizes[3]; j[0] = (ai)/(_sizes[4]) % _sizes[0]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d2, d4, d5, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_32451 : public Layout_5d {
+ public:
+  Layout_32451() { }
+  Layout_32451(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[1] * _sizes[3] * _sizes[4] * _sizes[0] + j[1] * _sizes[3] * _sizes[4] * _sizes[0] + j[3] * _sizes[4] * _sizes[0] + j[4] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[1] * _sizes[3] * _sizes[4] * _sizes[0]); j[1] = (ai)/(_sizes[3] * _sizes[4] * _sizes[0]) % _sizes[1]; j[3] = (ai)/(_sizes[4] * _sizes[0]) % _sizes[3]; j[4] = (ai)/(_sizes[0]) % _sizes[4]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d2, d5, d1, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_32514 : public Layout_5d {
+ public:
+  Layout_32514() { }
+  Layout_32514(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[1] * _sizes[4] * _sizes[0] * _sizes[3] + j[1] * _sizes[4] * _sizes[0] * _sizes[3] + j[4] * _sizes[0] * _sizes[3] + j[0] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[1] * _sizes[4] * _sizes[0] * _sizes[3]); j[1] = (ai)/(_sizes[4] * _sizes[0] * _sizes[3]) % _sizes[1]; j[4] = (ai)/(_sizes[0] * _sizes[3]) % _sizes[4]; j[0] = (ai)/(_sizes[3]) % _sizes[0]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d2, d5, d4, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_32541 : public Layout_5d {
+ public:
+  Layout_32541() { }
+  Layout_32541(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[1] * _sizes[4] * _sizes[3] * _sizes[0] + j[1] * _sizes[4] * _sizes[3] * _sizes[0] + j[4] * _sizes[3] * _sizes[0] + j[3] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[1] * _sizes[4] * _sizes[3] * _sizes[0]); j[1] = (ai)/(_sizes[4] * _sizes[3] * _sizes[0]) % _sizes[1]; j[4] = (ai)/(_sizes[3] * _sizes[0]) % _sizes[4]; j[3] = (ai)/(_sizes[0]) % _sizes[3]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d4, d1, d2, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_34125 : public Layout_5d {
+ public:
+  Layout_34125() { }
+  Layout_34125(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[3] * _sizes[0] * _sizes[1] * _sizes[4] + j[3] * _sizes[0] * _sizes[1] * _sizes[4] + j[0] * _sizes[1] * _sizes[4] + j[1] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[3] * _sizes[0] * _sizes[1] * _sizes[4]); j[3] = (ai)/(_sizes[0] * _sizes[1] * _sizes[4]) % _sizes[3]; j[0] = (ai)/(_sizes[1] * _sizes[4]) % _sizes[0]; j[1] = (ai)/(_sizes[4]) % _sizes[1]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d4, d1, d5, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_34152 : public Layout_5d {
+ public:
+  Layout_34152() { }
+  Layout_34152(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[3] * _sizes[0] * _sizes[4] * _sizes[1] + j[3] * _sizes[0] * _sizes[4] * _sizes[1] + j[0] * _sizes[4] * _sizes[1] + j[4] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[3] * _sizes[0] * _sizes[4] * _sizes[1]); j[3] = (ai)/(_sizes[0] * _sizes[4] * _sizes[1]) % _sizes[3]; j[0] = (ai)/(_sizes[4] * _sizes[1]) % _sizes[0]; j[4] = (ai)/(_sizes[1]) % _sizes[4]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d4, d2, d1, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_34215 : public Layout_5d {
+ public:
+  Layout_34215() { }
+  Layout_34215(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[3] * _sizes[1] * _sizes[0] * _sizes[4] + j[3] * _sizes[1] * _sizes[0] * _sizes[4] + j[1] * _sizes[0] * _sizes[4] + j[0] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[3] * _sizes[1] * _sizes[0] * _sizes[4]); j[3] = (ai)/(_sizes[1] * _sizes[0] * _sizes[4]) % _sizes[3]; j[1] = (ai)/(_sizes[0] * _sizes[4]) % _sizes[1]; j[0] = (ai)/(_sizes[4]) % _sizes[0]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d4, d2, d5, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_34251 : public Layout_5d {
+ public:
+  Layout_34251() { }
+  Layout_34251(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[3] * _sizes[1] * _sizes[4] * _sizes[0] + j[3] * _sizes[1] * _sizes[4] * _sizes[0] + j[1] * _sizes[4] * _sizes[0] + j[4] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[3] * _sizes[1] * _sizes[4] * _sizes[0]); j[3] = (ai)/(_sizes[1] * _sizes[4] * _sizes[0]) % _sizes[3]; j[1] = (ai)/(_sizes[4] * _sizes[0]) % _sizes[1]; j[4] = (ai)/(_sizes[0]) % _sizes[4]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d4, d5, d1, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_34512 : public Layout_5d {
+ public:
+  Layout_34512() { }
+  Layout_34512(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[3] * _sizes[4] * _sizes[0] * _sizes[1] + j[3] * _sizes[4] * _sizes[0] * _sizes[1] + j[4] * _sizes[0] * _sizes[1] + j[0] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[3] * _sizes[4] * _sizes[0] * _sizes[1]); j[3] = (ai)/(_sizes[4] * _sizes[0] * _sizes[1]) % _sizes[3]; j[4] = (ai)/(_sizes[0] * _sizes[1]) % _sizes[4]; j[0] = (ai)/(_sizes[1]) % _sizes[0]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d4, d5, d2, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_34521 : public Layout_5d {
+ public:
+  Layout_34521() { }
+  Layout_34521(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[3] * _sizes[4] * _sizes[1] * _sizes[0] + j[3] * _sizes[4] * _sizes[1] * _sizes[0] + j[4] * _sizes[1] * _sizes[0] + j[1] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[3] * _sizes[4] * _sizes[1] * _sizes[0]); j[3] = (ai)/(_sizes[4] * _sizes[1] * _sizes[0]) % _sizes[3]; j[4] = (ai)/(_sizes[1] * _sizes[0]) % _sizes[4]; j[1] = (ai)/(_sizes[0]) % _sizes[1]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d5, d1, d2, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_35124 : public Layout_5d {
+ public:
+  Layout_35124() { }
+  Layout_35124(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[4] * _sizes[0] * _sizes[1] * _sizes[3] + j[4] * _sizes[0] * _sizes[1] * _sizes[3] + j[0] * _sizes[1] * _sizes[3] + j[1] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[4] * _sizes[0] * _sizes[1] * _sizes[3]); j[4] = (ai)/(_sizes[0] * _sizes[1] * _sizes[3]) % _sizes[4]; j[0] = (ai)/(_sizes[1] * _sizes[3]) % _sizes[0]; j[1] = (ai)/(_sizes[3]) % _sizes[1]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d5, d1, d4, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_35142 : public Layout_5d {
+ public:
+  Layout_35142() { }
+  Layout_35142(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[4] * _sizes[0] * _sizes[3] * _sizes[1] + j[4] * _sizes[0] * _sizes[3] * _sizes[1] + j[0] * _sizes[3] * _sizes[1] + j[3] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[4] * _sizes[0] * _sizes[3] * _sizes[1]); j[4] = (ai)/(_sizes[0] * _sizes[3] * _sizes[1]) % _sizes[4]; j[0] = (ai)/(_sizes[3] * _sizes[1]) % _sizes[0]; j[3] = (ai)/(_sizes[1]) % _sizes[3]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d5, d2, d1, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_35214 : public Layout_5d {
+ public:
+  Layout_35214() { }
+  Layout_35214(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[4] * _sizes[1] * _sizes[0] * _sizes[3] + j[4] * _sizes[1] * _sizes[0] * _sizes[3] + j[1] * _sizes[0] * _sizes[3] + j[0] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[4] * _sizes[1] * _sizes[0] * _sizes[3]); j[4] = (ai)/(_sizes[1] * _sizes[0] * _sizes[3]) % _sizes[4]; j[1] = (ai)/(_sizes[0] * _sizes[3]) % _sizes[1]; j[0] = (ai)/(_sizes[3]) % _sizes[0]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d5, d2, d4, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_35241 : public Layout_5d {
+ public:
+  Layout_35241() { }
+  Layout_35241(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[4] * _sizes[1] * _sizes[3] * _sizes[0] + j[4] * _sizes[1] * _sizes[3] * _sizes[0] + j[1] * _sizes[3] * _sizes[0] + j[3] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[4] * _sizes[1] * _sizes[3] * _sizes[0]); j[4] = (ai)/(_sizes[1] * _sizes[3] * _sizes[0]) % _sizes[4]; j[1] = (ai)/(_sizes[3] * _sizes[0]) % _sizes[1]; j[3] = (ai)/(_sizes[0]) % _sizes[3]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d5, d4, d1, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_35412 : public Layout_5d {
+ public:
+  Layout_35412() { }
+  Layout_35412(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[4] * _sizes[3] * _sizes[0] * _sizes[1] + j[4] * _sizes[3] * _sizes[0] * _sizes[1] + j[3] * _sizes[0] * _sizes[1] + j[0] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[4] * _sizes[3] * _sizes[0] * _sizes[1]); j[4] = (ai)/(_sizes[3] * _sizes[0] * _sizes[1]) % _sizes[4]; j[3] = (ai)/(_sizes[0] * _sizes[1]) % _sizes[3]; j[0] = (ai)/(_sizes[1]) % _sizes[0]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d3, d5, d4, d2, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_35421 : public Layout_5d {
+ public:
+  Layout_35421() { }
+  Layout_35421(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[2] * _sizes[4] * _sizes[3] * _sizes[1] * _sizes[0] + j[4] * _sizes[3] * _sizes[1] * _sizes[0] + j[3] * _sizes[1] * _sizes[0] + j[1] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[2] = (ai)/(_sizes[4] * _sizes[3] * _sizes[1] * _sizes[0]); j[4] = (ai)/(_sizes[3] * _sizes[1] * _sizes[0]) % _sizes[4]; j[3] = (ai)/(_sizes[1] * _sizes[0]) % _sizes[3]; j[1] = (ai)/(_sizes[0]) % _sizes[1]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d1, d2, d3, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_41235 : public Layout_5d {
+ public:
+  Layout_41235() { }
+  Layout_41235(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[0] * _sizes[1] * _sizes[2] * _sizes[4] + j[0] * _sizes[1] * _sizes[2] * _sizes[4] + j[1] * _sizes[2] * _sizes[4] + j[2] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[0] * _sizes[1] * _sizes[2] * _sizes[4]); j[0] = (ai)/(_sizes[1] * _sizes[2] * _sizes[4]) % _sizes[0]; j[1] = (ai)/(_sizes[2] * _sizes[4]) % _sizes[1]; j[2] = (ai)/(_sizes[4]) % _sizes[2]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d1, d2, d5, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_41253 : public Layout_5d {
+ public:
+  Layout_41253() { }
+  Layout_41253(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[0] * _sizes[1] * _sizes[4] * _sizes[2] + j[0] * _sizes[1] * _sizes[4] * _sizes[2] + j[1] * _sizes[4] * _sizes[2] + j[4] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[0] * _sizes[1] * _sizes[4] * _sizes[2]); j[0] = (ai)/(_sizes[1] * _sizes[4] * _sizes[2]) % _sizes[0]; j[1] = (ai)/(_sizes[4] * _sizes[2]) % _sizes[1]; j[4] = (ai)/(_sizes[2]) % _sizes[4]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d1, d3, d2, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_41325 : public Layout_5d {
+ public:
+  Layout_41325() { }
+  Layout_41325(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[0] * _sizes[2] * _sizes[1] * _sizes[4] + j[0] * _sizes[2] * _sizes[1] * _sizes[4] + j[2] * _sizes[1] * _sizes[4] + j[1] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[0] * _sizes[2] * _sizes[1] * _sizes[4]); j[0] = (ai)/(_sizes[2] * _sizes[1] * _sizes[4]) % _sizes[0]; j[2] = (ai)/(_sizes[1] * _sizes[4]) % _sizes[2]; j[1] = (ai)/(_sizes[4]) % _sizes[1]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d1, d3, d5, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_41352 : public Layout_5d {
+ public:
+  Layout_41352() { }
+  Layout_41352(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[0] * _sizes[2] * _sizes[4] * _sizes[1] + j[0] * _sizes[2] * _sizes[4] * _sizes[1] + j[2] * _sizes[4] * _sizes[1] + j[4] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[0] * _sizes[2] * _sizes[4] * _sizes[1]); j[0] = (ai)/(_sizes[2] * _sizes[4] * _sizes[1]) % _sizes[0]; j[2] = (ai)/(_sizes[4] * _sizes[1]) % _sizes[2]; j[4] = (ai)/(_sizes[1]) % _sizes[4]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d1, d5, d2, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_41523 : public Layout_5d {
+ public:
+  Layout_41523() { }
+  Layout_41523(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[0] * _sizes[4] * _sizes[1] * _sizes[2] + j[0] * _sizes[4] * _sizes[1] * _sizes[2] + j[4] * _sizes[1] * _sizes[2] + j[1] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[0] * _sizes[4] * _sizes[1] * _sizes[2]); j[0] = (ai)/(_sizes[4] * _sizes[1] * _sizes[2]) % _sizes[0]; j[4] = (ai)/(_sizes[1] * _sizes[2]) % _sizes[4]; j[1] = (ai)/(_sizes[2]) % _sizes[1]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d1, d5, d3, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_41532 : public Layout_5d {
+ public:
+  Layout_41532() { }
+  Layout_41532(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[0] * _sizes[4] * _sizes[2] * _sizes[1] + j[0] * _sizes[4] * _sizes[2] * _sizes[1] + j[4] * _sizes[2] * _sizes[1] + j[2] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[0] * _sizes[4] * _sizes[2] * _sizes[1]); j[0] = (ai)/(_sizes[4] * _sizes[2] * _sizes[1]) % _sizes[0]; j[4] = (ai)/(_sizes[2] * _sizes[1]) % _sizes[4]; j[2] = (ai)/(_sizes[1]) % _sizes[2]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d2, d1, d3, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_42135 : public Layout_5d {
+ public:
+  Layout_42135() { }
+  Layout_42135(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[1] * _sizes[0] * _sizes[2] * _sizes[4] + j[1] * _sizes[0] * _sizes[2] * _sizes[4] + j[0] * _sizes[2] * _sizes[4] + j[2] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[1] * _sizes[0] * _sizes[2] * _sizes[4]); j[1] = (ai)/(_sizes[0] * _sizes[2] * _sizes[4]) % _sizes[1]; j[0] = (ai)/(_sizes[2] * _sizes[4]) % _sizes[0]; j[2] = (ai)/(_sizes[4]) % _sizes[2]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d2, d1, d5, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_42153 : public Layout_5d {
+ public:
+  Layout_42153() { }
+  Layout_42153(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[1] * _sizes[0] * _sizes[4] * _sizes[2] + j[1] * _sizes[0] * _sizes[4] * _sizes[2] + j[0] * _sizes[4] * _sizes[2] + j[4] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[1] * _sizes[0] * _sizes[4] * _sizes[2]); j[1] = (ai)/(_sizes[0] * _sizes[4] * _sizes[2]) % _sizes[1]; j[0] = (ai)/(_sizes[4] * _sizes[2]) % _sizes[0]; j[4] = (ai)/(_sizes[2]) % _sizes[4]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d2, d3, d1, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_42315 : public Layout_5d {
+ public:
+  Layout_42315() { }
+  Layout_42315(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[1] * _sizes[2] * _sizes[0] * _sizes[4] + j[1] * _sizes[2] * _sizes[0] * _sizes[4] + j[2] * _sizes[0] * _sizes[4] + j[0] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[1] * _sizes[2] * _sizes[0] * _sizes[4]); j[1] = (ai)/(_sizes[2] * _sizes[0] * _sizes[4]) % _sizes[1]; j[2] = (ai)/(_sizes[0] * _sizes[4]) % _sizes[2]; j[0] = (ai)/(_sizes[4]) % _sizes[0]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d2, d3, d5, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_42351 : public Layout_5d {
+ public:
+  Layout_42351() { }
+  Layout_42351(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[1] * _sizes[2] * _sizes[4] * _sizes[0] + j[1] * _sizes[2] * _sizes[4] * _sizes[0] + j[2] * _sizes[4] * _sizes[0] + j[4] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[1] * _sizes[2] * _sizes[4] * _sizes[0]); j[1] = (ai)/(_sizes[2] * _sizes[4] * _sizes[0]) % _sizes[1]; j[2] = (ai)/(_sizes[4] * _sizes[0]) % _sizes[2]; j[4] = (ai)/(_sizes[0]) % _sizes[4]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d2, d5, d1, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_42513 : public Layout_5d {
+ public:
+  Layout_42513() { }
+  Layout_42513(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[1] * _sizes[4] * _sizes[0] * _sizes[2] + j[1] * _sizes[4] * _sizes[0] * _sizes[2] + j[4] * _sizes[0] * _sizes[2] + j[0] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[1] * _sizes[4] * _sizes[0] * _sizes[2]); j[1] = (ai)/(_sizes[4] * _sizes[0] * _sizes[2]) % _sizes[1]; j[4] = (ai)/(_sizes[0] * _sizes[2]) % _sizes[4]; j[0] = (ai)/(_sizes[2]) % _sizes[0]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d2, d5, d3, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_42531 : public Layout_5d {
+ public:
+  Layout_42531() { }
+  Layout_42531(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[1] * _sizes[4] * _sizes[2] * _sizes[0] + j[1] * _sizes[4] * _sizes[2] * _sizes[0] + j[4] * _sizes[2] * _sizes[0] + j[2] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[1] * _sizes[4] * _sizes[2] * _sizes[0]); j[1] = (ai)/(_sizes[4] * _sizes[2] * _sizes[0]) % _sizes[1]; j[4] = (ai)/(_sizes[2] * _sizes[0]) % _sizes[4]; j[2] = (ai)/(_sizes[0]) % _sizes[2]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d3, d1, d2, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_43125 : public Layout_5d {
+ public:
+  Layout_43125() { }
+  Layout_43125(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[2] * _sizes[0] * _sizes[1] * _sizes[4] + j[2] * _sizes[0] * _sizes[1] * _sizes[4] + j[0] * _sizes[1] * _sizes[4] + j[1] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[2] * _sizes[0] * _sizes[1] * _sizes[4]); j[2] = (ai)/(_sizes[0] * _sizes[1] * _sizes[4]) % _sizes[2]; j[0] = (ai)/(_sizes[1] * _sizes[4]) % _sizes[0]; j[1] = (ai)/(_sizes[4]) % _sizes[1]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d3, d1, d5, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_43152 : public Layout_5d {
+ public:
+  Layout_43152() { }
+  Layout_43152(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[2] * _sizes[0] * _sizes[4] * _sizes[1] + j[2] * _sizes[0] * _sizes[4] * _sizes[1] + j[0] * _sizes[4] * _sizes[1] + j[4] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[2] * _sizes[0] * _sizes[4] * _sizes[1]); j[2] = (ai)/(_sizes[0] * _sizes[4] * _sizes[1]) % _sizes[2]; j[0] = (ai)/(_sizes[4] * _sizes[1]) % _sizes[0]; j[4] = (ai)/(_sizes[1]) % _sizes[4]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d3, d2, d1, d5 order,
+ // meaning d5 is stored with unit stride.
+ class Layout_43215 : public Layout_5d {
+ public:
+  Layout_43215() { }
+  Layout_43215(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[2] * _sizes[1] * _sizes[0] * _sizes[4] + j[2] * _sizes[1] * _sizes[0] * _sizes[4] + j[1] * _sizes[0] * _sizes[4] + j[0] * _sizes[4] + j[4];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[2] * _sizes[1] * _sizes[0] * _sizes[4]); j[2] = (ai)/(_sizes[1] * _sizes[0] * _sizes[4]) % _sizes[2]; j[1] = (ai)/(_sizes[0] * _sizes[4]) % _sizes[1]; j[0] = (ai)/(_sizes[4]) % _sizes[0]; j[4] = (ai) % _sizes[4];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d3, d2, d5, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_43251 : public Layout_5d {
+ public:
+  Layout_43251() { }
+  Layout_43251(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[2] * _sizes[1] * _sizes[4] * _sizes[0] + j[2] * _sizes[1] * _sizes[4] * _sizes[0] + j[1] * _sizes[4] * _sizes[0] + j[4] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[2] * _sizes[1] * _sizes[4] * _sizes[0]); j[2] = (ai)/(_sizes[1] * _sizes[4] * _sizes[0]) % _sizes[2]; j[1] = (ai)/(_sizes[4] * _sizes[0]) % _sizes[1]; j[4] = (ai)/(_sizes[0]) % _sizes[4]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d3, d5, d1, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_43512 : public Layout_5d {
+ public:
+  Layout_43512() { }
+  Layout_43512(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[2] * _sizes[4] * _sizes[0] * _sizes[1] + j[2] * _sizes[4] * _sizes[0] * _sizes[1] + j[4] * _sizes[0] * _sizes[1] + j[0] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[2] * _sizes[4] * _sizes[0] * _sizes[1]); j[2] = (ai)/(_sizes[4] * _sizes[0] * _sizes[1]) % _sizes[2]; j[4] = (ai)/(_sizes[0] * _sizes[1]) % _sizes[4]; j[0] = (ai)/(_sizes[1]) % _sizes[0]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d3, d5, d2, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_43521 : public Layout_5d {
+ public:
+  Layout_43521() { }
+  Layout_43521(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[2] * _sizes[4] * _sizes[1] * _sizes[0] + j[2] * _sizes[4] * _sizes[1] * _sizes[0] + j[4] * _sizes[1] * _sizes[0] + j[1] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[2] * _sizes[4] * _sizes[1] * _sizes[0]); j[2] = (ai)/(_sizes[4] * _sizes[1] * _sizes[0]) % _sizes[2]; j[4] = (ai)/(_sizes[1] * _sizes[0]) % _sizes[4]; j[1] = (ai)/(_sizes[0]) % _sizes[1]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d5, d1, d2, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_45123 : public Layout_5d {
+ public:
+  Layout_45123() { }
+  Layout_45123(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[4] * _sizes[0] * _sizes[1] * _sizes[2] + j[4] * _sizes[0] * _sizes[1] * _sizes[2] + j[0] * _sizes[1] * _sizes[2] + j[1] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[4] * _sizes[0] * _sizes[1] * _sizes[2]); j[4] = (ai)/(_sizes[0] * _sizes[1] * _sizes[2]) % _sizes[4]; j[0] = (ai)/(_sizes[1] * _sizes[2]) % _sizes[0]; j[1] = (ai)/(_sizes[2]) % _sizes[1]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d5, d1, d3, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_45132 : public Layout_5d {
+ public:
+  Layout_45132() { }
+  Layout_45132(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[4] * _sizes[0] * _sizes[2] * _sizes[1] + j[4] * _sizes[0] * _sizes[2] * _sizes[1] + j[0] * _sizes[2] * _sizes[1] + j[2] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[4] * _sizes[0] * _sizes[2] * _sizes[1]); j[4] = (ai)/(_sizes[0] * _sizes[2] * _sizes[1]) % _sizes[4]; j[0] = (ai)/(_sizes[2] * _sizes[1]) % _sizes[0]; j[2] = (ai)/(_sizes[1]) % _sizes[2]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d5, d2, d1, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_45213 : public Layout_5d {
+ public:
+  Layout_45213() { }
+  Layout_45213(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[4] * _sizes[1] * _sizes[0] * _sizes[2] + j[4] * _sizes[1] * _sizes[0] * _sizes[2] + j[1] * _sizes[0] * _sizes[2] + j[0] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[4] * _sizes[1] * _sizes[0] * _sizes[2]); j[4] = (ai)/(_sizes[1] * _sizes[0] * _sizes[2]) % _sizes[4]; j[1] = (ai)/(_sizes[0] * _sizes[2]) % _sizes[1]; j[0] = (ai)/(_sizes[2]) % _sizes[0]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d5, d2, d3, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_45231 : public Layout_5d {
+ public:
+  Layout_45231() { }
+  Layout_45231(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[4] * _sizes[1] * _sizes[2] * _sizes[0] + j[4] * _sizes[1] * _sizes[2] * _sizes[0] + j[1] * _sizes[2] * _sizes[0] + j[2] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[4] * _sizes[1] * _sizes[2] * _sizes[0]); j[4] = (ai)/(_sizes[1] * _sizes[2] * _sizes[0]) % _sizes[4]; j[1] = (ai)/(_sizes[2] * _sizes[0]) % _sizes[1]; j[2] = (ai)/(_sizes[0]) % _sizes[2]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d5, d3, d1, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_45312 : public Layout_5d {
+ public:
+  Layout_45312() { }
+  Layout_45312(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[4] * _sizes[2] * _sizes[0] * _sizes[1] + j[4] * _sizes[2] * _sizes[0] * _sizes[1] + j[2] * _sizes[0] * _sizes[1] + j[0] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[4] * _sizes[2] * _sizes[0] * _sizes[1]); j[4] = (ai)/(_sizes[2] * _sizes[0] * _sizes[1]) % _sizes[4]; j[2] = (ai)/(_sizes[0] * _sizes[1]) % _sizes[2]; j[0] = (ai)/(_sizes[1]) % _sizes[0]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d4, d5, d3, d2, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_45321 : public Layout_5d {
+ public:
+  Layout_45321() { }
+  Layout_45321(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[3] * _sizes[4] * _sizes[2] * _sizes[1] * _sizes[0] + j[4] * _sizes[2] * _sizes[1] * _sizes[0] + j[2] * _sizes[1] * _sizes[0] + j[1] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[3] = (ai)/(_sizes[4] * _sizes[2] * _sizes[1] * _sizes[0]); j[4] = (ai)/(_sizes[2] * _sizes[1] * _sizes[0]) % _sizes[4]; j[2] = (ai)/(_sizes[1] * _sizes[0]) % _sizes[2]; j[1] = (ai)/(_sizes[0]) % _sizes[1]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d1, d2, d3, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_51234 : public Layout_5d {
+ public:
+  Layout_51234() { }
+  Layout_51234(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[0] * _sizes[1] * _sizes[2] * _sizes[3] + j[0] * _sizes[1] * _sizes[2] * _sizes[3] + j[1] * _sizes[2] * _sizes[3] + j[2] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[0] * _sizes[1] * _sizes[2] * _sizes[3]); j[0] = (ai)/(_sizes[1] * _sizes[2] * _sizes[3]) % _sizes[0]; j[1] = (ai)/(_sizes[2] * _sizes[3]) % _sizes[1]; j[2] = (ai)/(_sizes[3]) % _sizes[2]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d1, d2, d4, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_51243 : public Layout_5d {
+ public:
+  Layout_51243() { }
+  Layout_51243(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[0] * _sizes[1] * _sizes[3] * _sizes[2] + j[0] * _sizes[1] * _sizes[3] * _sizes[2] + j[1] * _sizes[3] * _sizes[2] + j[3] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[0] * _sizes[1] * _sizes[3] * _sizes[2]); j[0] = (ai)/(_sizes[1] * _sizes[3] * _sizes[2]) % _sizes[0]; j[1] = (ai)/(_sizes[3] * _sizes[2]) % _sizes[1]; j[3] = (ai)/(_sizes[2]) % _sizes[3]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d1, d3, d2, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_51324 : public Layout_5d {
+ public:
+  Layout_51324() { }
+  Layout_51324(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[0] * _sizes[2] * _sizes[1] * _sizes[3] + j[0] * _sizes[2] * _sizes[1] * _sizes[3] + j[2] * _sizes[1] * _sizes[3] + j[1] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[0] * _sizes[2] * _sizes[1] * _sizes[3]); j[0] = (ai)/(_sizes[2] * _sizes[1] * _sizes[3]) % _sizes[0]; j[2] = (ai)/(_sizes[1] * _sizes[3]) % _sizes[2]; j[1] = (ai)/(_sizes[3]) % _sizes[1]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d1, d3, d4, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_51342 : public Layout_5d {
+ public:
+  Layout_51342() { }
+  Layout_51342(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[0] * _sizes[2] * _sizes[3] * _sizes[1] + j[0] * _sizes[2] * _sizes[3] * _sizes[1] + j[2] * _sizes[3] * _sizes[1] + j[3] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[0] * _sizes[2] * _sizes[3] * _sizes[1]); j[0] = (ai)/(_sizes[2] * _sizes[3] * _sizes[1]) % _sizes[0]; j[2] = (ai)/(_sizes[3] * _sizes[1]) % _sizes[2]; j[3] = (ai)/(_sizes[1]) % _sizes[3]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d1, d4, d2, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_51423 : public Layout_5d {
+ public:
+  Layout_51423() { }
+  Layout_51423(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[0] * _sizes[3] * _sizes[1] * _sizes[2] + j[0] * _sizes[3] * _sizes[1] * _sizes[2] + j[3] * _sizes[1] * _sizes[2] + j[1] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[0] * _sizes[3] * _sizes[1] * _sizes[2]); j[0] = (ai)/(_sizes[3] * _sizes[1] * _sizes[2]) % _sizes[0]; j[3] = (ai)/(_sizes[1] * _sizes[2]) % _sizes[3]; j[1] = (ai)/(_sizes[2]) % _sizes[1]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d1, d4, d3, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_51432 : public Layout_5d {
+ public:
+  Layout_51432() { }
+  Layout_51432(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[0] * _sizes[3] * _sizes[2] * _sizes[1] + j[0] * _sizes[3] * _sizes[2] * _sizes[1] + j[3] * _sizes[2] * _sizes[1] + j[2] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[0] * _sizes[3] * _sizes[2] * _sizes[1]); j[0] = (ai)/(_sizes[3] * _sizes[2] * _sizes[1]) % _sizes[0]; j[3] = (ai)/(_sizes[2] * _sizes[1]) % _sizes[3]; j[2] = (ai)/(_sizes[1]) % _sizes[2]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d2, d1, d3, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_52134 : public Layout_5d {
+ public:
+  Layout_52134() { }
+  Layout_52134(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[1] * _sizes[0] * _sizes[2] * _sizes[3] + j[1] * _sizes[0] * _sizes[2] * _sizes[3] + j[0] * _sizes[2] * _sizes[3] + j[2] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[1] * _sizes[0] * _sizes[2] * _sizes[3]); j[1] = (ai)/(_sizes[0] * _sizes[2] * _sizes[3]) % _sizes[1]; j[0] = (ai)/(_sizes[2] * _sizes[3]) % _sizes[0]; j[2] = (ai)/(_sizes[3]) % _sizes[2]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d2, d1, d4, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_52143 : public Layout_5d {
+ public:
+  Layout_52143() { }
+  Layout_52143(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[1] * _sizes[0] * _sizes[3] * _sizes[2] + j[1] * _sizes[0] * _sizes[3] * _sizes[2] + j[0] * _sizes[3] * _sizes[2] + j[3] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[1] * _sizes[0] * _sizes[3] * _sizes[2]); j[1] = (ai)/(_sizes[0] * _sizes[3] * _sizes[2]) % _sizes[1]; j[0] = (ai)/(_sizes[3] * _sizes[2]) % _sizes[0]; j[3] = (ai)/(_sizes[2]) % _sizes[3]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d2, d3, d1, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_52314 : public Layout_5d {
+ public:
+  Layout_52314() { }
+  Layout_52314(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[1] * _sizes[2] * _sizes[0] * _sizes[3] + j[1] * _sizes[2] * _sizes[0] * _sizes[3] + j[2] * _sizes[0] * _sizes[3] + j[0] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[1] * _sizes[2] * _sizes[0] * _sizes[3]); j[1] = (ai)/(_sizes[2] * _sizes[0] * _sizes[3]) % _sizes[1]; j[2] = (ai)/(_sizes[0] * _sizes[3]) % _sizes[2]; j[0] = (ai)/(_sizes[3]) % _sizes[0]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d2, d3, d4, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_52341 : public Layout_5d {
+ public:
+  Layout_52341() { }
+  Layout_52341(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[1] * _sizes[2] * _sizes[3] * _sizes[0] + j[1] * _sizes[2] * _sizes[3] * _sizes[0] + j[2] * _sizes[3] * _sizes[0] + j[3] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[1] * _sizes[2] * _sizes[3] * _sizes[0]); j[1] = (ai)/(_sizes[2] * _sizes[3] * _sizes[0]) % _sizes[1]; j[2] = (ai)/(_sizes[3] * _sizes[0]) % _sizes[2]; j[3] = (ai)/(_sizes[0]) % _sizes[3]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d2, d4, d1, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_52413 : public Layout_5d {
+ public:
+  Layout_52413() { }
+  Layout_52413(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[1] * _sizes[3] * _sizes[0] * _sizes[2] + j[1] * _sizes[3] * _sizes[0] * _sizes[2] + j[3] * _sizes[0] * _sizes[2] + j[0] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[1] * _sizes[3] * _sizes[0] * _sizes[2]); j[1] = (ai)/(_sizes[3] * _sizes[0] * _sizes[2]) % _sizes[1]; j[3] = (ai)/(_sizes[0] * _sizes[2]) % _sizes[3]; j[0] = (ai)/(_sizes[2]) % _sizes[0]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d2, d4, d3, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_52431 : public Layout_5d {
+ public:
+  Layout_52431() { }
+  Layout_52431(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[1] * _sizes[3] * _sizes[2] * _sizes[0] + j[1] * _sizes[3] * _sizes[2] * _sizes[0] + j[3] * _sizes[2] * _sizes[0] + j[2] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[1] * _sizes[3] * _sizes[2] * _sizes[0]); j[1] = (ai)/(_sizes[3] * _sizes[2] * _sizes[0]) % _sizes[1]; j[3] = (ai)/(_sizes[2] * _sizes[0]) % _sizes[3]; j[2] = (ai)/(_sizes[0]) % _sizes[2]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d3, d1, d2, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_53124 : public Layout_5d {
+ public:
+  Layout_53124() { }
+  Layout_53124(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[2] * _sizes[0] * _sizes[1] * _sizes[3] + j[2] * _sizes[0] * _sizes[1] * _sizes[3] + j[0] * _sizes[1] * _sizes[3] + j[1] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[2] * _sizes[0] * _sizes[1] * _sizes[3]); j[2] = (ai)/(_sizes[0] * _sizes[1] * _sizes[3]) % _sizes[2]; j[0] = (ai)/(_sizes[1] * _sizes[3]) % _sizes[0]; j[1] = (ai)/(_sizes[3]) % _sizes[1]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d3, d1, d4, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_53142 : public Layout_5d {
+ public:
+  Layout_53142() { }
+  Layout_53142(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[2] * _sizes[0] * _sizes[3] * _sizes[1] + j[2] * _sizes[0] * _sizes[3] * _sizes[1] + j[0] * _sizes[3] * _sizes[1] + j[3] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[2] * _sizes[0] * _sizes[3] * _sizes[1]); j[2] = (ai)/(_sizes[0] * _sizes[3] * _sizes[1]) % _sizes[2]; j[0] = (ai)/(_sizes[3] * _sizes[1]) % _sizes[0]; j[3] = (ai)/(_sizes[1]) % _sizes[3]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d3, d2, d1, d4 order,
+ // meaning d4 is stored with unit stride.
+ class Layout_53214 : public Layout_5d {
+ public:
+  Layout_53214() { }
+  Layout_53214(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[2] * _sizes[1] * _sizes[0] * _sizes[3] + j[2] * _sizes[1] * _sizes[0] * _sizes[3] + j[1] * _sizes[0] * _sizes[3] + j[0] * _sizes[3] + j[3];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[2] * _sizes[1] * _sizes[0] * _sizes[3]); j[2] = (ai)/(_sizes[1] * _sizes[0] * _sizes[3]) % _sizes[2]; j[1] = (ai)/(_sizes[0] * _sizes[3]) % _sizes[1]; j[0] = (ai)/(_sizes[3]) % _sizes[0]; j[3] = (ai) % _sizes[3];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d3, d2, d4, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_53241 : public Layout_5d {
+ public:
+  Layout_53241() { }
+  Layout_53241(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[2] * _sizes[1] * _sizes[3] * _sizes[0] + j[2] * _sizes[1] * _sizes[3] * _sizes[0] + j[1] * _sizes[3] * _sizes[0] + j[3] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[2] * _sizes[1] * _sizes[3] * _sizes[0]); j[2] = (ai)/(_sizes[1] * _sizes[3] * _sizes[0]) % _sizes[2]; j[1] = (ai)/(_sizes[3] * _sizes[0]) % _sizes[1]; j[3] = (ai)/(_sizes[0]) % _sizes[3]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d3, d4, d1, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_53412 : public Layout_5d {
+ public:
+  Layout_53412() { }
+  Layout_53412(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[2] * _sizes[3] * _sizes[0] * _sizes[1] + j[2] * _sizes[3] * _sizes[0] * _sizes[1] + j[3] * _sizes[0] * _sizes[1] + j[0] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[2] * _sizes[3] * _sizes[0] * _sizes[1]); j[2] = (ai)/(_sizes[3] * _sizes[0] * _sizes[1]) % _sizes[2]; j[3] = (ai)/(_sizes[0] * _sizes[1]) % _sizes[3]; j[0] = (ai)/(_sizes[1]) % _sizes[0]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d3, d4, d2, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_53421 : public Layout_5d {
+ public:
+  Layout_53421() { }
+  Layout_53421(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[2] * _sizes[3] * _sizes[1] * _sizes[0] + j[2] * _sizes[3] * _sizes[1] * _sizes[0] + j[3] * _sizes[1] * _sizes[0] + j[1] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[2] * _sizes[3] * _sizes[1] * _sizes[0]); j[2] = (ai)/(_sizes[3] * _sizes[1] * _sizes[0]) % _sizes[2]; j[3] = (ai)/(_sizes[1] * _sizes[0]) % _sizes[3]; j[1] = (ai)/(_sizes[0]) % _sizes[1]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d4, d1, d2, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_54123 : public Layout_5d {
+ public:
+  Layout_54123() { }
+  Layout_54123(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[3] * _sizes[0] * _sizes[1] * _sizes[2] + j[3] * _sizes[0] * _sizes[1] * _sizes[2] + j[0] * _sizes[1] * _sizes[2] + j[1] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[3] * _sizes[0] * _sizes[1] * _sizes[2]); j[3] = (ai)/(_sizes[0] * _sizes[1] * _sizes[2]) % _sizes[3]; j[0] = (ai)/(_sizes[1] * _sizes[2]) % _sizes[0]; j[1] = (ai)/(_sizes[2]) % _sizes[1]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d4, d1, d3, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_54132 : public Layout_5d {
+ public:
+  Layout_54132() { }
+  Layout_54132(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[3] * _sizes[0] * _sizes[2] * _sizes[1] + j[3] * _sizes[0] * _sizes[2] * _sizes[1] + j[0] * _sizes[2] * _sizes[1] + j[2] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[3] * _sizes[0] * _sizes[2] * _sizes[1]); j[3] = (ai)/(_sizes[0] * _sizes[2] * _sizes[1]) % _sizes[3]; j[0] = (ai)/(_sizes[2] * _sizes[1]) % _sizes[0]; j[2] = (ai)/(_sizes[1]) % _sizes[2]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d4, d2, d1, d3 order,
+ // meaning d3 is stored with unit stride.
+ class Layout_54213 : public Layout_5d {
+ public:
+  Layout_54213() { }
+  Layout_54213(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[3] * _sizes[1] * _sizes[0] * _sizes[2] + j[3] * _sizes[1] * _sizes[0] * _sizes[2] + j[1] * _sizes[0] * _sizes[2] + j[0] * _sizes[2] + j[2];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[3] * _sizes[1] * _sizes[0] * _sizes[2]); j[3] = (ai)/(_sizes[1] * _sizes[0] * _sizes[2]) % _sizes[3]; j[1] = (ai)/(_sizes[0] * _sizes[2]) % _sizes[1]; j[0] = (ai)/(_sizes[2]) % _sizes[0]; j[2] = (ai) % _sizes[2];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d4, d2, d3, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_54231 : public Layout_5d {
+ public:
+  Layout_54231() { }
+  Layout_54231(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[3] * _sizes[1] * _sizes[2] * _sizes[0] + j[3] * _sizes[1] * _sizes[2] * _sizes[0] + j[1] * _sizes[2] * _sizes[0] + j[2] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[3] * _sizes[1] * _sizes[2] * _sizes[0]); j[3] = (ai)/(_sizes[1] * _sizes[2] * _sizes[0]) % _sizes[3]; j[1] = (ai)/(_sizes[2] * _sizes[0]) % _sizes[1]; j[2] = (ai)/(_sizes[0]) % _sizes[2]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d4, d3, d1, d2 order,
+ // meaning d2 is stored with unit stride.
+ class Layout_54312 : public Layout_5d {
+ public:
+  Layout_54312() { }
+  Layout_54312(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[3] * _sizes[2] * _sizes[0] * _sizes[1] + j[3] * _sizes[2] * _sizes[0] * _sizes[1] + j[2] * _sizes[0] * _sizes[1] + j[0] * _sizes[1] + j[1];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[3] * _sizes[2] * _sizes[0] * _sizes[1]); j[3] = (ai)/(_sizes[2] * _sizes[0] * _sizes[1]) % _sizes[3]; j[2] = (ai)/(_sizes[0] * _sizes[1]) % _sizes[2]; j[0] = (ai)/(_sizes[1]) % _sizes[0]; j[1] = (ai) % _sizes[1];
+    return j;
+  }
+ };
+
+ // 5-D <-> 1-D layout class with dimensions in d5, d4, d3, d2, d1 order,
+ // meaning d1 is stored with unit stride.
+ class Layout_54321 : public Layout_5d {
+ public:
+  Layout_54321() { }
+  Layout_54321(const Indices& sizes) : Layout_5d(sizes) { }
+  virtual int get_num_sizes() const final {
+    return 5;
+  }
+
+  // Return 1-D offset from 5-D 'j' indices.
+  virtual idx_t layout(const Indices& j) const final {
+    return j[4] * _sizes[3] * _sizes[2] * _sizes[1] * _sizes[0] + j[3] * _sizes[2] * _sizes[1] * _sizes[0] + j[2] * _sizes[1] * _sizes[0] + j[1] * _sizes[0] + j[0];
+  }
+
+  // Return 5 index(indices) based on 1-D 'ai' input.
+  virtual Indices unlayout(idx_t ai) const final {
+    Indices j(_sizes);
+    j[4] = (ai)/(_sizes[3] * _sizes[2] * _sizes[1] * _sizes[0]); j[3] = (ai)/(_sizes[2] * _sizes[1] * _sizes[0]) % _sizes[3]; j[2] = (ai)/(_sizes[1] * _sizes[0]) % _sizes[2]; j[1] = (ai)/(_sizes[0]) % _sizes[1]; j[0] = (ai) % _sizes[0];
+    return j;
+  }
+ };
@@ -0,0 +1,13 @@
+// Settings from YASK Makefile
+// Automatically-generated code; do not edit.
+#define PFD_L1 0
+#define PFD_L2 2
+#define MAX_DIMS 5
+#define NUM_REGION_LOOP_VARIANTS 3
+#define NUM_BLOCK_LOOP_VARIANTS 3
+#define NUM_SUB_BLOCK_LOOP_VARIANTS 3
+#define DEF_ARGS "-thread_divisor 1 -block_threads 2 -d 1024 -dx 512 -b 64 -ep 1 "
+#define ARCH_INTEL64
+#define ARCH_NAME "intel64"
+#define USE_MPI
+#define USE_MPI_EMU
@@ -0,0 +1,80 @@
+/*
+ * 4-D grid-scanning code.
+ * Generated automatically from the following pseudo-code:
+ *
+ * N = 3;
+ * omp loop(1 .. N-1)  { call(misc_fn()); }
+ *
+ */ #ifndef OMP_PRAGMA_PREFIX
+ #define OMP_PRAGMA_PREFIX omp parallel for schedule(guided) proc_bind(spread)
+ #endif
+ #ifndef OMP_PRAGMA_SUFFIX
+ #define OMP_PRAGMA_SUFFIX
+ #endif
+
+ // 'ScanIndices misc_idxs' must be set before the following code.
+ {
+
+  // Indices for function calls.
+  ScanIndices local_indices(misc_idxs);
+
+  // ** Begin scan over dimensions 1, 2, 3. **
+
+  // Number of iterations to get from misc_idxs.begin[1] to (but not including) misc_idxs.end[1], stepping by misc_idxs.step[1]. This value is rounded up because the last iteration may cover fewer than misc_idxs.step[1] steps.
+  const idx_t num_iters_1 = ((misc_idxs.end[1] - misc_idxs.begin[1]) + (misc_idxs.step[1] - 1)) / misc_idxs.step[1];
+
+  // Number of iterations to get from misc_idxs.begin[2] to (but not including) misc_idxs.end[2], stepping by misc_idxs.step[2]. This value is rounded up because the last iteration may cover fewer than misc_idxs.step[2] steps.
+  const idx_t num_iters_2 = ((misc_idxs.end[2] - misc_idxs.begin[2]) + (misc_idxs.step[2] - 1)) / misc_idxs.step[2];
+
+  // Number of iterations to get from misc_idxs.begin[3] to (but not including) misc_idxs.end[3], stepping by misc_idxs.step[3]. This value is rounded up because the last iteration may cover fewer than misc_idxs.step[3] steps.
+  const idx_t num_iters_3 = ((misc_idxs.end[3] - misc_idxs.begin[3]) + (misc_idxs.step[3] - 1)) / misc_idxs.step[3];
+
+  // Number of iterations in dimensions 1, 2, 3
+  const idx_t num_iters_1_2_3 = num_iters_1 * num_iters_2 * num_iters_3;
+
+  // Number of iterations in dimensions 2, 3
+  const idx_t num_iters_2_3 = num_iters_2 * num_iters_3;
+
+  // Inner loop.
+ 
+
+  // Distribute iterations among OpenMP threads.
+ #pragma OMP_PRAGMA_PREFIX firstprivate(local_indices) OMP_PRAGMA_SUFFIX
+  for (idx_t loop_index_1_2_3 = 0; loop_index_1_2_3 < num_iters_1_2_3; loop_index_1_2_3++) {
+
+  // Zero-based, unit-stride index for dimension 1.
+  idx_t index_1 = loop_index_1_2_3 / num_iters_2_3;
+
+  // Zero-based, unit-stride index for dimension 2.
+  idx_t index_2 = (loop_index_1_2_3 / num_iters_3) % num_iters_2;
+
+  // Zero-based, unit-stride index for dimension 3.
+  idx_t index_3 = (loop_index_1_2_3) % num_iters_3;
+
+  // This value of index_1 covers dimension 1 from start_1 to stop_1-1.
+  idx_t start_1 = misc_idxs.begin[1] + (index_1 * misc_idxs.step[1]);
+  idx_t stop_1 = std::min(start_1 + misc_idxs.step[1], misc_idxs.end[1]);
+
+  // This value of index_2 covers dimension 2 from start_2 to stop_2-1.
+  idx_t start_2 = misc_idxs.begin[2] + (index_2 * misc_idxs.step[2]);
+  idx_t stop_2 = std::min(start_2 + misc_idxs.step[2], misc_idxs.end[2]);
+
+  // This value of index_3 covers dimension 3 from start_3 to stop_3-1.
+  idx_t start_3 = misc_idxs.begin[3] + (index_3 * misc_idxs.step[3]);
+  idx_t stop_3 = std::min(start_3 + misc_idxs.step[3], misc_idxs.end[3]);
+  local_indices.start[1] = start_1;
+  local_indices.stop[1] = stop_1;
+  local_indices.index[1] = index_1;
+  local_indices.start[2] = start_2;
+  local_indices.stop[2] = stop_2;
+  local_indices.index[2] = index_2;
+  local_indices.start[3] = start_3;
+  local_indices.stop[3] = stop_3;
+  local_indices.index[3] = index_3;
+   misc_fn(local_indices);
+  }
+ }
+ #undef OMP_PRAGMA_PREFIX
+ #undef OMP_PRAGMA_SUFFIX
+
+ // End of generated code.
@@ -0,0 +1,2531 @@
+// Automatically-generated code; do not edit.
+
+////// YASK implementation of the 'iso3dfd' stencil //////
+
+#ifdef DEFINE_MACROS
+// Stencil solution:
+#define YASK_STENCIL_NAME "iso3dfd"
+#define YASK_STENCIL_CONTEXT StencilContext_iso3dfd
+
+// FP precision:
+#define REAL_BYTES 4
+
+// Number of stencil dimensions (step and domain):
+#define NUM_STENCIL_DIMS 4
+
+// One vector fold: x=1 * y=1 * z=1
+#define VLEN_X (1)
+#define VLEN_Y (1)
+#define VLEN_Z (1)
+#define VLEN (1)
+#define FIRST_FOLD_INDEX_IS_UNIT_STRIDE (1)
+#define NUM_VEC_FOLD_DIMS (0)
+#define VEC_FOLD_LAYOUT_CLASS Layout_0d
+#define VEC_FOLD_LAYOUT(idxs) (0)
+#define USING_UNALIGNED_LOADS (0)
+
+// Cluster multipliers of vector folds: x=1 * y=1 * z=1
+#define CMULT_X (1)
+#define CMULT_Y (1)
+#define CMULT_Z (1)
+#define CMULT (1)
+
+#endif // DEFINE_MACROS
+
+#ifdef DEFINE_CONTEXT
+namespace yask {
+
+ ////// Stencil-specific data //////
+struct StencilContext_iso3dfd_data : public StencilContext {
+
+ ///// Grid(s).
+
+ // The 4-D grid 'pressure', which is updated by one or more equations.
+ typedef YkVecGrid<Layout_2314, true, 1, 1, 1, 1> pressure_type;
+ std::shared_ptr<pressure_type> pressure_ptr;
+ pressure_type* pressure;
+ GridDimNames pressure_dim_names;
+ const idx_t pressure_alloc_t = 2; // default allocation in 't' dimension.
+ const idx_t pressure_left_halo_x = 8; // default left halo size in 'x' dimension.
+ const idx_t pressure_right_halo_x = 8; // default right halo size in 'x' dimension.
+ const idx_t pressure_left_halo_y = 8; // default left halo size in 'y' dimension.
+ const idx_t pressure_right_halo_y = 8; // default right halo size in 'y' dimension.
+ const idx_t pressure_left_halo_z = 8; // default left halo size in 'z' dimension.
+ const idx_t pressure_right_halo_z = 8; // default right halo size in 'z' dimension.
+ const int pressure_max_exch_dist = 1; // max L1-norm of neighbors needing halo exchange.
+
+ // The 3-D grid 'vel', which is not updated by any equation (read-only).
+ typedef YkVecGrid<Layout_123, false, 1, 1, 1> vel_type;
+ std::shared_ptr<vel_type> vel_ptr;
+ vel_type* vel;
+ GridDimNames vel_dim_names;
+ const idx_t vel_left_halo_x = 0; // default left halo size in 'x' dimension.
+ const idx_t vel_right_halo_x = 0; // default right halo size in 'x' dimension.
+ const idx_t vel_left_halo_y = 0; // default left halo size in 'y' dimension.
+ const idx_t vel_right_halo_y = 0; // default right halo size in 'y' dimension.
+ const idx_t vel_left_halo_z = 0; // default left halo size in 'z' dimension.
+ const idx_t vel_right_halo_z = 0; // default right halo size in 'z' dimension.
+ const int vel_max_exch_dist = 0; // max L1-norm of neighbors needing halo exchange.
+
+ // The 1-D grid 'coeff', which is not updated by any equation (read-only).
+ typedef YkVecGrid<Layout_1, false, 1> coeff_type;
+ std::shared_ptr<coeff_type> coeff_ptr;
+ coeff_type* coeff;
+ GridDimNames coeff_dim_names;
+ const idx_t coeff_alloc_r = 9; // default allocation in 'r' dimension.
+ const int coeff_max_exch_dist = 0; // max L1-norm of neighbors needing halo exchange.
+
+ // Constructor.
+ StencilContext_iso3dfd_data(KernelEnvPtr env, KernelSettingsPtr settings) : StencilContext(env, settings) {
+  name = "iso3dfd";
+
+ // Create grids (but do not allocate data in them).
+
+ // Init grid 'pressure'.
+ pressure_dim_names = {
+"t", "x", "y", "z"};
+ pressure_ptr = std::make_shared<pressure_type>(_dims, "pressure", pressure_dim_names, &_ostr);
+ pressure = pressure_ptr.get();
+ addGrid(pressure_ptr, true /* is an output grid */);
+ pressure->set_alloc_size("t", pressure_alloc_t);
+ pressure->set_left_halo_size("x", pressure_left_halo_x);
+ pressure->set_right_halo_size("x", pressure_right_halo_x);
+ pressure->set_left_halo_size("y", pressure_left_halo_y);
+ pressure->set_right_halo_size("y", pressure_right_halo_y);
+ pressure->set_left_halo_size("z", pressure_left_halo_z);
+ pressure->set_right_halo_size("z", pressure_right_halo_z);
+ pressure->set_max_exch_dist(pressure_max_exch_dist);
+
+ // Init grid 'vel'.
+ vel_dim_names = {
+"x", "y", "z"};
+ vel_ptr = std::make_shared<vel_type>(_dims, "vel", vel_dim_names, &_ostr);
+ vel = vel_ptr.get();
+ addGrid(vel_ptr, false /* is not an output grid */);
+ vel->set_left_halo_size("x", vel_left_halo_x);
+ vel->set_right_halo_size("x", vel_right_halo_x);
+ vel->set_left_halo_size("y", vel_left_halo_y);
+ vel->set_right_halo_size("y", vel_right_halo_y);
+ vel->set_left_halo_size("z", vel_left_halo_z);
+ vel->set_right_halo_size("z", vel_right_halo_z);
+ vel->set_max_exch_dist(vel_max_exch_dist);
+
+ // Init grid 'coeff'.
+ coeff_dim_names = {
+"r"};
+ coeff_ptr = std::make_shared<coeff_type>(_dims, "coeff", coeff_dim_names, &_ostr);
+ coeff = coeff_ptr.get();
+ addGrid(coeff_ptr, false /* is not an output grid */);
+ coeff->set_alloc_size("r", coeff_alloc_r);
+ coeff->set_max_exch_dist(coeff_max_exch_dist);
+
+ // Update grids with context info.
+ update_grids();
+ } // ctor
+
+ // Make a new grid iff its dims match any in the stencil.
+ // Returns pointer to the new grid or nullptr if no match.
+ virtual YkGridPtr newStencilGrid(const std::string& name, const GridDimNames& dims) {
+ YkGridPtr gp;
+
+ // Grids with 't, x, y, z' dim(s).
+ if (dims == pressure_dim_names) gp = std::make_shared<pressure_type>(_dims, name, dims, &_ostr);
+
+ // Grids with 'x, y, z' dim(s).
+ else if (dims == vel_dim_names) gp = std::make_shared<vel_type>(_dims, name, dims, &_ostr);
+
+ // Grids with 'r' dim(s).
+ else if (dims == coeff_dim_names) gp = std::make_shared<coeff_type>(_dims, name, dims, &_ostr);
+ return gp;
+ } // newStencilGrid
+}; // StencilContext_iso3dfd_data
+
+ ////// Stencil equation-group 'stencil_0' w/no condition //////
+
+ class StencilGroup_stencil_0 : public StencilGroupBase {
+ protected:
+ StencilContext_iso3dfd_data* _context = 0;
+ public:
+
+ // 61 FP operation(s) per point:
+ // pressure((t + 1), x, y, z) EQUALS (((2 * pressure(t, x, y, z)) - pressure((t - 1), x, y, z)) + (((pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)) + ((pressure(t, (x - 8), y, z) + pressure(t, (x + 8), y, z) + pressure(t, x, (y - 8), z) + pressure(t, x, (y + 8), z) + pressure(t, x, y, (z - 8)) + pressure(t, x, y, (z + 8))) * coeff(8))) * vel(x, y, z))).
+ StencilGroup_stencil_0(StencilContext_iso3dfd_data* context) :
+ StencilGroupBase(context),
+ _context(context) {
+ _name = "stencil_0";
+ _scalar_fp_ops = 61;
+ _scalar_points_read = 60;
+ _scalar_points_written = 1;
+
+ // The following grids are written by StencilGroup_stencil_0
+  outputGridPtrs.push_back(_context->pressure_ptr);
+
+ // The following grids are read by StencilGroup_stencil_0
+  inputGridPtrs.push_back(_context->vel_ptr);
+  inputGridPtrs.push_back(_context->coeff_ptr);
+  inputGridPtrs.push_back(_context->pressure_ptr);
+ } // Ctor.
+
+ // Determine whether StencilGroup_stencil_0 is valid at the indices t, x, y, z.
+ // Return true if indices are within the valid sub-domain or false otherwise.
+ virtual bool is_in_valid_domain(const Indices& idxs) {
+
+ // Extract individual indices.
+ idx_t t = idxs[0];
+ idx_t x = idxs[1];
+ idx_t y = idxs[2];
+ idx_t z = idxs[3];
+ return true; // full domain.
+ }
+
+ // Calculate one scalar result relative to indices t, x, y, z.
+ // There are approximately 61 FP operation(s) per invocation.
+ virtual void calc_scalar(const Indices& idxs) {
+
+ // Extract individual indices.
+ idx_t t = idxs[0];
+ idx_t x = idxs[1];
+ idx_t y = idxs[2];
+ idx_t z = idxs[3];
+ auto temp1 = _context->pressure;
+ auto temp2 = temp1->_wrap_step(t);
+ auto temp3 = temp1->_wrap_step((t - 1));
+
+ // temp4 = 2 * pressure(t, x, y, z).
+ real_t temp4 = 2.000000000000000e+00 * temp1->readElem({t, x, y, z}, temp2, __LINE__);
+
+ // temp5 = ((2 * pressure(t, x, y, z)) - pressure((t - 1), x, y, z)).
+ real_t temp5 = temp4 - temp1->readElem({(t - 1), x, y, z}, temp3, __LINE__);
+ auto temp6 = _context->coeff;
+ auto temp7 = 0;
+
+ // temp8 = pressure(t, x, y, z) * coeff(0).
+ real_t temp8 = temp1->readElem({t, x, y, z}, temp2, __LINE__) * temp6->readElem({0}, temp7, __LINE__);
+
+ // temp9 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)).
+ real_t temp9 = temp8 + ((temp1->readElem({t, (x - 1), y, z}, temp2, __LINE__) + temp1->readElem({t, (x + 1), y, z}, temp2, __LINE__) + temp1->readElem({t, x, (y - 1), z}, temp2, __LINE__) + temp1->readElem({t, x, (y + 1), z}, temp2, __LINE__) + temp1->readElem({t, x, y, (z - 1)}, temp2, __LINE__) + temp1->readElem({t, x, y, (z + 1)}, temp2, __LINE__)) * temp6->readElem({1}, temp7, __LINE__));
+
+ // temp10 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)).
+ real_t temp10 = temp9 + ((temp1->readElem({t, (x - 2), y, z}, temp2, __LINE__) + temp1->readElem({t, (x + 2), y, z}, temp2, __LINE__) + temp1->readElem({t, x, (y - 2), z}, temp2, __LINE__) + temp1->readElem({t, x, (y + 2), z}, temp2, __LINE__) + temp1->readElem({t, x, y, (z - 2)}, temp2, __LINE__) + temp1->readElem({t, x, y, (z + 2)}, temp2, __LINE__)) * temp6->readElem({2}, temp7, __LINE__));
+
+ // temp11 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)).
+ real_t temp11 = temp10 + ((temp1->readElem({t, (x - 3), y, z}, temp2, __LINE__) + temp1->readElem({t, (x + 3), y, z}, temp2, __LINE__) + temp1->readElem({t, x, (y - 3), z}, temp2, __LINE__) + temp1->readElem({t, x, (y + 3), z}, temp2, __LINE__) + temp1->readElem({t, x, y, (z - 3)}, temp2, __LINE__) + temp1->readElem({t, x, y, (z + 3)}, temp2, __LINE__)) * temp6->readElem({3}, temp7, __LINE__));
+
+ // temp12 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)).
+ real_t temp12 = temp11 + ((temp1->readElem({t, (x - 4), y, z}, temp2, __LINE__) + temp1->readElem({t, (x + 4), y, z}, temp2, __LINE__) + temp1->readElem({t, x, (y - 4), z}, temp2, __LINE__) + temp1->readElem({t, x, (y + 4), z}, temp2, __LINE__) + temp1->readElem({t, x, y, (z - 4)}, temp2, __LINE__) + temp1->readElem({t, x, y, (z + 4)}, temp2, __LINE__)) * temp6->readElem({4}, temp7, __LINE__));
+
+ // temp13 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)).
+ real_t temp13 = temp12 + ((temp1->readElem({t, (x - 5), y, z}, temp2, __LINE__) + temp1->readElem({t, (x + 5), y, z}, temp2, __LINE__) + temp1->readElem({t, x, (y - 5), z}, temp2, __LINE__) + temp1->readElem({t, x, (y + 5), z}, temp2, __LINE__) + temp1->readElem({t, x, y, (z - 5)}, temp2, __LINE__) + temp1->readElem({t, x, y, (z + 5)}, temp2, __LINE__)) * temp6->readElem({5}, temp7, __LINE__));
+
+ // temp14 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)).
+ real_t temp14 = temp13 + ((temp1->readElem({t, (x - 6), y, z}, temp2, __LINE__) + temp1->readElem({t, (x + 6), y, z}, temp2, __LINE__) + temp1->readElem({t, x, (y - 6), z}, temp2, __LINE__) + temp1->readElem({t, x, (y + 6), z}, temp2, __LINE__) + temp1->readElem({t, x, y, (z - 6)}, temp2, __LINE__) + temp1->readElem({t, x, y, (z + 6)}, temp2, __LINE__)) * temp6->readElem({6}, temp7, __LINE__));
+
+ // temp15 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)).
+ real_t temp15 = temp14 + ((temp1->readElem({t, (x - 7), y, z}, temp2, __LINE__) + temp1->readElem({t, (x + 7), y, z}, temp2, __LINE__) + temp1->readElem({t, x, (y - 7), z}, temp2, __LINE__) + temp1->readElem({t, x, (y + 7), z}, temp2, __LINE__) + temp1->readElem({t, x, y, (z - 7)}, temp2, __LINE__) + temp1->readElem({t, x, y, (z + 7)}, temp2, __LINE__)) * temp6->readElem({7}, temp7, __LINE__));
+
+ // temp16 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)) + ((pressure(t, (x - 8), y, z) + pressure(t, (x + 8), y, z) + pressure(t, x, (y - 8), z) + pressure(t, x, (y + 8), z) + pressure(t, x, y, (z - 8)) + pressure(t, x, y, (z + 8))) * coeff(8)).
+ real_t temp16 = temp15 + ((temp1->readElem({t, (x - 8), y, z}, temp2, __LINE__) + temp1->readElem({t, (x + 8), y, z}, temp2, __LINE__) + temp1->readElem({t, x, (y - 8), z}, temp2, __LINE__) + temp1->readElem({t, x, (y + 8), z}, temp2, __LINE__) + temp1->readElem({t, x, y, (z - 8)}, temp2, __LINE__) + temp1->readElem({t, x, y, (z + 8)}, temp2, __LINE__)) * temp6->readElem({8}, temp7, __LINE__));
+ auto temp17 = _context->vel;
+
+ // temp18 = ((pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)) + ((pressure(t, (x - 8), y, z) + pressure(t, (x + 8), y, z) + pressure(t, x, (y - 8), z) + pressure(t, x, (y + 8), z) + pressure(t, x, y, (z - 8)) + pressure(t, x, y, (z + 8))) * coeff(8))) * vel(x, y, z).
+ real_t temp18 = temp16 * temp17->readElem({x, y, z}, temp7, __LINE__);
+
+ // temp19 = ((2 * pressure(t, x, y, z)) - pressure((t - 1), x, y, z)) + (((pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)) + ((pressure(t, (x - 8), y, z) + pressure(t, (x + 8), y, z) + pressure(t, x, (y - 8), z) + pressure(t, x, (y + 8), z) + pressure(t, x, y, (z - 8)) + pressure(t, x, y, (z + 8))) * coeff(8))) * vel(x, y, z)).
+ real_t temp19 = temp5 + temp18;
+
+ // temp20 = (((2 * pressure(t, x, y, z)) - pressure((t - 1), x, y, z)) + (((pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)) + ((pressure(t, (x - 8), y, z) + pressure(t, (x + 8), y, z) + pressure(t, x, (y - 8), z) + pressure(t, x, (y + 8), z) + pressure(t, x, y, (z - 8)) + pressure(t, x, y, (z + 8))) * coeff(8))) * vel(x, y, z))).
+ real_t temp20 = temp19;
+
+ // Update value at pressure((t + 1), x, y, z).
+  auto temp21 = temp1->_wrap_step((t + 1));
+temp1->writeElem(temp20, {(t + 1), x, y, z}, temp21, __LINE__);
+} // calc_scalar.
+
+ // Calculate a series of vectors iterating in +'z' direction from t, x, y, z indices in 'idxs' to 'stop_z'.
+ // Each vector calculates 'x=1 * y=1 * z=1' point(s).
+ // Indices must be rank-relative (not global).
+ // Indices must be normalized, i.e., already divided by VLEN_*.
+ // SIMD calculations use 60 vector block(s) created from 60 aligned vector-block(s).
+ // There are approximately 61 FP operation(s) per iteration.
+ void calc_loop_of_vectors(const Indices& idxs, idx_t stop_z, idx_t write_mask) {
+
+ // Extract individual indices.
+ idx_t t = idxs[0];
+ idx_t x = idxs[1];
+ idx_t y = idxs[2];
+ idx_t z = idxs[3];
+ idx_t start_z = z;
+ idx_t step_z = 1; // number of vectors per iter.
+ idx_t step_z_elem = VLEN_Z; // number of elements per iter.
+ const idx_t pfd_l1 = _context->get_prefetch_dist(1); // L1 prefetch distance.
+ const idx_t pfd_l2 = _context->get_prefetch_dist(2); // L2 prefetch distance.
+
+ // Element indices derived from vector indices.
+ idx_t x_elem = _context->rank_domain_offsets[0] + (x * VLEN_X);
+ idx_t y_elem = _context->rank_domain_offsets[1] + (y * VLEN_Y);
+ idx_t z_elem = _context->rank_domain_offsets[2] + (z * VLEN_Z);
+
+ // Force inlining if possible.
+#if !defined(DEBUG) && defined(__INTEL_COMPILER)
+#pragma forceinline recursive
+#endif
+ {
+
+ // Read aligned vector starting at coeff(0).
+ auto temp1 = _context->coeff;
+ auto temp2 = 0;
+ real_vec_t temp3 = temp1->readVecNorm({0} ,temp2, __LINE__);
+
+ // temp4 = coeff(0).
+ real_vec_t temp4 = temp3;
+
+ // Read aligned vector starting at coeff(1).
+ real_vec_t temp5 = temp1->readVecNorm({1} ,temp2, __LINE__);
+
+ // temp6 = coeff(1).
+ real_vec_t temp6 = temp5;
+
+ // Read aligned vector starting at coeff(2).
+ real_vec_t temp7 = temp1->readVecNorm({2} ,temp2, __LINE__);
+
+ // temp8 = coeff(2).
+ real_vec_t temp8 = temp7;
+
+ // Read aligned vector starting at coeff(3).
+ real_vec_t temp9 = temp1->readVecNorm({3} ,temp2, __LINE__);
+
+ // temp10 = coeff(3).
+ real_vec_t temp10 = temp9;
+
+ // Read aligned vector starting at coeff(4).
+ real_vec_t temp11 = temp1->readVecNorm({4} ,temp2, __LINE__);
+
+ // temp12 = coeff(4).
+ real_vec_t temp12 = temp11;
+
+ // Read aligned vector starting at coeff(5).
+ real_vec_t temp13 = temp1->readVecNorm({5} ,temp2, __LINE__);
+
+ // temp14 = coeff(5).
+ real_vec_t temp14 = temp13;
+
+ // Read aligned vector starting at coeff(6).
+ real_vec_t temp15 = temp1->readVecNorm({6} ,temp2, __LINE__);
+
+ // temp16 = coeff(6).
+ real_vec_t temp16 = temp15;
+
+ // Read aligned vector starting at coeff(7).
+ real_vec_t temp17 = temp1->readVecNorm({7} ,temp2, __LINE__);
+
+ // temp18 = coeff(7).
+ real_vec_t temp18 = temp17;
+
+ // Read aligned vector starting at coeff(8).
+ real_vec_t temp19 = temp1->readVecNorm({8} ,temp2, __LINE__);
+
+ // temp20 = coeff(8).
+ real_vec_t temp20 = temp19;
+
+ // Calculate pointer to  vector starting at pressure((t - 1), x, y, 0).
+ auto temp57 = _context->pressure;
+ auto temp58 = temp57->_wrap_step((t - 1));
+ real_vec_t* temp21 = temp57->getVecPtrNorm({(t - 1), x, y, 0} ,temp58, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp21[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp21[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 8), y, 0).
+ auto temp59 = temp57->_wrap_step(t);
+ real_vec_t* temp22 = temp57->getVecPtrNorm({t, (x-(8 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp22[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp22[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 7), y, 0).
+ real_vec_t* temp23 = temp57->getVecPtrNorm({t, (x-(7 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp23[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp23[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 6), y, 0).
+ real_vec_t* temp24 = temp57->getVecPtrNorm({t, (x-(6 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp24[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp24[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 5), y, 0).
+ real_vec_t* temp25 = temp57->getVecPtrNorm({t, (x-(5 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp25[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp25[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 4), y, 0).
+ real_vec_t* temp26 = temp57->getVecPtrNorm({t, (x-(4 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp26[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp26[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 3), y, 0).
+ real_vec_t* temp27 = temp57->getVecPtrNorm({t, (x-(3 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp27[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp27[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 2), y, 0).
+ real_vec_t* temp28 = temp57->getVecPtrNorm({t, (x-(2 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp28[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp28[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 1), y, 0).
+ real_vec_t* temp29 = temp57->getVecPtrNorm({t, (x-(1 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp29[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp29[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 8), 0).
+ real_vec_t* temp30 = temp57->getVecPtrNorm({t, x, (y-(8 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp30[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp30[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 7), 0).
+ real_vec_t* temp31 = temp57->getVecPtrNorm({t, x, (y-(7 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp31[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp31[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 6), 0).
+ real_vec_t* temp32 = temp57->getVecPtrNorm({t, x, (y-(6 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp32[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp32[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 5), 0).
+ real_vec_t* temp33 = temp57->getVecPtrNorm({t, x, (y-(5 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp33[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp33[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 4), 0).
+ real_vec_t* temp34 = temp57->getVecPtrNorm({t, x, (y-(4 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp34[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp34[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 3), 0).
+ real_vec_t* temp35 = temp57->getVecPtrNorm({t, x, (y-(3 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp35[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp35[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 2), 0).
+ real_vec_t* temp36 = temp57->getVecPtrNorm({t, x, (y-(2 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp36[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp36[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 1), 0).
+ real_vec_t* temp37 = temp57->getVecPtrNorm({t, x, (y-(1 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp37[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp37[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, y, 0).
+ real_vec_t* temp38 = temp57->getVecPtrNorm({t, x, y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = -(8 / VLEN_Z); ofs < (pfd_l1*CMULT_Z)+(8 / VLEN_Z); ofs++)
+   prefetch<L1_HINT>(&temp38[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = -(8 / VLEN_Z); ofs < (pfd_l2*CMULT_Z)+(8 / VLEN_Z); ofs++)
+   prefetch<L2_HINT>(&temp38[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 1), 0).
+ real_vec_t* temp39 = temp57->getVecPtrNorm({t, x, (y+(1 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp39[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp39[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 2), 0).
+ real_vec_t* temp40 = temp57->getVecPtrNorm({t, x, (y+(2 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp40[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp40[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 3), 0).
+ real_vec_t* temp41 = temp57->getVecPtrNorm({t, x, (y+(3 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp41[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp41[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 4), 0).
+ real_vec_t* temp42 = temp57->getVecPtrNorm({t, x, (y+(4 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp42[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp42[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 5), 0).
+ real_vec_t* temp43 = temp57->getVecPtrNorm({t, x, (y+(5 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp43[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp43[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 6), 0).
+ real_vec_t* temp44 = temp57->getVecPtrNorm({t, x, (y+(6 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp44[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp44[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 7), 0).
+ real_vec_t* temp45 = temp57->getVecPtrNorm({t, x, (y+(7 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp45[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp45[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 8), 0).
+ real_vec_t* temp46 = temp57->getVecPtrNorm({t, x, (y+(8 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp46[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp46[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 1), y, 0).
+ real_vec_t* temp47 = temp57->getVecPtrNorm({t, (x+(1 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp47[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp47[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 2), y, 0).
+ real_vec_t* temp48 = temp57->getVecPtrNorm({t, (x+(2 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp48[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp48[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 3), y, 0).
+ real_vec_t* temp49 = temp57->getVecPtrNorm({t, (x+(3 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp49[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp49[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 4), y, 0).
+ real_vec_t* temp50 = temp57->getVecPtrNorm({t, (x+(4 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp50[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp50[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 5), y, 0).
+ real_vec_t* temp51 = temp57->getVecPtrNorm({t, (x+(5 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp51[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp51[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 6), y, 0).
+ real_vec_t* temp52 = temp57->getVecPtrNorm({t, (x+(6 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp52[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp52[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 7), y, 0).
+ real_vec_t* temp53 = temp57->getVecPtrNorm({t, (x+(7 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp53[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp53[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 8), y, 0).
+ real_vec_t* temp54 = temp57->getVecPtrNorm({t, (x+(8 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp54[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp54[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure((t + 1), x, y, 0).
+ auto temp60 = temp57->_wrap_step((t + 1));
+ real_vec_t* temp55 = temp57->getVecPtrNorm({(t + 1), x, y, 0} ,temp60, __LINE__);
+
+ // Calculate pointer to  vector starting at vel(x, y, 0).
+ auto temp61 = _context->vel;
+ real_vec_t* temp56 = temp61->getVecPtrNorm({x, y, 0} ,temp2, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp56[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp56[z + ofs]);
+ } // L2 prefetch.
+
+ // Inner loop.
+ for (idx_t z = start_z; z < stop_z; z += step_z, z_elem += step_z_elem) {
+
+ // Read aligned vector starting at pressure(t, x, y, z).
+ real_vec_t temp62 = temp38[z];
+
+ // Read aligned vector starting at pressure((t - 1), x, y, z).
+ real_vec_t temp63 = temp21[z];
+
+ // temp64 = 2 * pressure(t, x, y, z).
+ real_vec_t temp64 = 2.000000000000000e+00 * temp62;
+
+ // temp65 = ((2 * pressure(t, x, y, z)) - pressure((t - 1), x, y, z)).
+ real_vec_t temp65 = temp64 - temp63;
+
+ // temp66 = pressure(t, x, y, z) * coeff(0).
+ real_vec_t temp66 = temp62 * temp4;
+
+ // Read aligned vector starting at pressure(t, (x - 1), y, z).
+ real_vec_t temp67 = temp29[z];
+
+ // Read aligned vector starting at pressure(t, (x + 1), y, z).
+ real_vec_t temp68 = temp47[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 1), z).
+ real_vec_t temp69 = temp37[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 1), z).
+ real_vec_t temp70 = temp39[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 1)).
+ real_vec_t temp71 = temp38[(z-(1 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 1)).
+ real_vec_t temp72 = temp38[(z+(1 / VLEN_Z))];
+
+ // temp73 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)).
+ real_vec_t temp73 = temp66 + ((temp67 + temp68 + temp69 + temp70 + temp71 + temp72) * temp6);
+
+ // Read aligned vector starting at pressure(t, (x - 2), y, z).
+ real_vec_t temp74 = temp28[z];
+
+ // Read aligned vector starting at pressure(t, (x + 2), y, z).
+ real_vec_t temp75 = temp48[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 2), z).
+ real_vec_t temp76 = temp36[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 2), z).
+ real_vec_t temp77 = temp40[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 2)).
+ real_vec_t temp78 = temp38[(z-(2 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 2)).
+ real_vec_t temp79 = temp38[(z+(2 / VLEN_Z))];
+
+ // temp80 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)).
+ real_vec_t temp80 = temp73 + ((temp74 + temp75 + temp76 + temp77 + temp78 + temp79) * temp8);
+
+ // Read aligned vector starting at pressure(t, (x - 3), y, z).
+ real_vec_t temp81 = temp27[z];
+
+ // Read aligned vector starting at pressure(t, (x + 3), y, z).
+ real_vec_t temp82 = temp49[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 3), z).
+ real_vec_t temp83 = temp35[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 3), z).
+ real_vec_t temp84 = temp41[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 3)).
+ real_vec_t temp85 = temp38[(z-(3 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 3)).
+ real_vec_t temp86 = temp38[(z+(3 / VLEN_Z))];
+
+ // temp87 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)).
+ real_vec_t temp87 = temp80 + ((temp81 + temp82 + temp83 + temp84 + temp85 + temp86) * temp10);
+
+ // Read aligned vector starting at pressure(t, (x - 4), y, z).
+ real_vec_t temp88 = temp26[z];
+
+ // Read aligned vector starting at pressure(t, (x + 4), y, z).
+ real_vec_t temp89 = temp50[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 4), z).
+ real_vec_t temp90 = temp34[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 4), z).
+ real_vec_t temp91 = temp42[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 4)).
+ real_vec_t temp92 = temp38[(z-(4 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 4)).
+ real_vec_t temp93 = temp38[(z+(4 / VLEN_Z))];
+
+ // temp94 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)).
+ real_vec_t temp94 = temp87 + ((temp88 + temp89 + temp90 + temp91 + temp92 + temp93) * temp12);
+
+ // Read aligned vector starting at pressure(t, (x - 5), y, z).
+ real_vec_t temp95 = temp25[z];
+
+ // Read aligned vector starting at pressure(t, (x + 5), y, z).
+ real_vec_t temp96 = temp51[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 5), z).
+ real_vec_t temp97 = temp33[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 5), z).
+ real_vec_t temp98 = temp43[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 5)).
+ real_vec_t temp99 = temp38[(z-(5 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 5)).
+ real_vec_t temp100 = temp38[(z+(5 / VLEN_Z))];
+
+ // temp101 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)).
+ real_vec_t temp101 = temp94 + ((temp95 + temp96 + temp97 + temp98 + temp99 + temp100) * temp14);
+
+ // Read aligned vector starting at pressure(t, (x - 6), y, z).
+ real_vec_t temp102 = temp24[z];
+
+ // Read aligned vector starting at pressure(t, (x + 6), y, z).
+ real_vec_t temp103 = temp52[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 6), z).
+ real_vec_t temp104 = temp32[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 6), z).
+ real_vec_t temp105 = temp44[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 6)).
+ real_vec_t temp106 = temp38[(z-(6 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 6)).
+ real_vec_t temp107 = temp38[(z+(6 / VLEN_Z))];
+
+ // temp108 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)).
+ real_vec_t temp108 = temp101 + ((temp102 + temp103 + temp104 + temp105 + temp106 + temp107) * temp16);
+
+ // Read aligned vector starting at pressure(t, (x - 7), y, z).
+ real_vec_t temp109 = temp23[z];
+
+ // Read aligned vector starting at pressure(t, (x + 7), y, z).
+ real_vec_t temp110 = temp53[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 7), z).
+ real_vec_t temp111 = temp31[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 7), z).
+ real_vec_t temp112 = temp45[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 7)).
+ real_vec_t temp113 = temp38[(z-(7 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 7)).
+ real_vec_t temp114 = temp38[(z+(7 / VLEN_Z))];
+
+ // temp115 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)).
+ real_vec_t temp115 = temp108 + ((temp109 + temp110 + temp111 + temp112 + temp113 + temp114) * temp18);
+
+ // Read aligned vector starting at pressure(t, (x - 8), y, z).
+ real_vec_t temp116 = temp22[z];
+
+ // Read aligned vector starting at pressure(t, (x + 8), y, z).
+ real_vec_t temp117 = temp54[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 8), z).
+ real_vec_t temp118 = temp30[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 8), z).
+ real_vec_t temp119 = temp46[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 8)).
+ real_vec_t temp120 = temp38[(z-(8 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 8)).
+ real_vec_t temp121 = temp38[(z+(8 / VLEN_Z))];
+
+ // temp122 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)) + ((pressure(t, (x - 8), y, z) + pressure(t, (x + 8), y, z) + pressure(t, x, (y - 8), z) + pressure(t, x, (y + 8), z) + pressure(t, x, y, (z - 8)) + pressure(t, x, y, (z + 8))) * coeff(8)).
+ real_vec_t temp122 = temp115 + ((temp116 + temp117 + temp118 + temp119 + temp120 + temp121) * temp20);
+
+ // Read aligned vector starting at vel(x, y, z).
+ real_vec_t temp123 = temp56[z];
+
+ // temp124 = ((pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)) + ((pressure(t, (x - 8), y, z) + pressure(t, (x + 8), y, z) + pressure(t, x, (y - 8), z) + pressure(t, x, (y + 8), z) + pressure(t, x, y, (z - 8)) + pressure(t, x, y, (z + 8))) * coeff(8))) * vel(x, y, z).
+ real_vec_t temp124 = temp122 * temp123;
+
+ // temp125 = ((2 * pressure(t, x, y, z)) - pressure((t - 1), x, y, z)) + (((pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)) + ((pressure(t, (x - 8), y, z) + pressure(t, (x + 8), y, z) + pressure(t, x, (y - 8), z) + pressure(t, x, (y + 8), z) + pressure(t, x, y, (z - 8)) + pressure(t, x, y, (z + 8))) * coeff(8))) * vel(x, y, z)).
+ real_vec_t temp125 = temp65 + temp124;
+
+ // temp126 = (((2 * pressure(t, x, y, z)) - pressure((t - 1), x, y, z)) + (((pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)) + ((pressure(t, (x - 8), y, z) + pressure(t, (x + 8), y, z) + pressure(t, x, (y - 8), z) + pressure(t, x, (y + 8), z) + pressure(t, x, y, (z - 8)) + pressure(t, x, y, (z + 8))) * coeff(8))) * vel(x, y, z))).
+ real_vec_t temp126 = temp125;
+
+ // Update value at pressure((t + 1), x, y, z).
+ 
+ // Write aligned vector starting at pressure((t + 1), x, y, z).
+ temp126.storeTo_masked(temp55+z, write_mask);
+;
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp21[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp22[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp23[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp24[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp25[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp26[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp27[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp28[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp29[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp30[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp31[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp32[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp33[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp34[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp35[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp36[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp37[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z)+(8 / VLEN_Z); ofs < ((pfd_l1+1)*CMULT_Z)+(8 / VLEN_Z); ofs++)
+   prefetch<L1_HINT>(&temp38[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp39[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp40[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp41[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp42[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp43[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp44[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp45[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp46[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp47[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp48[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp49[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp50[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp51[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp52[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp53[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp54[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp55[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp56[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp21[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp22[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp23[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp24[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp25[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp26[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp27[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp28[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp29[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp30[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp31[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp32[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp33[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp34[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp35[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp36[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp37[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z)+(8 / VLEN_Z); ofs < ((pfd_l2+1)*CMULT_Z)+(8 / VLEN_Z); ofs++)
+   prefetch<L2_HINT>(&temp38[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp39[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp40[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp41[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp42[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp43[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp44[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp45[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp46[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp47[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp48[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp49[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp50[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp51[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp52[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp53[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp54[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp55[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp56[z + ofs]);
+ } // L2 prefetch.
+ } // 'z' loop.
+ } // Forced-inline block.
+} // calc_loop_of_vectors.
+
+ // Calculate a series of clusters iterating in +'z' direction from t, x, y, z indices in 'idxs' to 'stop_z'.
+ // Each cluster calculates 'x=1 * y=1 * z=1' point(s) containing 1 'x=1 * y=1 * z=1' vector(s).
+ // Indices must be rank-relative (not global).
+ // Indices must be normalized, i.e., already divided by VLEN_*.
+ // SIMD calculations use 60 vector block(s) created from 60 aligned vector-block(s).
+ // There are approximately 61 FP operation(s) per iteration.
+ void calc_loop_of_clusters(const Indices& idxs, idx_t stop_z) {
+
+ // Extract individual indices.
+ idx_t t = idxs[0];
+ idx_t x = idxs[1];
+ idx_t y = idxs[2];
+ idx_t z = idxs[3];
+ idx_t start_z = z;
+ idx_t step_z = CMULT_Z; // number of vectors per iter.
+ idx_t step_z_elem = CMULT_Z * VLEN_Z; // number of elements per iter.
+ idx_t write_mask = idx_t(-1); // no masking for clusters.
+ const idx_t pfd_l1 = _context->get_prefetch_dist(1); // L1 prefetch distance.
+ const idx_t pfd_l2 = _context->get_prefetch_dist(2); // L2 prefetch distance.
+
+ // Element indices derived from vector indices.
+ idx_t x_elem = _context->rank_domain_offsets[0] + (x * VLEN_X);
+ idx_t y_elem = _context->rank_domain_offsets[1] + (y * VLEN_Y);
+ idx_t z_elem = _context->rank_domain_offsets[2] + (z * VLEN_Z);
+
+ // Force inlining if possible.
+#if !defined(DEBUG) && defined(__INTEL_COMPILER)
+#pragma forceinline recursive
+#endif
+ {
+
+ // Read aligned vector starting at coeff(0).
+ auto temp1 = _context->coeff;
+ auto temp2 = 0;
+ real_vec_t temp3 = temp1->readVecNorm({0} ,temp2, __LINE__);
+
+ // temp4 = coeff(0).
+ real_vec_t temp4 = temp3;
+
+ // Read aligned vector starting at coeff(1).
+ real_vec_t temp5 = temp1->readVecNorm({1} ,temp2, __LINE__);
+
+ // temp6 = coeff(1).
+ real_vec_t temp6 = temp5;
+
+ // Read aligned vector starting at coeff(2).
+ real_vec_t temp7 = temp1->readVecNorm({2} ,temp2, __LINE__);
+
+ // temp8 = coeff(2).
+ real_vec_t temp8 = temp7;
+
+ // Read aligned vector starting at coeff(3).
+ real_vec_t temp9 = temp1->readVecNorm({3} ,temp2, __LINE__);
+
+ // temp10 = coeff(3).
+ real_vec_t temp10 = temp9;
+
+ // Read aligned vector starting at coeff(4).
+ real_vec_t temp11 = temp1->readVecNorm({4} ,temp2, __LINE__);
+
+ // temp12 = coeff(4).
+ real_vec_t temp12 = temp11;
+
+ // Read aligned vector starting at coeff(5).
+ real_vec_t temp13 = temp1->readVecNorm({5} ,temp2, __LINE__);
+
+ // temp14 = coeff(5).
+ real_vec_t temp14 = temp13;
+
+ // Read aligned vector starting at coeff(6).
+ real_vec_t temp15 = temp1->readVecNorm({6} ,temp2, __LINE__);
+
+ // temp16 = coeff(6).
+ real_vec_t temp16 = temp15;
+
+ // Read aligned vector starting at coeff(7).
+ real_vec_t temp17 = temp1->readVecNorm({7} ,temp2, __LINE__);
+
+ // temp18 = coeff(7).
+ real_vec_t temp18 = temp17;
+
+ // Read aligned vector starting at coeff(8).
+ real_vec_t temp19 = temp1->readVecNorm({8} ,temp2, __LINE__);
+
+ // temp20 = coeff(8).
+ real_vec_t temp20 = temp19;
+
+ // Calculate pointer to  vector starting at pressure((t - 1), x, y, 0).
+ auto temp57 = _context->pressure;
+ auto temp58 = temp57->_wrap_step((t - 1));
+ real_vec_t* temp21 = temp57->getVecPtrNorm({(t - 1), x, y, 0} ,temp58, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp21[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp21[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 8), y, 0).
+ auto temp59 = temp57->_wrap_step(t);
+ real_vec_t* temp22 = temp57->getVecPtrNorm({t, (x-(8 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp22[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp22[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 7), y, 0).
+ real_vec_t* temp23 = temp57->getVecPtrNorm({t, (x-(7 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp23[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp23[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 6), y, 0).
+ real_vec_t* temp24 = temp57->getVecPtrNorm({t, (x-(6 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp24[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp24[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 5), y, 0).
+ real_vec_t* temp25 = temp57->getVecPtrNorm({t, (x-(5 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp25[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp25[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 4), y, 0).
+ real_vec_t* temp26 = temp57->getVecPtrNorm({t, (x-(4 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp26[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp26[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 3), y, 0).
+ real_vec_t* temp27 = temp57->getVecPtrNorm({t, (x-(3 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp27[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp27[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 2), y, 0).
+ real_vec_t* temp28 = temp57->getVecPtrNorm({t, (x-(2 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp28[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp28[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x - 1), y, 0).
+ real_vec_t* temp29 = temp57->getVecPtrNorm({t, (x-(1 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp29[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp29[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 8), 0).
+ real_vec_t* temp30 = temp57->getVecPtrNorm({t, x, (y-(8 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp30[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp30[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 7), 0).
+ real_vec_t* temp31 = temp57->getVecPtrNorm({t, x, (y-(7 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp31[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp31[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 6), 0).
+ real_vec_t* temp32 = temp57->getVecPtrNorm({t, x, (y-(6 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp32[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp32[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 5), 0).
+ real_vec_t* temp33 = temp57->getVecPtrNorm({t, x, (y-(5 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp33[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp33[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 4), 0).
+ real_vec_t* temp34 = temp57->getVecPtrNorm({t, x, (y-(4 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp34[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp34[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 3), 0).
+ real_vec_t* temp35 = temp57->getVecPtrNorm({t, x, (y-(3 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp35[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp35[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 2), 0).
+ real_vec_t* temp36 = temp57->getVecPtrNorm({t, x, (y-(2 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp36[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp36[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y - 1), 0).
+ real_vec_t* temp37 = temp57->getVecPtrNorm({t, x, (y-(1 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp37[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp37[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, y, 0).
+ real_vec_t* temp38 = temp57->getVecPtrNorm({t, x, y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = -(8 / VLEN_Z); ofs < (pfd_l1*CMULT_Z)+(8 / VLEN_Z); ofs++)
+   prefetch<L1_HINT>(&temp38[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = -(8 / VLEN_Z); ofs < (pfd_l2*CMULT_Z)+(8 / VLEN_Z); ofs++)
+   prefetch<L2_HINT>(&temp38[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 1), 0).
+ real_vec_t* temp39 = temp57->getVecPtrNorm({t, x, (y+(1 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp39[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp39[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 2), 0).
+ real_vec_t* temp40 = temp57->getVecPtrNorm({t, x, (y+(2 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp40[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp40[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 3), 0).
+ real_vec_t* temp41 = temp57->getVecPtrNorm({t, x, (y+(3 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp41[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp41[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 4), 0).
+ real_vec_t* temp42 = temp57->getVecPtrNorm({t, x, (y+(4 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp42[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp42[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 5), 0).
+ real_vec_t* temp43 = temp57->getVecPtrNorm({t, x, (y+(5 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp43[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp43[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 6), 0).
+ real_vec_t* temp44 = temp57->getVecPtrNorm({t, x, (y+(6 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp44[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp44[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 7), 0).
+ real_vec_t* temp45 = temp57->getVecPtrNorm({t, x, (y+(7 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp45[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp45[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, x, (y + 8), 0).
+ real_vec_t* temp46 = temp57->getVecPtrNorm({t, x, (y+(8 / VLEN_Y)), 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp46[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp46[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 1), y, 0).
+ real_vec_t* temp47 = temp57->getVecPtrNorm({t, (x+(1 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp47[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp47[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 2), y, 0).
+ real_vec_t* temp48 = temp57->getVecPtrNorm({t, (x+(2 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp48[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp48[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 3), y, 0).
+ real_vec_t* temp49 = temp57->getVecPtrNorm({t, (x+(3 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp49[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp49[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 4), y, 0).
+ real_vec_t* temp50 = temp57->getVecPtrNorm({t, (x+(4 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp50[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp50[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 5), y, 0).
+ real_vec_t* temp51 = temp57->getVecPtrNorm({t, (x+(5 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp51[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp51[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 6), y, 0).
+ real_vec_t* temp52 = temp57->getVecPtrNorm({t, (x+(6 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp52[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp52[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 7), y, 0).
+ real_vec_t* temp53 = temp57->getVecPtrNorm({t, (x+(7 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp53[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp53[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure(t, (x + 8), y, 0).
+ real_vec_t* temp54 = temp57->getVecPtrNorm({t, (x+(8 / VLEN_X)), y, 0} ,temp59, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp54[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp54[z + ofs]);
+ } // L2 prefetch.
+
+ // Calculate pointer to  vector starting at pressure((t + 1), x, y, 0).
+ auto temp60 = temp57->_wrap_step((t + 1));
+ real_vec_t* temp55 = temp57->getVecPtrNorm({(t + 1), x, y, 0} ,temp60, __LINE__);
+
+ // Calculate pointer to  vector starting at vel(x, y, 0).
+ auto temp61 = _context->vel;
+ real_vec_t* temp56 = temp61->getVecPtrNorm({x, y, 0} ,temp2, __LINE__);
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l1*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp56[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = 0; ofs < (pfd_l2*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp56[z + ofs]);
+ } // L2 prefetch.
+
+ // Inner loop.
+ for (idx_t z = start_z; z < stop_z; z += step_z, z_elem += step_z_elem) {
+
+ // Read aligned vector starting at pressure(t, x, y, z).
+ real_vec_t temp62 = temp38[z];
+
+ // Read aligned vector starting at pressure((t - 1), x, y, z).
+ real_vec_t temp63 = temp21[z];
+
+ // temp64 = 2 * pressure(t, x, y, z).
+ real_vec_t temp64 = 2.000000000000000e+00 * temp62;
+
+ // temp65 = ((2 * pressure(t, x, y, z)) - pressure((t - 1), x, y, z)).
+ real_vec_t temp65 = temp64 - temp63;
+
+ // temp66 = pressure(t, x, y, z) * coeff(0).
+ real_vec_t temp66 = temp62 * temp4;
+
+ // Read aligned vector starting at pressure(t, (x - 1), y, z).
+ real_vec_t temp67 = temp29[z];
+
+ // Read aligned vector starting at pressure(t, (x + 1), y, z).
+ real_vec_t temp68 = temp47[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 1), z).
+ real_vec_t temp69 = temp37[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 1), z).
+ real_vec_t temp70 = temp39[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 1)).
+ real_vec_t temp71 = temp38[(z-(1 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 1)).
+ real_vec_t temp72 = temp38[(z+(1 / VLEN_Z))];
+
+ // temp73 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)).
+ real_vec_t temp73 = temp66 + ((temp67 + temp68 + temp69 + temp70 + temp71 + temp72) * temp6);
+
+ // Read aligned vector starting at pressure(t, (x - 2), y, z).
+ real_vec_t temp74 = temp28[z];
+
+ // Read aligned vector starting at pressure(t, (x + 2), y, z).
+ real_vec_t temp75 = temp48[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 2), z).
+ real_vec_t temp76 = temp36[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 2), z).
+ real_vec_t temp77 = temp40[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 2)).
+ real_vec_t temp78 = temp38[(z-(2 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 2)).
+ real_vec_t temp79 = temp38[(z+(2 / VLEN_Z))];
+
+ // temp80 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)).
+ real_vec_t temp80 = temp73 + ((temp74 + temp75 + temp76 + temp77 + temp78 + temp79) * temp8);
+
+ // Read aligned vector starting at pressure(t, (x - 3), y, z).
+ real_vec_t temp81 = temp27[z];
+
+ // Read aligned vector starting at pressure(t, (x + 3), y, z).
+ real_vec_t temp82 = temp49[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 3), z).
+ real_vec_t temp83 = temp35[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 3), z).
+ real_vec_t temp84 = temp41[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 3)).
+ real_vec_t temp85 = temp38[(z-(3 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 3)).
+ real_vec_t temp86 = temp38[(z+(3 / VLEN_Z))];
+
+ // temp87 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)).
+ real_vec_t temp87 = temp80 + ((temp81 + temp82 + temp83 + temp84 + temp85 + temp86) * temp10);
+
+ // Read aligned vector starting at pressure(t, (x - 4), y, z).
+ real_vec_t temp88 = temp26[z];
+
+ // Read aligned vector starting at pressure(t, (x + 4), y, z).
+ real_vec_t temp89 = temp50[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 4), z).
+ real_vec_t temp90 = temp34[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 4), z).
+ real_vec_t temp91 = temp42[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 4)).
+ real_vec_t temp92 = temp38[(z-(4 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 4)).
+ real_vec_t temp93 = temp38[(z+(4 / VLEN_Z))];
+
+ // temp94 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)).
+ real_vec_t temp94 = temp87 + ((temp88 + temp89 + temp90 + temp91 + temp92 + temp93) * temp12);
+
+ // Read aligned vector starting at pressure(t, (x - 5), y, z).
+ real_vec_t temp95 = temp25[z];
+
+ // Read aligned vector starting at pressure(t, (x + 5), y, z).
+ real_vec_t temp96 = temp51[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 5), z).
+ real_vec_t temp97 = temp33[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 5), z).
+ real_vec_t temp98 = temp43[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 5)).
+ real_vec_t temp99 = temp38[(z-(5 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 5)).
+ real_vec_t temp100 = temp38[(z+(5 / VLEN_Z))];
+
+ // temp101 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)).
+ real_vec_t temp101 = temp94 + ((temp95 + temp96 + temp97 + temp98 + temp99 + temp100) * temp14);
+
+ // Read aligned vector starting at pressure(t, (x - 6), y, z).
+ real_vec_t temp102 = temp24[z];
+
+ // Read aligned vector starting at pressure(t, (x + 6), y, z).
+ real_vec_t temp103 = temp52[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 6), z).
+ real_vec_t temp104 = temp32[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 6), z).
+ real_vec_t temp105 = temp44[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 6)).
+ real_vec_t temp106 = temp38[(z-(6 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 6)).
+ real_vec_t temp107 = temp38[(z+(6 / VLEN_Z))];
+
+ // temp108 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)).
+ real_vec_t temp108 = temp101 + ((temp102 + temp103 + temp104 + temp105 + temp106 + temp107) * temp16);
+
+ // Read aligned vector starting at pressure(t, (x - 7), y, z).
+ real_vec_t temp109 = temp23[z];
+
+ // Read aligned vector starting at pressure(t, (x + 7), y, z).
+ real_vec_t temp110 = temp53[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 7), z).
+ real_vec_t temp111 = temp31[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 7), z).
+ real_vec_t temp112 = temp45[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 7)).
+ real_vec_t temp113 = temp38[(z-(7 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 7)).
+ real_vec_t temp114 = temp38[(z+(7 / VLEN_Z))];
+
+ // temp115 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)).
+ real_vec_t temp115 = temp108 + ((temp109 + temp110 + temp111 + temp112 + temp113 + temp114) * temp18);
+
+ // Read aligned vector starting at pressure(t, (x - 8), y, z).
+ real_vec_t temp116 = temp22[z];
+
+ // Read aligned vector starting at pressure(t, (x + 8), y, z).
+ real_vec_t temp117 = temp54[z];
+
+ // Read aligned vector starting at pressure(t, x, (y - 8), z).
+ real_vec_t temp118 = temp30[z];
+
+ // Read aligned vector starting at pressure(t, x, (y + 8), z).
+ real_vec_t temp119 = temp46[z];
+
+ // Read aligned vector starting at pressure(t, x, y, (z - 8)).
+ real_vec_t temp120 = temp38[(z-(8 / VLEN_Z))];
+
+ // Read aligned vector starting at pressure(t, x, y, (z + 8)).
+ real_vec_t temp121 = temp38[(z+(8 / VLEN_Z))];
+
+ // temp122 = (pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)) + ((pressure(t, (x - 8), y, z) + pressure(t, (x + 8), y, z) + pressure(t, x, (y - 8), z) + pressure(t, x, (y + 8), z) + pressure(t, x, y, (z - 8)) + pressure(t, x, y, (z + 8))) * coeff(8)).
+ real_vec_t temp122 = temp115 + ((temp116 + temp117 + temp118 + temp119 + temp120 + temp121) * temp20);
+
+ // Read aligned vector starting at vel(x, y, z).
+ real_vec_t temp123 = temp56[z];
+
+ // temp124 = ((pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)) + ((pressure(t, (x - 8), y, z) + pressure(t, (x + 8), y, z) + pressure(t, x, (y - 8), z) + pressure(t, x, (y + 8), z) + pressure(t, x, y, (z - 8)) + pressure(t, x, y, (z + 8))) * coeff(8))) * vel(x, y, z).
+ real_vec_t temp124 = temp122 * temp123;
+
+ // temp125 = ((2 * pressure(t, x, y, z)) - pressure((t - 1), x, y, z)) + (((pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)) + ((pressure(t, (x - 8), y, z) + pressure(t, (x + 8), y, z) + pressure(t, x, (y - 8), z) + pressure(t, x, (y + 8), z) + pressure(t, x, y, (z - 8)) + pressure(t, x, y, (z + 8))) * coeff(8))) * vel(x, y, z)).
+ real_vec_t temp125 = temp65 + temp124;
+
+ // temp126 = (((2 * pressure(t, x, y, z)) - pressure((t - 1), x, y, z)) + (((pressure(t, x, y, z) * coeff(0)) + ((pressure(t, (x - 1), y, z) + pressure(t, (x + 1), y, z) + pressure(t, x, (y - 1), z) + pressure(t, x, (y + 1), z) + pressure(t, x, y, (z - 1)) + pressure(t, x, y, (z + 1))) * coeff(1)) + ((pressure(t, (x - 2), y, z) + pressure(t, (x + 2), y, z) + pressure(t, x, (y - 2), z) + pressure(t, x, (y + 2), z) + pressure(t, x, y, (z - 2)) + pressure(t, x, y, (z + 2))) * coeff(2)) + ((pressure(t, (x - 3), y, z) + pressure(t, (x + 3), y, z) + pressure(t, x, (y - 3), z) + pressure(t, x, (y + 3), z) + pressure(t, x, y, (z - 3)) + pressure(t, x, y, (z + 3))) * coeff(3)) + ((pressure(t, (x - 4), y, z) + pressure(t, (x + 4), y, z) + pressure(t, x, (y - 4), z) + pressure(t, x, (y + 4), z) + pressure(t, x, y, (z - 4)) + pressure(t, x, y, (z + 4))) * coeff(4)) + ((pressure(t, (x - 5), y, z) + pressure(t, (x + 5), y, z) + pressure(t, x, (y - 5), z) + pressure(t, x, (y + 5), z) + pressure(t, x, y, (z - 5)) + pressure(t, x, y, (z + 5))) * coeff(5)) + ((pressure(t, (x - 6), y, z) + pressure(t, (x + 6), y, z) + pressure(t, x, (y - 6), z) + pressure(t, x, (y + 6), z) + pressure(t, x, y, (z - 6)) + pressure(t, x, y, (z + 6))) * coeff(6)) + ((pressure(t, (x - 7), y, z) + pressure(t, (x + 7), y, z) + pressure(t, x, (y - 7), z) + pressure(t, x, (y + 7), z) + pressure(t, x, y, (z - 7)) + pressure(t, x, y, (z + 7))) * coeff(7)) + ((pressure(t, (x - 8), y, z) + pressure(t, (x + 8), y, z) + pressure(t, x, (y - 8), z) + pressure(t, x, (y + 8), z) + pressure(t, x, y, (z - 8)) + pressure(t, x, y, (z + 8))) * coeff(8))) * vel(x, y, z))).
+ real_vec_t temp126 = temp125;
+
+ // Update value at pressure((t + 1), x, y, z).
+ 
+ // Write aligned vector starting at pressure((t + 1), x, y, z).
+ temp126.storeTo_masked(temp55+z, write_mask);
+;
+
+ // Prefetch to L1 cache if enabled.
+ if (pfd_l1 > 0) {
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp21[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp22[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp23[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp24[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp25[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp26[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp27[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp28[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp29[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp30[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp31[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp32[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp33[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp34[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp35[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp36[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp37[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z)+(8 / VLEN_Z); ofs < ((pfd_l1+1)*CMULT_Z)+(8 / VLEN_Z); ofs++)
+   prefetch<L1_HINT>(&temp38[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp39[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp40[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp41[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp42[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp43[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp44[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp45[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp46[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp47[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp48[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp49[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp50[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp51[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp52[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp53[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp54[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp55[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l1*CMULT_Z); ofs < ((pfd_l1+1)*CMULT_Z); ofs++)
+   prefetch<L1_HINT>(&temp56[z + ofs]);
+ } // L1 prefetch.
+
+ // Prefetch to L2 cache if enabled.
+ if (pfd_l2 > 0) {
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp21[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp22[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp23[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp24[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp25[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp26[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp27[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp28[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp29[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp30[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp31[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp32[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp33[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp34[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp35[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp36[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp37[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z)+(8 / VLEN_Z); ofs < ((pfd_l2+1)*CMULT_Z)+(8 / VLEN_Z); ofs++)
+   prefetch<L2_HINT>(&temp38[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp39[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp40[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp41[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp42[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp43[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp44[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp45[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp46[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp47[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp48[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp49[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp50[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp51[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp52[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp53[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp54[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp55[z + ofs]);
+#pragma unroll
+  for (int ofs = (pfd_l2*CMULT_Z); ofs < ((pfd_l2+1)*CMULT_Z); ofs++)
+   prefetch<L2_HINT>(&temp56[z + ofs]);
+ } // L2 prefetch.
+ } // 'z' loop.
+ } // Forced-inline block.
+} // calc_loop_of_clusters.
+}; // StencilGroup_stencil_0.
+
+ ////// Overall stencil-specific context //////
+struct StencilContext_iso3dfd : public StencilContext_iso3dfd_data {
+
+ // Stencil equation-groups.
+ StencilGroup_stencil_0 stencilGroup_stencil_0;
+
+ // Constructor.
+ StencilContext_iso3dfd(KernelEnvPtr env, KernelSettingsPtr settings) : StencilContext_iso3dfd_data(env, settings),
+  stencilGroup_stencil_0(this) {
+
+ // Stencil groups.
+  stGroups.push_back(&stencilGroup_stencil_0);
+ } // Ctor.
+
+  // Create Dims object.
+  static DimsPtr new_dims() {
+    auto p = std::make_shared<Dims>();
+    p->_step_dim = "t";
+    p->_inner_dim = "z";
+    p->_domain_dims.addDimBack("x", 0);
+    p->_domain_dims.addDimBack("y", 0);
+    p->_domain_dims.addDimBack("z", 0);
+    p->_stencil_dims.addDimBack("t", 0);
+    p->_stencil_dims.addDimBack("x", 0);
+    p->_stencil_dims.addDimBack("y", 0);
+    p->_stencil_dims.addDimBack("z", 0);
+    p->_misc_dims.addDimBack("r", 0);
+    p->_fold_pts.addDimBack("x", 1);
+    p->_fold_pts.addDimBack("y", 1);
+    p->_fold_pts.addDimBack("z", 1);
+    p->_fold_pts.setFirstInner(true);
+    p->_vec_fold_pts.setFirstInner(true);
+    p->_cluster_pts.addDimBack("x", 1);
+    p->_cluster_pts.addDimBack("y", 1);
+    p->_cluster_pts.addDimBack("z", 1);
+    p->_cluster_mults.addDimBack("x", 1);
+    p->_cluster_mults.addDimBack("y", 1);
+    p->_cluster_mults.addDimBack("z", 1);
+    p->_step_dir = 1;
+    return p;
+  }
+}; // StencilContext_iso3dfd
+} // namespace yask.
+#endif // DEFINE_CONTEXT
+
+//End of automatically-generated code.
@@ -0,0 +1,183 @@
+/*
+ * 4-D grid-scanning code.
+ * Generated automatically from the following pseudo-code:
+ *
+ * N = 3;
+ * Variant 0:
+ * square_wave serpentine loop(1 .. N-2) {  call(calc_inner_loop); } 
+ * Variant 1:
+ *  serpentine loop(1 .. N-2) {  call(calc_inner_loop); } 
+ * Variant 2:
+ *  loop(1 .. N-2) {  call(calc_inner_loop); }
+ *
+ */ #ifndef OMP_PRAGMA_PREFIX
+ #define OMP_PRAGMA_PREFIX omp parallel for
+ #endif
+ #ifndef OMP_PRAGMA_SUFFIX
+ #define OMP_PRAGMA_SUFFIX
+ #endif
+
+ // 'ScanIndices norm_sub_block_idxs' must be set before the following code.
+
+ // Select one of 3 loop variants.
+ switch (opts->_sub_block_loop_variant) {
+ default:
+ case 0:
+ {
+
+  // Indices for function calls.
+  ScanIndices local_indices(norm_sub_block_idxs);
+
+  // ** Begin scan over dimensions 1, 2. **
+
+  // Number of iterations to get from norm_sub_block_idxs.begin[1] to (but not including) norm_sub_block_idxs.end[1], stepping by norm_sub_block_idxs.step[1]. This value is rounded up because the last iteration may cover fewer than norm_sub_block_idxs.step[1] steps.
+  const idx_t num_iters_1 = ((norm_sub_block_idxs.end[1] - norm_sub_block_idxs.begin[1]) + (norm_sub_block_idxs.step[1] - 1)) / norm_sub_block_idxs.step[1];
+
+  // Number of iterations to get from norm_sub_block_idxs.begin[2] to (but not including) norm_sub_block_idxs.end[2], stepping by norm_sub_block_idxs.step[2]. This value is rounded up because the last iteration may cover fewer than norm_sub_block_idxs.step[2] steps.
+  const idx_t num_iters_2 = ((norm_sub_block_idxs.end[2] - norm_sub_block_idxs.begin[2]) + (norm_sub_block_idxs.step[2] - 1)) / norm_sub_block_idxs.step[2];
+
+  // Number of iterations in dimensions 1, 2
+  const idx_t num_iters_1_2 = num_iters_1 * num_iters_2;
+
+  // Inner loop.
+ 
+  for (idx_t loop_index_1_2 = 0; loop_index_1_2 < num_iters_1_2; loop_index_1_2++) {
+
+  // Zero-based, unit-stride index for dimension 1.
+  idx_t index_1 = loop_index_1_2 / num_iters_2;
+
+  // Zero-based, unit-stride index for dimension 2.
+  idx_t index_2 = (loop_index_1_2) % num_iters_2;
+
+  // Modify index_1 and index_2 for 'square_wave' path.
+  if ((num_iters_2 > 1) && (index_1/2 < num_iters_1/2)) {
+
+   // Compute extended index over 2 iterations of index_1.
+   idx_t index_x2 = index_2 + (num_iters_2 * (index_1 & 1));
+
+   // Select index_2 from 0,0,1,1,2,2,... sequence
+   index_2 = index_x2 / 2;
+
+   // Select index_1 adjustment value from 0,1,1,0,0,1,1, ... sequence.
+   idx_t lsb = (index_x2 & 0x1) ^ ((index_x2 & 0x2) >> 1);
+
+   // Adjust index_1 +/-1 by replacing bit 0.
+   index_1 = (index_1 & (idx_t)-2) | lsb;
+  } // square-wave.
+
+  // Reverse direction of index_2 after every-other iteration of index_1 for 'square_wave serpentine' path.
+  if ((index_1 & 2) == 2) index_2 = num_iters_2 - index_2 - 1;
+
+  // This value of index_1 covers dimension 1 from start_1 to stop_1-1.
+  idx_t start_1 = norm_sub_block_idxs.begin[1] + (index_1 * norm_sub_block_idxs.step[1]);
+  idx_t stop_1 = std::min(start_1 + norm_sub_block_idxs.step[1], norm_sub_block_idxs.end[1]);
+
+  // This value of index_2 covers dimension 2 from start_2 to stop_2-1.
+  idx_t start_2 = norm_sub_block_idxs.begin[2] + (index_2 * norm_sub_block_idxs.step[2]);
+  idx_t stop_2 = std::min(start_2 + norm_sub_block_idxs.step[2], norm_sub_block_idxs.end[2]);
+  local_indices.start[1] = start_1;
+  local_indices.stop[1] = stop_1;
+  local_indices.index[1] = index_1;
+  local_indices.start[2] = start_2;
+  local_indices.stop[2] = stop_2;
+  local_indices.index[2] = index_2;
+   calc_inner_loop(local_indices);
+  }
+ }
+ break;
+ case 1:
+ {
+
+  // Indices for function calls.
+  ScanIndices local_indices(norm_sub_block_idxs);
+
+  // ** Begin scan over dimensions 1, 2. **
+
+  // Number of iterations to get from norm_sub_block_idxs.begin[1] to (but not including) norm_sub_block_idxs.end[1], stepping by norm_sub_block_idxs.step[1]. This value is rounded up because the last iteration may cover fewer than norm_sub_block_idxs.step[1] steps.
+  const idx_t num_iters_1 = ((norm_sub_block_idxs.end[1] - norm_sub_block_idxs.begin[1]) + (norm_sub_block_idxs.step[1] - 1)) / norm_sub_block_idxs.step[1];
+
+  // Number of iterations to get from norm_sub_block_idxs.begin[2] to (but not including) norm_sub_block_idxs.end[2], stepping by norm_sub_block_idxs.step[2]. This value is rounded up because the last iteration may cover fewer than norm_sub_block_idxs.step[2] steps.
+  const idx_t num_iters_2 = ((norm_sub_block_idxs.end[2] - norm_sub_block_idxs.begin[2]) + (norm_sub_block_idxs.step[2] - 1)) / norm_sub_block_idxs.step[2];
+
+  // Number of iterations in dimensions 1, 2
+  const idx_t num_iters_1_2 = num_iters_1 * num_iters_2;
+
+  // Inner loop.
+ 
+  for (idx_t loop_index_1_2 = 0; loop_index_1_2 < num_iters_1_2; loop_index_1_2++) {
+
+  // Zero-based, unit-stride index for dimension 1.
+  idx_t index_1 = loop_index_1_2 / num_iters_2;
+
+  // Zero-based, unit-stride index for dimension 2.
+  idx_t index_2 = (loop_index_1_2) % num_iters_2;
+
+  // Reverse direction of index_2 after every iteration of index_1 for  'serpentine' path.
+  if ((index_1 & 1) == 1) index_2 = num_iters_2 - index_2 - 1;
+
+  // This value of index_1 covers dimension 1 from start_1 to stop_1-1.
+  idx_t start_1 = norm_sub_block_idxs.begin[1] + (index_1 * norm_sub_block_idxs.step[1]);
+  idx_t stop_1 = std::min(start_1 + norm_sub_block_idxs.step[1], norm_sub_block_idxs.end[1]);
+
+  // This value of index_2 covers dimension 2 from start_2 to stop_2-1.
+  idx_t start_2 = norm_sub_block_idxs.begin[2] + (index_2 * norm_sub_block_idxs.step[2]);
+  idx_t stop_2 = std::min(start_2 + norm_sub_block_idxs.step[2], norm_sub_block_idxs.end[2]);
+  local_indices.start[1] = start_1;
+  local_indices.stop[1] = stop_1;
+  local_indices.index[1] = index_1;
+  local_indices.start[2] = start_2;
+  local_indices.stop[2] = stop_2;
+  local_indices.index[2] = index_2;
+   calc_inner_loop(local_indices);
+  }
+ }
+ break;
+ case 2:
+ {
+
+  // Indices for function calls.
+  ScanIndices local_indices(norm_sub_block_idxs);
+
+  // ** Begin scan over dimensions 1, 2. **
+
+  // Number of iterations to get from norm_sub_block_idxs.begin[1] to (but not including) norm_sub_block_idxs.end[1], stepping by norm_sub_block_idxs.step[1]. This value is rounded up because the last iteration may cover fewer than norm_sub_block_idxs.step[1] steps.
+  const idx_t num_iters_1 = ((norm_sub_block_idxs.end[1] - norm_sub_block_idxs.begin[1]) + (norm_sub_block_idxs.step[1] - 1)) / norm_sub_block_idxs.step[1];
+
+  // Number of iterations to get from norm_sub_block_idxs.begin[2] to (but not including) norm_sub_block_idxs.end[2], stepping by norm_sub_block_idxs.step[2]. This value is rounded up because the last iteration may cover fewer than norm_sub_block_idxs.step[2] steps.
+  const idx_t num_iters_2 = ((norm_sub_block_idxs.end[2] - norm_sub_block_idxs.begin[2]) + (norm_sub_block_idxs.step[2] - 1)) / norm_sub_block_idxs.step[2];
+
+  // Number of iterations in dimensions 1, 2
+  const idx_t num_iters_1_2 = num_iters_1 * num_iters_2;
+
+  // Inner loop.
+ 
+  for (idx_t loop_index_1_2 = 0; loop_index_1_2 < num_iters_1_2; loop_index_1_2++) {
+
+  // Zero-based, unit-stride index for dimension 1.
+  idx_t index_1 = loop_index_1_2 / num_iters_2;
+
+  // Zero-based, unit-stride index for dimension 2.
+  idx_t index_2 = (loop_index_1_2) % num_iters_2;
+
+  // This value of index_1 covers dimension 1 from start_1 to stop_1-1.
+  idx_t start_1 = norm_sub_block_idxs.begin[1] + (index_1 * norm_sub_block_idxs.step[1]);
+  idx_t stop_1 = std::min(start_1 + norm_sub_block_idxs.step[1], norm_sub_block_idxs.end[1]);
+
+  // This value of index_2 covers dimension 2 from start_2 to stop_2-1.
+  idx_t start_2 = norm_sub_block_idxs.begin[2] + (index_2 * norm_sub_block_idxs.step[2]);
+  idx_t stop_2 = std::min(start_2 + norm_sub_block_idxs.step[2], norm_sub_block_idxs.end[2]);
+  local_indices.start[1] = start_1;
+  local_indices.stop[1] = stop_1;
+  local_indices.index[1] = index_1;
+  local_indices.start[2] = start_2;
+  local_indices.stop[2] = stop_2;
+  local_indices.index[2] = index_2;
+   calc_inner_loop(local_indices);
+  }
+ }
+ break;
+ }
+ #undef OMP_PRAGMA_PREFIX
+ #undef OMP_PRAGMA_SUFFIX
+
+ // End of generated code.
@@ -230,6 +230,15 @@ namespace yask {
         step.setVals(_opts->_region_sizes, false); // step by region sizes.
         step[step_dim] = step_t;
 
+        // Only evaluate the auto-tuner sample if one is active.
+        if (use_tune_sample) {
+            for (auto& dim : _dims->_domain_dims.getDims()) {
+                auto& dname = dim.getName();
+                begin[dname] = max(begin[dname], tune_sample_begin[dname]);
+                end[dname] = min(end[dname], tune_sample_end[dname]);
+            }
+        }
+
         TRACE_MSG("run_solution: " << begin.makeDimValStr() << " ... (end before) " <<
                   end.makeDimValStr() << " by " << step.makeDimValStr());
         if (!bb_valid) {
@@ -289,6 +298,13 @@ namespace yask {
         // Make sure threads are set properly for a region.
         set_region_threads();
 
+        // Timer for each step_t steps. The initial and final halo
+        // exchanges are included in the first and last steps, so the
+        // auto-tuner sees them even when steps are run one at a time.
+        YaskTimer rtime;
+        rtime.start();
+        double mpi_secs = mpi_time.get_elapsed_secs();
+
         // Initial halo exchange.
         exchange_halos_all();
 
@@ -297,9 +313,6 @@ namespace yask {
         const idx_t num_t = (abs(end_t - begin_t) + (abs(step_t) - 1)) / abs(step_t);
         for (idx_t index_t = 0; index_t < num_t; index_t++)
         {
-            YaskTimer rtime;   // just for these step_t steps.
-            rtime.start();
-            
             // This value of index_t steps from start_t to stop_t-1.
             const idx_t start_t = begin_t + (index_t * step_t);
             const idx_t stop_t = (step_t > 0) ?
@@ -364,16 +377,47 @@ namespace yask {
             }
 
             steps_done += abs(step_t);
+
+            // Final halo exchange.
+            if (index_t == num_t - 1)
+                exchange_halos_all();
             rtime.stop();   // for these steps.
 
             // Call the auto-tuner to evaluate these steps.
-            // TODO: remove MPI time.
             auto elapsed_time = rtime.get_elapsed_secs();
-            _at.eval(abs(step_t), elapsed_time);
+            auto step_mpi_time = mpi_time.get_elapsed_secs() - mpi_secs;
+            _at.eval(abs(step_t), elapsed_time, step_mpi_time);
+
+            // Check load balance.
+            if (_opts->rebalance_steps > 0 && _env->num_ranks > 1) {
+                rebal_steps += abs(step_t);
+                rebal_secs += elapsed_time - step_mpi_time;
+                if (rebal_steps >= _opts->rebalance_steps) {
+                    if (rebalanceRanks(rebal_secs)) {
+
+                        // Update rank loop bounds for new domain.
+                        begin.setVals(bb_begin, false);
+                        end.setVals(bb_end, false);
+                        for (auto& dim : _dims->_domain_dims.getDims()) {
+                            auto& dname = dim.getName();
+                            end[dname] += angles[dname] * nshifts;
+                        }
+                        rank_idxs.begin = begin;
+                        rank_idxs.end = end;
+                    }
+                    rebal_steps = 0;
+                    rebal_secs = 0.;
+                }
+            }
+
+            // Reset timer for next steps.
+            rtime.clear();
+            rtime.start();
+            mpi_secs = mpi_time.get_elapsed_secs();
             
         } // step loop.
 
-        // Final halo exchange.
+        // Halos may be stale after rebalancing the last steps.
         exchange_halos_all();
 
 #ifdef MODEL_CACHE
@@ -437,6 +481,7 @@ namespace yask {
 
         // Groups in region loops are based on block-group sizes.
         region_idxs.group_size = _opts->_block_group_sizes;
+        Indices block_steps(region_idxs.step);
 
         // Time loop.
         idx_t begin_t = region_idxs.begin[step_posn];
@@ -485,13 +530,27 @@ namespace yask {
                               region_idxs.begin.makeValStr(ndims) <<
                               " ... (end before) " << region_idxs.end.makeValStr(ndims));
                     
+                    // Balance blocks across the region threads.
+                    if (ok && _opts->balance_blocks) {
+                        region_idxs.step = block_steps;
+                        balance_steps(region_idxs.begin, region_idxs.end,
+                                      region_idxs.step, omp_get_max_threads());
+                    }
+
                     // Only need to loop through the spatial extent of the
                     // region if any of its blocks are at least partly
                     // inside the domain. For overlapping regions, they may
                     // start outside the domain but enter the domain as time
                     // progresses and their boundaries shift. So, we don't
                     // want to return if this condition isn't met.
-                    if (ok) {
+                    if (ok && _opts->rec_tiling) {
+
+                        // Bisect the region recursively instead of
+                        // scanning it by blocks.
+                        calc_tile_rec(sg, region_idxs,
+                                      region_idxs.begin, region_idxs.end, 0);
+                    }
+                    else if (ok) {
 
                         // Include automatically-generated loop code that
                         // calls calc_block() for each block in this region.
@@ -519,8 +578,309 @@ namespace yask {
         } // time.
     }
 
+    // Calculate results for group 'sg' in a tile of a region.  The tile
+    // is bisected along its longest domain dim until it has no more than
+    // 'rec_base_pts' points; then it is evaluated as a block.  Both halves
+    // are evaluated as OpenMP tasks until 'rec_task_depth' is reached.
+    // Depth 0 is the whole region.
+    void StencilContext::calc_tile_rec(StencilGroupBase* sg,
+                                       const ScanIndices& region_idxs,
+                                       const Indices& tile_begin,
+                                       const Indices& tile_end,
+                                       int depth) {
+        int ndims = _dims->_stencil_dims.size();
+        auto step_posn = Indices::step_posn;
+
+        // Start the region threads at the top level; they run the
+        // tasks created below.
+        if (depth == 0) {
+#pragma omp parallel proc_bind(spread)
+#pragma omp single
+            calc_tile_rec(sg, region_idxs, tile_begin, tile_end, 1);
+            return;
+        }
+
+        // Find longest dim that can be split on a cluster boundary.
+        // The inner (unit-stride) dim is only split when no other dim
+        // can be, to keep inner loops long.
+        int split_posn = -1;
+        idx_t split_len = 0, npts = 1;
+        for (int i = step_posn + 1; i < ndims; i++) {
+            auto& dname = _dims->_stencil_dims.getDimName(i);
+            idx_t len = tile_end[i] - tile_begin[i];
+            npts *= len;
+            bool is_inner = (i == ndims - 1);
+            if (len > _dims->_cluster_pts[dname] && len > split_len &&
+                (!is_inner || split_posn < 0)) {
+                split_posn = i;
+                split_len = len;
+            }
+        }
+
+        // Small enough: evaluate tile as a block.
+        if (split_posn < 0 || npts <= _opts->rec_base_pts) {
+            ScanIndices tile_idxs(region_idxs);
+            tile_idxs.start = tile_begin;
+            tile_idxs.stop = tile_end;
+            TRACE_MSG3("calc_tile_rec: depth " << depth << ": " <<
+                       tile_begin.makeValStr(ndims) <<
+                       " ... (end before) " << tile_end.makeValStr(ndims));
+            sg->calc_block(tile_idxs);
+            return;
+        }
+
+        // Split near the middle on a cluster boundary.
+        auto& dname = _dims->_stencil_dims.getDimName(split_posn);
+        idx_t half = ROUND_UP(split_len / 2, _dims->_cluster_pts[dname]);
+        Indices lo_end(tile_end), hi_begin(tile_begin);
+        lo_end[split_posn] = hi_begin[split_posn] = tile_begin[split_posn] + half;
+
+        if (depth <= _opts->rec_task_depth) {
+#pragma omp task
+            calc_tile_rec(sg, region_idxs, tile_begin, lo_end, depth + 1);
+#pragma omp task
+            calc_tile_rec(sg, region_idxs, hi_begin, tile_end, depth + 1);
+#pragma omp taskwait
+        }
+        else {
+            calc_tile_rec(sg, region_idxs, tile_begin, lo_end, depth + 1);
+            calc_tile_rec(sg, region_idxs, hi_begin, tile_end, depth + 1);
+        }
+    }
+
+    // Choose steps that make the number of sub-ranges a multiple of
+    // 'nthreads' when possible, with sizes as nearly equal as possible.
+    // Each step stays a multiple of the cluster size and between half and
+    // all of its original value.  Among the candidates, the one with the
+    // least thread idle time is used, preferring larger steps.
+    void StencilContext::balance_steps(const Indices& begin, const Indices& end,
+                                       Indices& steps, int nthreads) const {
+        if (nthreads <= 1)
+            return;
+        int ndims = _dims->_stencil_dims.size();
+        auto step_posn = Indices::step_posn;
+        const size_t max_cands = 8; // per dim.
+
+        // Candidate steps in each dim in clusters, starting with the
+        // smallest step that gives the original number of sub-ranges.
+        vector<vector<idx_t>> cands(ndims);
+        vector<idx_t> nclus(ndims, 1), cpts(ndims, 1);
+        double npts = 1.;
+        for (int i = step_posn + 1; i < ndims; i++) {
+            auto& dname = _dims->_stencil_dims.getDimName(i);
+            idx_t len = end[i] - begin[i];
+            if (len <= 0)
+                return;
+            npts *= len;
+            cpts[i] = _dims->_cluster_pts[dname];
+            nclus[i] = CEIL_DIV(len, cpts[i]);
+            idx_t smax = max(idx_t(1), min(steps[i] / cpts[i], nclus[i]));
+            idx_t smin = max(idx_t(1), CEIL_DIV(smax, 2));
+            for (idx_t n = CEIL_DIV(nclus[i], smax);
+                 n <= nclus[i] && cands[i].size() < max_cands; n++) {
+                idx_t s = CEIL_DIV(nclus[i], n);
+                if (s < smin)
+                    break;
+                if (cands[i].empty() || s != cands[i].back())
+                    cands[i].push_back(s);
+            }
+        }
+
+        // Search all combinations of candidates.
+        vector<size_t> ci(ndims, 0);
+        vector<idx_t> best(ndims, 0);
+        double best_eff = 0., best_pts = 0.;
+        while (true) {
+            idx_t nblks = 1;
+            double blk_pts = 1.;
+            for (int i = step_posn + 1; i < ndims; i++) {
+                idx_t s = cands[i][ci[i]];
+                nblks *= CEIL_DIV(nclus[i], s);
+                blk_pts *= double(s * cpts[i]);
+            }
+
+            // Fraction of thread time used, assuming time is
+            // proportional to the size of a full sub-range.
+            idx_t nwaves = CEIL_DIV(nblks, idx_t(nthreads));
+            double eff = npts / (double(nwaves * nthreads) * blk_pts);
+            if (eff > best_eff * 1.000001 ||
+                (eff > best_eff * 0.999999 && blk_pts > best_pts)) {
+                best_eff = eff;
+                best_pts = blk_pts;
+                for (int i = step_posn + 1; i < ndims; i++)
+                    best[i] = cands[i][ci[i]];
+            }
+
+            // Next combination.
+            int i = step_posn + 1;
+            for (; i < ndims; i++) {
+                if (++ci[i] < cands[i].size())
+                    break;
+                ci[i] = 0;
+            }
+            if (i == ndims)
+                break;
+        }
+        for (int i = step_posn + 1; i < ndims; i++)
+            steps[i] = best[i] * cpts[i];
+    }
+
+    // Sum huge-page usage over the live buffers.
+    size_t StencilContext::get_huge_page_bytes() const {
+        size_t nbytes = 0;
+        for (auto& b : _data_bufs) {
+            auto p = b.first.lock();
+            if (p)
+                nbytes += getHugePageBytes(p.get(), b.second);
+        }
+        return nbytes;
+    }
+
+    // Find the CPU groups for block threads from the sysfs topology.
+    void StencilContext::setup_block_thread_binding() {
+        ostream& os = get_ostr();
+        auto& share = _opts->bind_block_threads;
+        block_cpu_groups.clear();
+        if (share == "none")
+            return;
+        if (share != "core" && share != "l2") {
+            cerr << "Error: unknown block-thread binding '" << share <<
+                "'; use one of 'none', 'core', or 'l2'.\n";
+            exit_yask(1);
+        }
+        block_cpu_groups = getCpuGroups(share);
+        if (block_cpu_groups.empty()) {
+            os << "  Block threads not bound: cannot read CPU topology\n";
+            return;
+        }
+        size_t gsize = block_cpu_groups.front().size();
+        size_t ncpus = 0;
+        for (auto& grp : block_cpu_groups)
+            ncpus += grp.size();
+        os << "  Block threads bound to " << block_cpu_groups.size() <<
+            " '" << share << "' group(s) of " << gsize << " CPU(s)\n";
+        if (size_t(_opts->num_block_threads) > gsize)
+            os << "  Warning: more threads per block than CPUs per group\n";
+        if (size_t(max(1, _opts->max_threads / _opts->thread_divisor)) > ncpus)
+            os << "  Warning: more threads than CPUs in groups\n";
+    }
+
+    // Names of auto-tuner levels as used in the 'auto_tune_levels' option.
+    static const char* at_level_names[] = {
+        "region", "block", "block_group", "block_threads",
+        "sub_block", "sub_block_group", "prefetch", "loops"
+    };
+
+    // Names of auto-tuner levels for messages.
+    static const char* at_level_descrs[] = {
+        "region-size", "block-size", "block-group-size", "block-threads",
+        "sub-block-size", "sub-block-group-size", "prefetch-distances",
+        "loop-variants"
+    };
+
+    // Names of auto-tuner search strategies for options.
+    static const char* at_search_names[] = {
+        "gd", "model"
+    };
+
+    const char* StencilContext::AT::get_level_name(int level) {
+        assert(level >= 0 && level < at_num_levels);
+        return at_level_names[level];
+    }
+
+    // Get the values of the current level from the settings.
+    IdxTuple StencilContext::AT::get_vals() const {
+        auto _opts = _context->_opts;
+        auto _dims = _context->_dims;
+        auto& step_dim = _dims->_step_dim;
+        int level = levels.at(level_idx);
+        IdxTuple vals;
+
+        // Wave-front depth is only searched with one rank because
+        // halo exchange is not yet supported with wave-fronts.
+        if (level == at_region && _context->_env->num_ranks == 1)
+            vals.addDimBack(step_dim, _opts->_region_sizes[step_dim]);
+
+        if (level == at_block_threads)
+            vals.addDimBack("bt", _opts->num_block_threads);
+
+        else if (level == at_prefetch) {
+            vals.addDimBack("l1", _opts->_prefetch_L1_dist);
+            vals.addDimBack("l2", _opts->_prefetch_L2_dist);
+        }
+
+        else if (level == at_loops) {
+            vals.addDimBack("region", _opts->_region_loop_variant);
+            vals.addDimBack("block", _opts->_block_loop_variant);
+            vals.addDimBack("sub_block", _opts->_sub_block_loop_variant);
+        }
+
+        else {
+            auto& sizes =
+                (level == at_region) ? _opts->_region_sizes :
+                (level == at_block) ? _opts->_block_sizes :
+                (level == at_block_group) ? _opts->_block_group_sizes :
+                (level == at_sub_block) ? _opts->_sub_block_sizes :
+                _opts->_sub_block_group_sizes;
+            for (auto& dim : _dims->_domain_dims.getDims()) {
+                auto& dname = dim.getName();
+                vals.addDimBack(dname, sizes[dname]);
+            }
+        }
+        return vals;
+    }
+
+    // Set the values of the current level in the settings.
+    void StencilContext::AT::set_vals(const IdxTuple& vals) {
+        auto _opts = _context->_opts;
+        int level = levels.at(level_idx);
+        if (level == at_block_threads)
+            _opts->num_block_threads = int(vals["bt"]);
+        else if (level == at_prefetch) {
+            _opts->_prefetch_L1_dist = int(vals["l1"]);
+            _opts->_prefetch_L2_dist = int(vals["l2"]);
+        }
+        else if (level == at_loops) {
+            _opts->_region_loop_variant = int(vals["region"]);
+            _opts->_block_loop_variant = int(vals["block"]);
+            _opts->_sub_block_loop_variant = int(vals["sub_block"]);
+        }
+        else {
+            auto& sizes =
+                (level == at_region) ? _opts->_region_sizes :
+                (level == at_block) ? _opts->_block_sizes :
+                (level == at_block_group) ? _opts->_block_group_sizes :
+                (level == at_sub_block) ? _opts->_sub_block_sizes :
+                _opts->_sub_block_group_sizes;
+            sizes.setVals(vals, false);
+        }
+    }
+
+    // Apply settings.
+    void StencilContext::AT::apply() {
+        auto _opts = _context->_opts;
+        auto _env = _context->_env;
+        int level = level_idx < levels.size() ? levels[level_idx] : at_block;
+
+        // Change sub-block sizes to 0 when a coarser level changes so
+        // adjustSettings() will set them to the default.
+        if (level < at_sub_block) {
+            _opts->_sub_block_sizes.setValsSame(0);
+            _opts->_sub_block_group_sizes.setValsSame(0);
+        }
+                
+        // Make sure everything is resized based on block size.
+        _opts->adjustSettings(nullop->get_ostream(), _env);
+
+        // Update other state that depends on the settings.
+        if (level == at_region)
+            _context->find_wf_angles();
+        if (level == at_block_threads)
+            _context->set_region_threads();
+    }
+
     // Reset the auto-tuner.
-    void StencilContext::AT::clear(bool mark_done, bool verbose) {
+    void StencilContext::AT::clear(bool mark_done, bool verbose, bool tune_regions) {
 
         // Output.
         ostream& os = _context->get_ostr();
@@ -535,49 +895,216 @@ namespace yask {
         nullop = yof.new_null_output();
 
         // Apply the best known settings from existing data, if any.
-        auto _opts = _context->_opts;
         if (best_rate > 0.) {
-            _opts->_block_sizes = best_block;
+            set_vals(best_vals);
             apply();
-            os << "auto-tuner: applying block-size "  <<
-                best_block.makeDimValStr(" * ") << endl;
+            os << "auto-tuner: applying " << at_level_descrs[levels.at(level_idx)] <<
+                " " << best_vals.makeDimValStr(" * ") << endl;
+        }
+
+        // Find levels to search, coarsest first.
+        auto _opts = _context->_opts;
+        levels.clear();
+        istringstream iss(_opts->tune_levels);
+        string item;
+        while (getline(iss, item, ',')) {
+            if (item.empty())
+                continue;
+            int level = 0;
+            while (level < at_num_levels && item != at_level_names[level])
+                level++;
+            if (level == at_num_levels) {
+                cerr << "Error: unknown auto-tuner level '" << item << "'; use one of";
+                for (int i = 0; i < at_num_levels; i++)
+                    cerr << " '" << at_level_names[i] << "'";
+                cerr << ".\n";
+                exit_yask(1);
+            }
+            if (find(levels.begin(), levels.end(), level) == levels.end())
+                levels.push_back(level);
         }
+        sort(levels.begin(), levels.end());
+        level_idx = 0;
+
+        // Find search strategy.
+        search = 0;
+        while (search < at_num_searches && _opts->tune_search != at_search_names[search])
+            search++;
+        if (search == at_num_searches) {
+            cerr << "Error: unknown auto-tuner search '" << _opts->tune_search << "'; use one of";
+            for (int i = 0; i < at_num_searches; i++)
+                cerr << " '" << at_search_names[i] << "'";
+            cerr << ".\n";
+            exit_yask(1);
+        }
+        allow_regions = tune_regions;
+        all_ranks = _opts->tune_all_ranks && _context->_env->num_ranks > 1;
         
         // Reset all vars.
-        results.clear();
-        n2big = n2small = 0;
-        best_block = _opts->_block_sizes;
         best_rate = 0.;
-        center_block = best_block;
-        radius = max_radius;
         done = mark_done;
-        neigh_idx = 0;
-        better_neigh_found = false;
         ctime = 0.;
+        cmpi_time = 0.;
         csteps = 0;
         in_warmup = true;
 
         // Set min blocks to number of region threads.
         min_blks = _context->set_region_threads();
-        
-        // Adjust starting block if needed.
-        for (auto dim : center_block.getDims()) {
-            auto& dname = dim.getName();
-            auto& dval = dim.getVal();
-                    
-            auto dmax = max(idx_t(1), _opts->_region_sizes[dname] / 2);
-            if (dval > dmax || dval < 1)
-                center_block[dname] = dmax;
-        }
+
+        // Set max block working set based on L2 size.
+        max_ws = _opts->tune_max_ws_pct * getCacheBytes(2) / 100;
+
         if (!done) {
-            os << "auto-tuner: starting block-size: "  <<
-                center_block.makeDimValStr(" * ") << endl;
-            os << "auto-tuner: starting search radius: " << radius << endl;
+            start_level();
+
+            // Nothing to search?
+            if (level_idx >= levels.size())
+                done = true;
+        }
+    }
+
+    // Start searching the current level, skipping any that
+    // cannot be searched.
+    void StencilContext::AT::start_level() {
+        ostream& os = _context->get_ostr();
+        auto _opts = _context->_opts;
+        auto _dims = _context->_dims;
+        auto& step_dim = _dims->_step_dim;
+
+        for (; level_idx < levels.size(); level_idx++) {
+            int level = levels[level_idx];
+            auto descr = at_level_descrs[level];
+
+            // Reset search vars.
+            results.clear();
+            n2big = n2small = n2ws = 0;
+            best_rate = 0.;
+            best_comp_secs = best_mpi_secs = 0.;
+            radius = max_radius;
+            neigh_idx = 0;
+            better_neigh_found = false;
+
+            if (level == at_region && !allow_regions) {
+                os << "auto-tuner: not searching " << descr <<
+                    " outside of run_auto_tuner_now()" << endl;
+                continue;
+            }
+
+            // Region sizes would be limited to the sample, so the best one
+            // found would not be representative of the whole rank domain.
+            if (level == at_region && _context->use_tune_sample) {
+                os << "auto-tuner: not searching " << descr <<
+                    " in a sample of the rank domain" << endl;
+                continue;
+            }
+            if (_opts->rec_tiling &&
+                (level == at_block || level == at_block_group)) {
+                os << "auto-tuner: not searching " << descr <<
+                    " with recursive tiling" << endl;
+                continue;
+            }
+
+            // Limits of each value.
+            center_vals = get_vals();
+            min_vals = center_vals;
+            max_vals = center_vals;
+            for (auto dim : center_vals.getDims()) {
+                auto& dname = dim.getName();
+                idx_t dmin = 1, dmax = 1;
+                if (level == at_block_threads)
+                    dmax = max(1, _opts->max_threads / _opts->thread_divisor);
+                else if (level == at_prefetch) {
+                    dmin = 0;
+                    dmax = max_pfd;
+                }
+                else if (level == at_loops) {
+                    dmin = 0;
+                    dmax = (dname == "region") ? NUM_REGION_LOOP_VARIANTS - 1 :
+                        (dname == "block") ? NUM_BLOCK_LOOP_VARIANTS - 1 :
+                        NUM_SUB_BLOCK_LOOP_VARIANTS - 1;
+                }
+                else if (dname == step_dim)
+                    dmax = min(max_wf_steps, _opts->_rank_sizes[step_dim]);
+                else {
+                    dmin = _dims->_cluster_pts[dname];
+                    dmax = _opts->_region_sizes[dname];
+                    if (level == at_region)
+                        dmax = _opts->_rank_sizes[dname];
+                    else if (level == at_block_group)
+                        dmin = _opts->_block_sizes[dname];
+                    else if (level == at_sub_block)
+                        dmax = _opts->_block_sizes[dname];
+                    else if (level == at_sub_block_group) {
+                        dmin = _opts->_sub_block_sizes[dname];
+                        dmax = _opts->_block_sizes[dname];
+                    }
+
+                    // Nothing larger than the sample is measured.
+                    if (_context->use_tune_sample)
+                        dmax = min(dmax, _context->tune_sample_end[dname] -
+                                   _context->tune_sample_begin[dname]);
+                }
+                dmax = ROUND_UP(max(dmax, dmin), max(dmin, idx_t(1)));
+                min_vals[dname] = dmin;
+                max_vals[dname] = dmax;
+
+                // Adjust starting point if needed.
+                auto& dval = center_vals[dname];
+                if (level == at_block) {
+                    auto bmax = max(idx_t(1), dmax / 2);
+                    if (dval > bmax || dval < 1)
+                        dval = bmax;
+                }
+                else
+                    dval = min(max(dval, dmin), dmax);
+            }
+            if (min_vals == max_vals) {
+                os << "auto-tuner: no " << descr << " values to search" << endl;
+                continue;
+            }
+            best_vals = center_vals;
+
+            // Search neighbors are at offsets of -1, 0, and +1 in each dim.
+            neigh_sizes = center_vals;
+            neigh_sizes.setValsSame(3);
+
+            os << "auto-tuner: starting " << descr << ": " <<
+                center_vals.makeDimValStr(" * ") << endl;
+            if (search == at_model) {
+                tried.clear();
+                make_candidates();
+                os << "auto-tuner: model search over " << candidates.size() <<
+                    " candidate(s)" << endl;
+            }
+            else
+                os << "auto-tuner: starting search radius: " << radius << endl;
+            return;
+        }
+    }
+
+    // Apply best values of current level and move to the next one.
+    void StencilContext::AT::next_level() {
+        ostream& os = _context->get_ostr();
+        if (best_rate > 0.) {
+            set_vals(best_vals);
+            apply();
+            os << "auto-tuner: applying " << at_level_descrs[levels.at(level_idx)] <<
+                " " << best_vals.makeDimValStr(" * ") << endl;
+            if (best_mpi_secs > 0.)
+                os << "auto-tuner: best setting used " << best_comp_secs <<
+                    " secs/step for compute and " << best_mpi_secs <<
+                    " secs/step for halo exchange" << endl;
         }
+        if (n2ws > 0)
+            os << "auto-tuner: skipped " << n2ws << " " << at_level_descrs[levels.at(level_idx)] <<
+                " setting(s) with est. working set over " << makeByteStr(max_ws) << endl;
+        best_rate = 0.;
+        level_idx++;
+        start_level();
     }
 
     // Evaluate the previous run and take next auto-tuner step.
-    void StencilContext::AT::eval(idx_t steps, double etime) {
+    void StencilContext::AT::eval(idx_t steps, double etime, double mtime) {
         ostream& os = _context->get_ostr();
         
         // Leave if done.
@@ -590,12 +1117,28 @@ namespace yask {
 
         // Handy ptrs.
         auto _opts = _context->_opts;
-        auto _mpiInfo = _context->_mpiInfo;
         auto _dims = _context->_dims;
+        auto& step_dim = _dims->_step_dim;
+        int level = levels.at(level_idx);
+        auto descr = at_level_descrs[level];
+
+#ifdef USE_MPI
+        // Use times from the slowest rank, so all ranks make the
+        // same decisions below.
+        if (all_ranks) {
+            double times[2] = { etime, etime - mtime };
+            double max_times[2];
+            MPI_Allreduce(times, max_times, 2, MPI_DOUBLE, MPI_MAX,
+                          _context->_env->comm);
+            etime = max_times[0];
+            mtime = max(max_times[0] - max_times[1], 0.);
+        }
+#endif
 
         // Cumulative stats.
         csteps += steps;
         ctime += etime;
+        cmpi_time += mtime;
 
         // Still in warmup?
         if (in_warmup) {
@@ -611,62 +1154,246 @@ namespace yask {
             // Measure this step only.
             csteps = steps;
             ctime = etime;
+            cmpi_time = mtime;
         }
             
         // Need more steps to get a good measurement?
         if (ctime < min_secs && csteps < min_steps)
             return;
 
-        // Calc perf and reset vars for next time.
-        double rate = double(csteps) / ctime;
+        // When coordinating ranks, only the first one searches;
+        // the others use its settings.
+        if (all_ranks && _context->_env->my_rank != 0) {
+            csteps = 0;
+            ctime = 0.;
+            cmpi_time = 0.;
+            sync_ranks();
+            return;
+        }
+
+        // Calc perf and reset vars for next time.  Rate is based on
+        // end-to-end time if tuning w/halo exchange; otherwise, MPI time
+        // is removed so that settings are chosen on compute alone.
+        auto cur_vals = get_vals();
+
+        // If the first setting of this level is outside its limits,
+        // e.g., because a coarser level changed, mark it as evaluated
+        // without using its measurement and start from the search center.
+        if (results.empty()) {
+            bool in_range = true;
+            for (auto dim : cur_vals.getDims()) {
+                auto& dname = dim.getName();
+                auto& dval = dim.getVal();
+                if (dval < min_vals[dname] || dval > max_vals[dname])
+                    in_range = false;
+            }
+            if (!in_range) {
+                results[cur_vals] = 0.;
+                csteps = 0;
+                ctime = 0.;
+                cmpi_time = 0.;
+                set_vals(center_vals);
+                apply();
+                if (all_ranks)
+                    sync_ranks();
+                return;
+            }
+        }
+
+        double comp_time = max(ctime - cmpi_time, 0.);
+        double rate_time = _opts->tune_halo_exchange ? ctime : comp_time;
+        double rate = rate_time > 0. ? double(csteps) / rate_time : 0.;
         os << "auto-tuner: " << csteps << " steps(s) at " << rate <<
-            " steps/sec with block-size " <<
-            _opts->_block_sizes.makeDimValStr(" * ") << endl;
-        csteps = 0;
-        ctime = 0.;
+            " steps/sec with " << descr << " " <<
+            cur_vals.makeDimValStr(" * ");
+        if (cmpi_time > 0.)
+            os << " (compute " << (comp_time / csteps) <<
+                " + halo-exchange " << (cmpi_time / csteps) << " secs/step)";
+        if (level == at_block && max_ws > 0)
+            os << " (est. working set " <<
+                makeByteStr(_context->get_block_working_set(cur_vals)) << ")";
+        if (_context->use_tune_sample)
+            os << " (est. " << (rate * _context->tune_sample_frac) <<
+                " steps/sec for rank domain)";
+        os << endl;
 
         // Save result.
-        results[_opts->_block_sizes] = rate;
+        results[cur_vals] = rate;
         bool is_better = rate > best_rate;
         if (is_better) {
-            best_block = _opts->_block_sizes;
+            best_vals = cur_vals;
             best_rate = rate;
+            best_comp_secs = comp_time / csteps;
+            best_mpi_secs = cmpi_time / csteps;
             better_neigh_found = true;
         }
+        csteps = 0;
+        ctime = 0.;
+        cmpi_time = 0.;
 
         // At this point, we have gathered perf info on the current settings.
         // Now, we need to determine next unevaluated point in search space.
+        if (search == at_model)
+            tried.insert(cur_vals);
+        bool more = (search == at_model) ? next_model_vals() : next_gd_vals();
+
+        // Done with this level?
+        if (!more) {
+            next_level();
+
+            // Done with all levels?
+            if (level_idx >= levels.size()) {
+
+                // Reset AT and disable.
+                clear(true);
+                os << "auto-tuner: done" << endl;
+            }
+        }
+
+        // Fix settings for next step.
+        else {
+            apply();
+            TRACE_MSG2("auto-tuner: next " << descr << " " <<
+                       get_vals().makeDimValStr(" * "));
+        }
+
+        // Send new settings to other ranks.
+        if (all_ranks)
+            sync_ranks();
+    }
+
+    // Copy the settings and search state of the first rank to all ranks.
+    void StencilContext::AT::sync_ranks() {
+#ifdef USE_MPI
+        auto _opts = _context->_opts;
+        auto _dims = _context->_dims;
+        auto _env = _context->_env;
+        auto& step_dim = _dims->_step_dim;
+        vector<IdxTuple*> all_sizes = {
+            &_opts->_region_sizes, &_opts->_block_group_sizes, &_opts->_block_sizes,
+            &_opts->_sub_block_group_sizes, &_opts->_sub_block_sizes
+        };
+
+        // Pack.
+        vector<idx_t> buf;
+        buf.push_back(done ? 1 : 0);
+        buf.push_back(level_idx);
+        buf.push_back(_opts->_region_sizes[step_dim]);
+        buf.push_back(_opts->num_block_threads);
+        buf.push_back(_opts->_prefetch_L1_dist);
+        buf.push_back(_opts->_prefetch_L2_dist);
+        buf.push_back(_opts->_region_loop_variant);
+        buf.push_back(_opts->_block_loop_variant);
+        buf.push_back(_opts->_sub_block_loop_variant);
+        for (auto* sizes : all_sizes)
+            for (auto& dim : _dims->_domain_dims.getDims())
+                buf.push_back((*sizes)[dim.getName()]);
+
+        MPI_Bcast(buf.data(), int(buf.size()), MPI_INTEGER8, 0, _env->comm);
+        if (_env->my_rank == 0)
+            return;
+
+        // Unpack.
+        size_t i = 0;
+        done = buf[i++] != 0;
+        level_idx = size_t(buf[i++]);
+        _opts->_region_sizes[step_dim] = buf[i++];
+        _opts->num_block_threads = int(buf[i++]);
+        _opts->_prefetch_L1_dist = int(buf[i++]);
+        _opts->_prefetch_L2_dist = int(buf[i++]);
+        _opts->_region_loop_variant = int(buf[i++]);
+        _opts->_block_loop_variant = int(buf[i++]);
+        _opts->_sub_block_loop_variant = int(buf[i++]);
+        for (auto* sizes : all_sizes)
+            for (auto& dim : _dims->_domain_dims.getDims())
+                (*sizes)[dim.getName()] = buf[i++];
+
+        // Update settings that depend on them.
+        _opts->adjustSettings(nullop->get_ostream(), _env);
+        _context->find_wf_angles();
+        _context->set_region_threads();
+#endif
+    }
+
+    // Whether the values are allowed for the current level.
+    bool StencilContext::AT::is_valid(const IdxTuple& vals) {
+        auto _opts = _context->_opts;
+        int level = levels.at(level_idx);
+
+        // Block-size limits.
+        if (level == at_block) {
+
+            // Too small?
+            if (vals.product() < min_pts) {
+                n2small++;
+                return false;
+            }
+
+            // Too few?
+            idx_t rpts = 1;
+            for (auto dim : vals.getDims()) {
+                auto& dname = dim.getName();
+                idx_t rsz = _opts->_region_sizes[dname];
+                if (_context->use_tune_sample)
+                    rsz = min(rsz, _context->tune_sample_end[dname] -
+                              _context->tune_sample_begin[dname]);
+                rpts *= rsz;
+            }
+            idx_t nblks = rpts / vals.product();
+            if (nblks < min_blks) {
+                n2big++;
+                return false;
+            }
+
+            // Data reused in the block won't fit in cache?
+            if (max_ws > 0 && _context->get_block_working_set(vals) > max_ws) {
+                n2ws++;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Set the next values to measure using gradient-descent(GD) search.
+    bool StencilContext::AT::next_gd_vals() {
+        ostream& os = _context->get_ostr();
+        auto _dims = _context->_dims;
+        auto& step_dim = _dims->_step_dim;
+        int level = levels.at(level_idx);
+        auto descr = at_level_descrs[level];
+
         while (true) {
 
-            // Gradient-descent(GD) search:
-            // Use the neighborhood info from MPI to track neighbors.
-            // TODO: move to a more general place.
             // Valid neighbor index?
-            if (neigh_idx < _mpiInfo->neighborhood_size) {
+            if (neigh_idx < neigh_sizes.product()) {
 
                 // Convert index to offsets in each dim.
-                auto ofs = _mpiInfo->neighborhood_sizes.unlayout(neigh_idx);
+                auto ofs = neigh_sizes.unlayout(neigh_idx);
 
                 // Next neighbor of center point.
                 neigh_idx++;
                 
-                // Determine new block size.
-                IdxTuple bsize(center_block);
+                // Determine new values.
+                IdxTuple vals(center_vals);
                 bool ok = true;
                 for (auto odim : ofs.getDims()) {
-                    auto& dname = odim.getName(); // a domain-dim name.
+                    auto& dname = odim.getName();
                     auto& dofs = odim.getVal(); // always [0..2].
 
-                    // Min and max sizes of this dim.
-                    auto dmin = _dims->_cluster_pts[dname];
-                    auto dmax = _opts->_region_sizes[dname];
+                    // Min and max values of this dim.
+                    auto dmin = min_vals[dname];
+                    auto dmax = max_vals[dname];
                             
                     // Determine distance of GD neighbors.
-                    auto step = dmin; // step by cluster size.
-                    step = max(step, min_step);
+                    // Step, thread, prefetch, and variant counts step by one;
+                    // sizes step by cluster or larger size.
+                    idx_t step = 1;
+                    if (level != at_block_threads && level != at_prefetch &&
+                        level != at_loops && dname != step_dim)
+                        step = max(dmin, min_step);
                     step *= radius;
 
-                    auto sz = center_block[dname];
+                    auto sz = center_vals[dname];
                     switch (dofs) {
                     case 0:
                         sz -= step;
@@ -689,36 +1416,21 @@ namespace yask {
                             
                     // Adjustments.
                     sz = min(sz, dmax);
-                    sz = ROUND_UP(sz, dmin);
+                    sz = ROUND_UP(sz, max(dmin, idx_t(1)));
 
                     // Save.
-                    bsize[dname] = sz;
+                    vals[dname] = sz;
 
-                } // domain dims.
-                TRACE_MSG2("auto-tuner: checking block-size "  <<
-                          bsize.makeDimValStr(" * "));
+                } // dims.
+                TRACE_MSG2("auto-tuner: checking " << descr << " " <<
+                          vals.makeDimValStr(" * "));
 
-                // Too small?
-                if (ok && bsize.product() < min_pts) {
-                    n2small++;
-                    ok = false;
-                }
-
-                // Too few?
-                else if (ok) {
-                    idx_t nblks = _opts->_region_sizes.product() / bsize.product();
-                    if (nblks < min_blks) {
-                        ok = false;
-                        n2big++;
-                    }
-                }
-            
                 // Valid size and not already checked?
-                if (ok && !results.count(bsize)) {
+                if (ok && is_valid(vals) && !results.count(vals)) {
 
-                    // Run next step with this size.
-                    _opts->_block_sizes = bsize;
-                    break;      // out of block-search loop.
+                    // Run next step with this setting.
+                    set_vals(vals);
+                    return true;
                 }
                 
             } // valid neighbor index.
@@ -729,8 +1441,8 @@ namespace yask {
                 // Should GD continue?
                 bool stop_gd = !better_neigh_found;
 
-                // Make new center at best block so far.
-                center_block = best_block;
+                // Make new center at best point so far.
+                center_vals = best_vals;
 
                 // Reset search vars.
                 neigh_idx = 0;
@@ -743,27 +1455,237 @@ namespace yask {
                     // Move to next radius.
                     radius /= 2;
 
-                    // Done?
-                    if (radius < 1) {
-
-                        // Reset AT and disable.
-                        clear(true);
-                        os << "auto-tuner: done" << endl;
-                        return;
-                    }
+                    // Done with this level?
+                    if (radius < 1)
+                        return false;
                     os << "auto-tuner: new search radius: " << radius << endl;
                 }
                 else {
-                    TRACE_MSG2("auto-tuner: continuing search from block " <<
-                               center_block.makeDimValStr(" * "));
+                    TRACE_MSG2("auto-tuner: continuing search from " << descr << " " <<
+                               center_vals.makeDimValStr(" * "));
                 }
             } // beyond next neighbor of center.
         } // search for new setting to try.
+    }
 
-        // Fix settings for next step.
-        apply();
-        TRACE_MSG2("auto-tuner: next block-size "  <<
-                  _opts->_block_sizes.makeDimValStr(" * "));
+    // Make the list of candidates for the model search: a lattice of
+    // values spaced geometrically between the limits of each dim, so that
+    // small sizes are sampled as densely as large ones.
+    void StencilContext::AT::make_candidates() {
+        auto _dims = _context->_dims;
+        auto& step_dim = _dims->_step_dim;
+        int level = levels.at(level_idx);
+        candidates.clear();
+
+        // Use half-octave spacing unless there would be too many points.
+        for (double factor : { sqrt(2.), 2. }) {
+            IdxTuple sizes(center_vals);
+            std::map<string, vector<idx_t>> dvals;
+            for (auto dim : center_vals.getDims()) {
+                auto& dname = dim.getName();
+                auto dmin = min_vals[dname];
+                auto dmax = max_vals[dname];
+                set<idx_t> dset = { dmin, dmax, center_vals[dname] };
+
+                // Step, thread, prefetch, and variant counts are multiples of one;
+                // sizes are multiples of cluster or larger size.
+                idx_t step = 1;
+                if (level != at_block_threads && level != at_prefetch &&
+                    level != at_loops && dname != step_dim)
+                    step = max(dmin, min_step);
+                for (double x = double(step); x < double(dmax); x *= factor)
+                    dset.insert(min(ROUND_UP(idx_t(x), max(dmin, idx_t(1))), dmax));
+                dvals[dname].assign(dset.begin(), dset.end());
+                sizes[dname] = dset.size();
+            }
+            if (sizes.product() > idx_t(max_model_cands) && factor < 2.)
+                continue;
+
+            // Keep the valid points of the lattice.
+            for (idx_t i = 0; i < sizes.product(); i++) {
+                auto idxs = sizes.unlayout(i);
+                IdxTuple vals(center_vals);
+                for (auto dim : idxs.getDims()) {
+                    auto& dname = dim.getName();
+                    vals[dname] = dvals[dname].at(dim.getVal());
+                }
+                if (is_valid(vals))
+                    candidates.push_back(vals);
+            }
+            break;
+        }
+    }
+
+    // Set the next values to measure using a surrogate model: a Gaussian
+    // process fitted to the log of the measured rates over log-scaled values.
+    // After a few space-filling points, each candidate is rated by its
+    // expected improvement over the best rate, and the best one is
+    // measured next. This needs far fewer measurements than GD when
+    // the rates vary smoothly.
+    bool StencilContext::AT::next_model_vals() {
+        ostream& os = _context->get_ostr();
+        int level = levels.at(level_idx);
+        auto descr = at_level_descrs[level];
+        if (results.size() >= max_model_evals) {
+            os << "auto-tuner: done searching " << descr << " after " <<
+                results.size() << " setting(s)" << endl;
+            return false;
+        }
+
+        // Map values to [0..1] in log-space in each dim.
+        auto to_unit = [&](const IdxTuple& vals) {
+            vector<double> x;
+            for (auto dim : vals.getDims()) {
+                auto& dname = dim.getName();
+                double lmin = log2(double(min_vals[dname] + 1));
+                double lmax = log2(double(max_vals[dname] + 1));
+                if (lmax > lmin)
+                    x.push_back((log2(double(dim.getVal() + 1)) - lmin) / (lmax - lmin));
+            }
+            return x;
+        };
+        auto dist2 = [](const vector<double>& a, const vector<double>& b) {
+            double d2 = 0.;
+            for (size_t i = 0; i < a.size(); i++)
+                d2 += (a[i] - b[i]) * (a[i] - b[i]);
+            return d2;
+        };
+
+        // Measured points, ignoring settings outside the limits.
+        vector<vector<double>> xs;
+        vector<double> ys;
+        for (auto& res : results) {
+            if (res.second > 0.) {
+                xs.push_back(to_unit(res.first));
+                ys.push_back(log(res.second));
+            }
+        }
+        size_t n = ys.size();
+        size_t ninit = center_vals.getNumDims() + 2;
+
+        // Candidates not yet measured.
+        vector<const IdxTuple*> open;
+        for (auto& cand : candidates)
+            if (!tried.count(cand) && !results.count(cand))
+                open.push_back(&cand);
+        if (open.empty()) {
+            os << "auto-tuner: no more " << descr << " candidates" << endl;
+            return false;
+        }
+        const IdxTuple* next = 0;
+
+        // Start with points farthest from those measured.
+        if (n < ninit) {
+            double best_d2 = -1.;
+            for (auto cand : open) {
+                auto x = to_unit(*cand);
+                double d2 = std::numeric_limits<double>::max();
+                for (auto& xm : xs)
+                    d2 = min(d2, dist2(x, xm));
+                if (d2 > best_d2) {
+                    best_d2 = d2;
+                    next = cand;
+                }
+            }
+        }
+
+        // Then use the model.
+        else {
+
+            // Standardize log-rates, so the model fits relative
+            // differences and is not dominated by very slow settings.
+            double ymean = 0., yvar = 0.;
+            for (auto y : ys)
+                ymean += y;
+            ymean /= n;
+            for (auto y : ys)
+                yvar += (y - ymean) * (y - ymean);
+            yvar /= n;
+            double ystd = yvar > 0. ? sqrt(yvar) : 1.;
+            vector<double> yn(n);
+            for (size_t i = 0; i < n; i++)
+                yn[i] = (ys[i] - ymean) / ystd;
+            double ybest = (log(best_rate) - ymean) / ystd;
+            double noise = max(model_noise * model_noise / (ystd * ystd), 1e-6);
+
+            // Covariance between points.
+            double l2 = 2. * model_len_scale * model_len_scale;
+            auto kern = [&](const vector<double>& a, const vector<double>& b) {
+                return exp(-dist2(a, b) / l2);
+            };
+
+            // Cholesky factor L of K + noise*I.
+            vector<double> lm(n * n, 0.);
+            for (size_t i = 0; i < n; i++) {
+                for (size_t j = 0; j <= i; j++) {
+                    double sum = kern(xs[i], xs[j]);
+                    if (i == j)
+                        sum += noise;
+                    for (size_t k = 0; k < j; k++)
+                        sum -= lm[i * n + k] * lm[j * n + k];
+                    lm[i * n + j] = (i == j) ? sqrt(max(sum, 1e-12)) : sum / lm[j * n + j];
+                }
+            }
+
+            // Solve L*v = b for v.
+            auto lsolve = [&](vector<double> b) {
+                for (size_t i = 0; i < n; i++) {
+                    for (size_t k = 0; k < i; k++)
+                        b[i] -= lm[i * n + k] * b[k];
+                    b[i] /= lm[i * n + i];
+                }
+                return b;
+            };
+
+            // alpha = (K + noise*I)^-1 * y.
+            auto alpha = lsolve(yn);
+            for (size_t ii = n; ii > 0; ii--) {
+                size_t i = ii - 1;
+                for (size_t k = i + 1; k < n; k++)
+                    alpha[i] -= lm[k * n + i] * alpha[k];
+                alpha[i] /= lm[i * n + i];
+            }
+
+            // Find the candidate with the max expected improvement.
+            double best_ei = -1.;
+            for (auto cand : open) {
+                auto x = to_unit(*cand);
+                vector<double> ks(n);
+                double mu = 0.;
+                for (size_t i = 0; i < n; i++) {
+                    ks[i] = kern(x, xs[i]);
+                    mu += ks[i] * alpha[i];
+                }
+                auto v = lsolve(ks);
+                double var = 1.;
+                for (auto vi : v)
+                    var -= vi * vi;
+                double sd = sqrt(max(var, 1e-12));
+                double imp = mu - ybest;
+                double z = imp / sd;
+                double ei = imp * 0.5 * erfc(-z / sqrt(2.)) +
+                    sd * exp(-0.5 * z * z) / sqrt(2. * M_PI);
+                if (ei > best_ei) {
+                    best_ei = ei;
+                    next = cand;
+                }
+            }
+
+            // Stop if no candidate is expected to be much better.
+            double gain = best_ei * ystd;
+            TRACE_MSG2("auto-tuner: max expected gain " << gain << " with " << descr << " " <<
+                       next->makeDimValStr(" * "));
+            if (gain < model_min_gain) {
+                os << "auto-tuner: done searching " << descr << " after " <<
+                    results.size() << " setting(s)" << endl;
+                return false;
+            }
+        }
+
+        // Run next step with this setting.
+        tried.insert(*next);
+        set_vals(*next);
+        return true;
     }
     
     // Apply auto-tuning to some of the settings.
@@ -777,47 +1699,236 @@ namespace yask {
         YaskTimer at_timer;
         at_timer.start();
 
-        // Temporarily disable halo exchange to tune intra-rank.
-        enable_halo_exchange = false;
+        // Temporarily disable halo exchange to tune intra-rank
+        // unless tuning for end-to-end step time.
+        bool tune_mpi = _opts->tune_halo_exchange && _env->num_ranks > 1;
+        enable_halo_exchange = tune_mpi;
+        if (tune_mpi)
+            os << "Including halo exchange in auto-tuner measurements.\n";
         
-        // Init tuner.
-        _at.clear(false, verbose);
+        // Use a sample in the center of the rank domain if requested.
+        // Its size is rounded up to a multiple of the cluster size.
+        use_tune_sample = false;
+        tune_sample_begin = bb_begin;
+        tune_sample_end = bb_end;
+        idx_t sample_pts = 1;
+        for (auto& dim : _dims->_domain_dims.getDims()) {
+            auto& dname = dim.getName();
+            auto sz = _opts->_tune_sample_sizes[dname];
+            auto len = bb_len[dname];
+            auto clen = _dims->_cluster_pts[dname];
+            if (sz > 0 && ROUND_UP(sz, clen) < len) {
+                sz = ROUND_UP(sz, clen);
+                tune_sample_begin[dname] = bb_begin[dname] + ROUND_DOWN((len - sz) / 2, clen);
+                tune_sample_end[dname] = tune_sample_begin[dname] + sz;
+                use_tune_sample = true;
+            }
+            sample_pts *= tune_sample_end[dname] - tune_sample_begin[dname];
+        }
+        tune_sample_frac = double(sample_pts) / bb_size;
+        if (use_tune_sample)
+            os << "Auto-tuning in sample " << tune_sample_begin.makeDimValStr() <<
+                " ... (end before) " << tune_sample_end.makeDimValStr() <<
+                " (" << (tune_sample_frac * 100.) << "% of rank domain).\n";
+
+        // Init tuner. Region sizes may be searched because
+        // they are only changed between calls to run_solution() below.
+        _at.clear(false, verbose, true);
 
         // Reset stats.
         clear_timers();
 
-        // Determine number of sets to run.
-        // If wave-fronts are enabled, run a max number of these steps.
-        // TODO: only run one region during AT.
-        idx_t region_steps = _opts->_region_sizes[_dims->_step_dim];
-        idx_t step_t = min(region_steps, idx_t(3));
-        
         // Run time-steps until AT converges.
         bool done = false;
-        for (idx_t t = 0; !done; t += step_t) {
+        for (idx_t t = 0; !done; ) {
 
-            // Run a time-step.
+            // Run the steps in one temporal region, so the AT
+            // is evaluated once per call.
+            idx_t step_t = _opts->_region_sizes[_dims->_step_dim];
             run_solution(t, t + step_t - 1);
+            t += step_t;
 
             // done on this rank?
             done = _at.is_done();
+
+            // When exchanging halos, all ranks must run the same steps,
+            // so continue until every rank's tuner is done. Ranks that
+            // are done keep running with their best settings.
+            if (tune_mpi)
+                done = sumOverRanks(done ? 1 : 0, _env->comm) == _env->num_ranks;
+        }
+
+        // Wait for all ranks to finish.
+        _env->global_barrier();
+
+        // reenable halo exchange and use whole domain.
+        enable_halo_exchange = true;
+        use_tune_sample = false;
+        tune_sample_frac = 1.;
+        
+        // Report results.
+        at_timer.stop();
+        os << "Auto-tuner done after " << steps_done << " step(s) in " <<
+            at_timer.get_elapsed_secs() << " secs.\n";
+        os << "best-region-size: " << _opts->_region_sizes.makeDimValStr(" * ") << endl;
+        os << "best-block-size: " << _opts->_block_sizes.makeDimValStr(" * ") << endl;
+        os << "best-block-group-size: " << _opts->_block_group_sizes.makeDimValStr(" * ") << endl;
+        os << "best-block-threads: " << _opts->num_block_threads << endl;
+        os << "best-sub-block-size: " << _opts->_sub_block_sizes.makeDimValStr(" * ") << endl;
+        os << "best-sub-block-group-size: " << _opts->_sub_block_group_sizes.makeDimValStr(" * ") << endl;
+        os << "best-prefetch-distances: L1=" << _opts->_prefetch_L1_dist <<
+            ", L2=" << _opts->_prefetch_L2_dist << endl;
+        os << "best-loop-variants: region=" << _opts->_region_loop_variant <<
+            ", block=" << _opts->_block_loop_variant <<
+            ", sub-block=" << _opts->_sub_block_loop_variant << endl << flush;
+
+        // Reset stats.
+        clear_timers();
+    }
+    
+    // Key identifying this solution in an auto-tuner DB.  Tuned settings
+    // are only reused for the same stencil, target, vector and cluster
+    // shapes, rank-domain sizes, number of ranks and threads, and
+    // element size.
+    string StencilContext::get_tuner_db_key() const {
+        IdxTuple rank_sizes;
+        for (auto& dim : _dims->_domain_dims.getDims()) {
+            auto& dname = dim.getName();
+            rank_sizes.addDimBack(dname, _opts->_rank_sizes[dname]);
+        }
+        ostringstream oss;
+        oss << "stencil=" << get_name() <<
+            " arch=" << ARCH_NAME <<
+            " real_bytes=" << REAL_BYTES <<
+            " fold=" << _dims->_fold_pts.makeDimValStr(",") <<
+            " cluster=" << _dims->_cluster_pts.makeDimValStr(",") <<
+            " rank_domain=" << rank_sizes.makeDimValStr(",") <<
+            " ranks=" << _env->num_ranks <<
+            " threads=" << max(1, _opts->max_threads / _opts->thread_divisor);
+        return oss.str();
+    }
+
+    // Tuned settings as command-line options.
+    string StencilContext::get_tuned_options() const {
+        auto& step_dim = _dims->_step_dim;
+        ostringstream oss;
+        oss << "-r" << step_dim << " " << _opts->_region_sizes[step_dim];
+        auto add_sizes = [&](const string& prefix, const IdxTuple& sizes) {
+            for (auto& dim : _dims->_domain_dims.getDims()) {
+                auto& dname = dim.getName();
+                oss << " -" << prefix << dname << " " << sizes[dname];
+            }
+        };
+        add_sizes("r", _opts->_region_sizes);
+        add_sizes("bg", _opts->_block_group_sizes);
+        add_sizes("b", _opts->_block_sizes);
+        add_sizes("sbg", _opts->_sub_block_group_sizes);
+        add_sizes("sb", _opts->_sub_block_sizes);
+        oss << " -block_threads " << _opts->num_block_threads;
+        oss << " -pfd_l1 " << _opts->_prefetch_L1_dist <<
+            " -pfd_l2 " << _opts->_prefetch_L2_dist;
+        oss << " -region_loop_variant " << _opts->_region_loop_variant <<
+            " -block_loop_variant " << _opts->_block_loop_variant <<
+            " -sub_block_loop_variant " << _opts->_sub_block_loop_variant;
+        return oss.str();
+    }
+
+    // Apply settings from an auto-tuner DB.
+    // Each line in the file is a key and options separated by a tab.
+    bool StencilContext::load_auto_tuner_db(const string& file_name) {
+        if (!bb_valid) {
+            cerr << "Error: load_auto_tuner_db() called without calling prepare_solution() first.\n";
+            exit_yask(1);
+        }
+        ostream& os = get_ostr();
+        auto key = get_tuner_db_key();
+
+        // Find the last entry for this key.
+        ifstream ifs(file_name);
+        string line, args;
+        bool found = false;
+        while (getline(ifs, line)) {
+            if (line.empty() || line[0] == '#')
+                continue;
+            auto tab = line.find('\t');
+            if (tab != string::npos && line.substr(0, tab) == key) {
+                args = line.substr(tab + 1);
+                found = true;
+            }
+        }
+
+        // Use the settings only if every rank found an entry, so that
+        // all ranks make the same collective calls afterward.
+        if (sumOverRanks(found ? 1 : 0, _env->comm) != _env->num_ranks) {
+            os << "No auto-tuner settings for this solution" <<
+                (found ? " on all ranks" : "") << " in '" << file_name << "'.\n";
+            return false;
         }
 
-        // Wait for all ranks to finish.
-        _env->global_barrier();
+        // Stop any search in progress, then apply the settings.
+        bool enabled = !_at.is_done();
+        _at.clear(true);
+        auto rem = apply_command_line_options(args);
+        if (rem.length()) {
+            cerr << "Error: unrecognized auto-tuner settings '" << rem <<
+                "' in '" << file_name << "'.\n";
+            exit_yask(1);
+        }
+        yask_output_factory yof;
+        auto nullop = yof.new_null_output();
+        _opts->adjustSettings(nullop->get_ostream(), _env);
+        find_wf_angles();
+        os << "Applying auto-tuner settings from '" << file_name << "': " << args << endl;
+
+        // Restart the search from these settings if it was enabled.
+        _at.clear(!enabled);
+        return true;
+    }
 
-        // reenable halo exchange.
-        enable_halo_exchange = true;
-        
-        // Report results.
-        at_timer.stop();
-        os << "Auto-tuner done after " << steps_done << " step(s) in " <<
-            at_timer.get_elapsed_secs() << " secs.\n";
-        os << "best-block-size: " << _opts->_block_sizes.makeDimValStr(" * ") << endl << flush;
-        os << "best-sub-block-size: " << _opts->_sub_block_sizes.makeDimValStr(" * ") << endl << flush;
+    // Add or replace the entry for this solution in an auto-tuner DB.
+    void StencilContext::save_auto_tuner_db(const string& file_name) {
+        ostream& os = get_ostr();
+        auto key = get_tuner_db_key();
+        auto entry = key + "\t" + get_tuned_options();
 
-        // Reset stats.
-        clear_timers();
+        // Ranks may have different keys, so they update the file one at a
+        // time.  Each writes a new file and renames it, so a reader never
+        // sees a partial file.
+        for (int rn = 0; rn < _env->num_ranks; rn++) {
+            if (rn == _env->my_rank) {
+                vector<string> lines;
+                bool found = false;
+                ifstream ifs(file_name);
+                string line;
+                while (getline(ifs, line)) {
+                    auto tab = line.find('\t');
+                    if (tab != string::npos && line.substr(0, tab) == key) {
+                        if (!found)
+                            lines.push_back(entry);
+                        found = true;
+                    }
+                    else
+                        lines.push_back(line);
+                }
+                ifs.close();
+                if (lines.empty())
+                    lines.push_back("# YASK auto-tuner settings: key<tab>options.");
+                if (!found)
+                    lines.push_back(entry);
+
+                string tmp_name = file_name + ".tmp";
+                ofstream ofs(tmp_name);
+                for (auto& l : lines)
+                    ofs << l << endl;
+                ofs.close();
+                if (!ofs || rename(tmp_name.c_str(), file_name.c_str()) != 0) {
+                    cerr << "Error: cannot write auto-tuner settings to '" << file_name << "'.\n";
+                    exit_yask(1);
+                }
+            }
+            _env->global_barrier();
+        }
+        os << "Saved auto-tuner settings to '" << file_name << "'.\n";
     }
     
     // Add a new grid to the containers.
@@ -849,6 +1960,9 @@ namespace yask {
         auto& step_dim = _dims->_step_dim;
         auto me = _env->my_rank;
 
+        // Determine my coordinates if not provided already.
+        findRankIndices();
+
         // Check ranks.
         idx_t req_ranks = _opts->_num_ranks.product();
         if (req_ranks != _env->num_ranks) {
@@ -859,10 +1973,8 @@ namespace yask {
         }
         assertEqualityOverRanks(_opts->_rank_sizes[step_dim], _env->comm, "num steps");
 
-        // Determine my coordinates if not provided already.
-        // TODO: do this more intelligently based on proximity.
-        if (_opts->find_loc)
-            _opts->_rank_indices = _opts->_num_ranks.unlayout(me);
+        // Adjust my sizes if requested.
+        balanceRankSizes();
 
         // A table of rank-coordinates for everyone.
         auto num_ddims = _opts->_rank_indices.size(); // domain-dims only!
@@ -890,6 +2002,22 @@ namespace yask {
                       rn, _env->comm);
         }
         // Now, the tables are filled in for all ranks.
+
+        // Translate all ranks to their indices in the shared-memory
+        // communicator. MPI_UNDEFINED => not on this node.
+        vector<int> shm_ranks(_env->num_ranks, MPI_UNDEFINED);
+        {
+            vector<int> ranks(_env->num_ranks);
+            for (int rn = 0; rn < _env->num_ranks; rn++)
+                ranks[rn] = rn;
+            MPI_Group group, shm_group;
+            MPI_Comm_group(_env->comm, &group);
+            MPI_Comm_group(_env->shm_comm, &shm_group);
+            MPI_Group_translate_ranks(group, _env->num_ranks, ranks.data(),
+                                      shm_group, shm_ranks.data());
+            MPI_Group_free(&group);
+            MPI_Group_free(&shm_group);
+        }
 #endif
 
         // Init offsets and total sizes.
@@ -1007,12 +2135,21 @@ namespace yask {
 
                 // Save rank of this neighbor into the MPI info object.
                 _mpiInfo->my_neighbors.at(rn_ofs) = rn;
+
+                // Save its shared-memory rank if on this node.
+                bool is_shm = false;
+#ifdef USE_MPI
+                if (rn != me && shm_ranks[rn] != MPI_UNDEFINED) {
+                    _mpiInfo->shm_ranks.at(rn_ofs) = shm_ranks[rn];
+                    is_shm = true;
+                }
+#endif
                 if (rn != me) {
                     num_neighbors++;
                     os << "Neighbor #" << num_neighbors << " is rank " << rn <<
                         " at absolute rank indices " << rcoords.makeDimValStr() <<
                         " (" << rdeltas.makeDimValOffsetStr() << " relative to rank " <<
-                        me << ")\n";
+                        me << ")" << (is_shm ? " on same node" : "") << "\n";
                 }
 
                 // Save manhattan dist.
@@ -1053,33 +2190,700 @@ namespace yask {
         update_grids();
     }
 
+    // Set number of ranks where not specified and find my logical
+    // rank indices.
+    void StencilContext::findRankIndices()
+    {
+        ostream& os = get_ostr();
+        auto me = _env->my_rank;
+        auto& nr = _opts->_num_ranks;
+        int num_ddims = nr.size();
+        auto& layout = _opts->rank_layout;
+
+        if (layout != "simple" && layout != "cart" && layout != "node") {
+            cerr << "Error: rank layout '" << layout <<
+                "' is not one of 'simple', 'cart', or 'node'." << endl;
+            exit_yask(1);
+        }
+
+#ifdef USE_MPI
+        // Fill in any zero-sized dims.
+        if (nr.min() == 0) {
+            idx_t nknown = 1;
+            for (int di = 0; di < num_ddims; di++)
+                if (nr[di] > 0)
+                    nknown *= nr[di];
+            if (_env->num_ranks % nknown != 0) {
+                cerr << "Error: " << _env->num_ranks << " rank(s) cannot be divided among " <<
+                    nr.makeDimValStr(" * ") << " ranks." << endl;
+                exit_yask(1);
+            }
+            vector<int> dims(num_ddims);
+            for (int di = 0; di < num_ddims; di++)
+                dims[di] = int(nr[di]);
+            MPI_Dims_create(_env->num_ranks, num_ddims, dims.data());
+            for (int di = 0; di < num_ddims; di++)
+                nr[di] = dims[di];
+            os << "Num ranks set to " << nr.makeDimValStr(" * ") << endl;
+        }
+#endif
+        if (!_opts->find_loc)
+            return;
+
+        // Default: lay out ranks in order of MPI index.
+        _opts->_rank_indices = nr.unlayout(me);
+        if (layout == "simple" || _env->num_ranks < 2 ||
+            nr.product() != _env->num_ranks)
+            return;         // product mismatch reported by caller.
+
+#ifdef USE_MPI
+        // Let the MPI library reorder ranks to fit the topology.
+        if (layout == "cart") {
+            vector<int> dims(num_ddims), periods(num_ddims, 0), coords(num_ddims);
+            for (int di = 0; di < num_ddims; di++)
+                dims[di] = int(nr[di]);
+            MPI_Comm cart_comm;
+            MPI_Cart_create(_env->comm, num_ddims, dims.data(), periods.data(),
+                            1, &cart_comm);
+            int cart_rank;
+            MPI_Comm_rank(cart_comm, &cart_rank);
+            MPI_Cart_coords(cart_comm, cart_rank, num_ddims, coords.data());
+            MPI_Comm_free(&cart_comm);
+            for (int di = 0; di < num_ddims; di++)
+                _opts->_rank_indices[di] = coords[di];
+            os << "Rank indices assigned by MPI_Cart_create()" << endl;
+            return;
+        }
+
+        // Node-aware layout.
+        // Identify each node by the lowest MPI index on it.
+        int leader = me;
+        MPI_Allreduce(&me, &leader, 1, MPI_INT, MPI_MIN, _env->shm_comm);
+        vector<int> leaders(_env->num_ranks);
+        MPI_Allgather(&leader, 1, MPI_INT, leaders.data(), 1, MPI_INT, _env->comm);
+        map<int, int> node_sizes; // key: leader; val: num ranks on node.
+        for (auto l : leaders)
+            node_sizes[l]++;
+        int num_nodes = node_sizes.size();
+        int node_idx = 0;
+        for (auto& ni : node_sizes) {
+            if (ni.second != _env->num_shm_ranks) {
+                os << "Warning: 'node' rank layout requires the same number of ranks on each node;"
+                    " using 'simple' layout." << endl;
+                return;
+            }
+            if (ni.first < leader)
+                node_idx++;
+        }
+
+        // Find shape of ranks on one node that divides the global
+        // rank layout and minimizes the total area of the rank-domain
+        // faces between nodes.
+        IdxTuple node_shape = nr, best_shape;
+        best_shape.setValsSame(0);
+        double best_cost = 0.;
+        function<void (int di, idx_t n)> try_shapes =
+            [&](int di, idx_t n) {
+            if (di == num_ddims) {
+                if (n != 1)
+                    return;
+                double cost = 0.;
+                for (int dj = 0; dj < num_ddims; dj++) {
+                    double area = 1.;
+                    for (int dk = 0; dk < num_ddims; dk++)
+                        if (dk != dj)
+                            area *= double(nr[dk]) * max(_opts->_rank_sizes[dk], idx_t(1));
+                    cost += double(nr[dj] / node_shape[dj] - 1) * area;
+                }
+                if (best_shape.min() == 0 || cost < best_cost) {
+                    best_shape = node_shape;
+                    best_cost = cost;
+                }
+                return;
+            }
+            for (idx_t s = 1; s <= n; s++) {
+                if (n % s == 0 && nr[di] % s == 0) {
+                    node_shape[di] = s;
+                    try_shapes(di + 1, n / s);
+                }
+            }
+        };
+        try_shapes(0, _env->num_shm_ranks);
+        if (best_shape.min() == 0) {
+            os << "Warning: cannot fit " << _env->num_shm_ranks <<
+                " rank(s) per node into " << nr.makeDimValStr(" * ") <<
+                " ranks; using 'simple' layout." << endl;
+            return;
+        }
+
+        // My indices are the indices of my node within the grid of nodes
+        // plus my indices within my node.
+        IdxTuple node_grid = nr;
+        for (int di = 0; di < num_ddims; di++)
+            node_grid[di] = nr[di] / best_shape[di];
+        auto node_idxs = node_grid.unlayout(node_idx);
+        auto local_idxs = best_shape.unlayout(_env->my_shm_rank);
+        for (int di = 0; di < num_ddims; di++)
+            _opts->_rank_indices[di] = node_idxs[di] * best_shape[di] + local_idxs[di];
+        os << "Rank indices assigned by node: " << num_nodes << " node(s) of " <<
+            best_shape.makeDimValStr(" * ") << " ranks each" << endl;
+#endif
+    }
+
+    // Set rank-domain sizes based on a cost model.  The cost of a point
+    // is the sum of the FP ops of each stencil group that is valid at
+    // that point.  The overall domain is split independently in each dim
+    // so that the result is still a tensor-product decomposition.
+    void StencilContext::balanceRankSizes()
+    {
+        if (!_opts->balance_ranks || _opts->ranks_balanced || _env->num_ranks < 2)
+            return;
+        ostream& os = get_ostr();
+        auto& nr = _opts->_num_ranks;
+        auto& rs = _opts->_rank_sizes;
+        auto& sdims = _dims->_stencil_dims;
+        int nsdims = sdims.size();
+
+        // Overall problem size.
+        // Set it now so sub-domain conditions will be evaluated
+        // correctly; it is recalculated later.
+        for (auto& dim : _dims->_domain_dims.getDims()) {
+            auto& dname = dim.getName();
+            assertEqualityOverRanks(rs[dname], _env->comm,
+                                    string("rank-domain size in '") + dname +
+                                    "' when balancing ranks");
+            overall_domain_sizes[dname] = nr[dname] * rs[dname];
+        }
+
+        // Indices and weights of points to sample in a dim of size n.
+        // Points near the edges are always sampled because that is where
+        // boundary conditions are usually applied.
+        auto get_samples = [](idx_t n) {
+            const idx_t nedge = 4, ninner = 24;
+            vector<pair<idx_t, idx_t>> samples;
+            if (n <= 2 * nedge + ninner) {
+                for (idx_t i = 0; i < n; i++)
+                    samples.push_back({ i, 1 });
+            } else {
+                idx_t n2 = n - 2 * nedge;
+                for (idx_t i = 0; i < nedge; i++)
+                    samples.push_back({ i, 1 });
+                for (idx_t j = 0; j < ninner; j++) {
+                    idx_t b = nedge + n2 * j / ninner;
+                    idx_t e = nedge + n2 * (j + 1) / ninner;
+                    samples.push_back({ (b + e) / 2, e - b });
+                }
+                for (idx_t i = n - nedge; i < n; i++)
+                    samples.push_back({ i, 1 });
+            }
+            return samples;
+        };
+
+        // Split each dim independently.
+        for (auto& dim : _dims->_domain_dims.getDims()) {
+            auto& dname = dim.getName();
+            idx_t nranks = nr[dname];
+            if (nranks < 2)
+                continue;
+            idx_t osize = overall_domain_sizes[dname];
+            int dposn = sdims.lookup_posn(dname);
+
+            // Samples in other domain dims.
+            vector<vector<pair<idx_t, idx_t>>> other_samples(nsdims);
+            IdxTuple nsamples = sdims;
+            nsamples.setValsSame(1);
+            for (int di = 0; di < nsdims; di++) {
+                auto& dn = sdims.getDimName(di);
+                if (dn == dname || dn == _dims->_step_dim) {
+                    other_samples[di].push_back({ 0, 1 });
+                    continue;
+                }
+                other_samples[di] = get_samples(overall_domain_sizes[dn]);
+                nsamples[di] = other_samples[di].size();
+            }
+
+            // Cost of each slice across this dim.
+            vector<double> cost(osize, 0.);
+#pragma omp parallel for schedule(dynamic)
+            for (idx_t i = 0; i < osize; i++) {
+                Indices idxs(nsdims);
+                nsamples.visitAllPoints([&](const IdxTuple& spt, size_t) {
+                        idx_t wt = 1;
+                        for (int di = 0; di < nsdims; di++) {
+                            auto& s = other_samples[di][spt[di]];
+                            idxs[di] = s.first;
+                            wt *= s.second;
+                        }
+                        idxs[dposn] = i;
+                        for (auto* sg : stGroups)
+                            if (sg->is_in_valid_domain(idxs))
+                                cost[i] += double(wt) * sg->get_scalar_fp_ops();
+                        return true;
+                    });
+            }
+
+            // Prefix sums.
+            vector<double> psum(osize + 1, 0.);
+            for (idx_t i = 0; i < osize; i++)
+                psum[i + 1] = psum[i] + cost[i];
+
+            // Find boundaries between ranks, rounding to vector multiples
+            // and keeping each rank at least as big as the halos.
+            auto vlen = _dims->_fold_pts[dname];
+            idx_t min_size = ROUND_UP(max(max_halos[dname], idx_t(1)), vlen);
+            vector<idx_t> bounds(nranks + 1, 0);
+            bounds[nranks] = osize;
+            for (idx_t ri = 1; ri < nranks; ri++) {
+                double target = psum[osize] * ri / nranks;
+                idx_t b = lower_bound(psum.begin(), psum.end(), target) - psum.begin();
+                if (b > 0 && target - psum[b - 1] < psum[b] - target)
+                    b--;
+                b = ((b + vlen / 2) / vlen) * vlen;
+                b = max(b, bounds[ri - 1] + min_size);
+                b = min(b, osize - (nranks - ri) * min_size);
+                bounds[ri] = b;
+            }
+            if (bounds[1] < min_size || bounds[nranks] - bounds[nranks - 1] < min_size) {
+                cerr << "Error: cannot balance " << nranks << " ranks across " <<
+                    osize << " points in '" << dname << "'." << endl;
+                exit_yask(1);
+            }
+
+            // Set my size.
+            idx_t ri = _opts->_rank_indices[dname];
+            rs[dname] = bounds[ri + 1] - bounds[ri];
+            os << "Balanced rank-domain sizes in '" << dname << "':";
+            for (idx_t rj = 0; rj < nranks; rj++)
+                os << " " << (bounds[rj + 1] - bounds[rj]);
+            os << endl;
+        }
+        _opts->ranks_balanced = true;
+    }
+
+    // Move rank boundaries based on measured compute time.  Boundaries
+    // in each dim move independently, so the result is still a
+    // tensor-product decomposition.
+    bool StencilContext::rebalanceRanks(double compute_secs)
+    {
+#ifdef USE_MPI
+        ostream& os = get_ostr();
+        auto me = _env->my_rank;
+        int nranks = _env->num_ranks;
+        auto& nr = _opts->_num_ranks;
+        auto& rs = _opts->_rank_sizes;
+        auto& ddims = _dims->_domain_dims;
+        int nddims = ddims.size();
+
+        // Share times, indices, offsets and sizes of all ranks.
+        vector<double> times(nranks);
+        MPI_Allgather(&compute_secs, 1, MPI_DOUBLE, times.data(), 1, MPI_DOUBLE, _env->comm);
+        vector<idx_t> my_info(nddims * 3);
+        for (int di = 0; di < nddims; di++) {
+            auto& dname = ddims.getDimName(di);
+            my_info[di * 3] = _opts->_rank_indices[dname];
+            my_info[di * 3 + 1] = rank_domain_offsets[dname];
+            my_info[di * 3 + 2] = rs[dname];
+        }
+        vector<idx_t> info(nranks * nddims * 3);
+        MPI_Allgather(my_info.data(), nddims * 3, MPI_INTEGER8,
+                      info.data(), nddims * 3, MPI_INTEGER8, _env->comm);
+        auto rank_idx = [&](int rn, int di) { return info[(rn * nddims + di) * 3]; };
+        auto rank_ofs = [&](int rn, int di) { return info[(rn * nddims + di) * 3 + 1]; };
+        auto rank_size = [&](int rn, int di) { return info[(rn * nddims + di) * 3 + 2]; };
+
+        // New offsets and sizes of all ranks.
+        vector<idx_t> new_ofs(nranks * nddims), new_size(nranks * nddims);
+        for (int rn = 0; rn < nranks; rn++)
+            for (int di = 0; di < nddims; di++) {
+                new_ofs[rn * nddims + di] = rank_ofs(rn, di);
+                new_size[rn * nddims + di] = rank_size(rn, di);
+            }
+
+        // Find new sizes in each dim.
+        bool changed = false;
+        for (int di = 0; di < nddims; di++) {
+            auto& dname = ddims.getDimName(di);
+            idx_t nri = nr[dname];
+            if (nri < 2)
+                continue;
+
+            // Time at each index in this dim is that of the slowest rank
+            // at that index; size is the same for all of them.
+            vector<double> itimes(nri, 0.);
+            vector<idx_t> isizes(nri, 0);
+            for (int rn = 0; rn < nranks; rn++) {
+                auto ri = rank_idx(rn, di);
+                itimes[ri] = max(itimes[ri], times[rn]);
+                isizes[ri] = rank_size(rn, di);
+            }
+            double tmax = 0., tsum = 0.;
+            for (auto t : itimes) {
+                tmax = max(tmax, t);
+                tsum += t;
+            }
+            double tmean = tsum / nri;
+            if (tmean <= 0. || (tmax / tmean - 1.) * 100. < _opts->rebalance_pct)
+                continue;
+
+            // New sizes are proportional to measured speed.  Boundaries
+            // only move half way to avoid oscillating on noisy timings.
+            idx_t osize = 0;
+            double speed_sum = 0.;
+            vector<double> speeds(nri);
+            for (idx_t ri = 0; ri < nri; ri++) {
+                osize += isizes[ri];
+                speeds[ri] = double(isizes[ri]) / max(itimes[ri], 1e-9);
+                speed_sum += speeds[ri];
+            }
+            auto clen = _dims->_cluster_pts[dname];
+            idx_t min_size = ROUND_UP(max(max_halos[dname], idx_t(1)), clen);
+            vector<idx_t> bounds(nri + 1, 0);
+            bounds[nri] = osize;
+            double cum = 0.;
+            idx_t obound = 0;
+            for (idx_t ri = 1; ri < nri; ri++) {
+                cum += speeds[ri - 1] / speed_sum * osize;
+                obound += isizes[ri - 1];
+                double tgt = (cum + obound) / 2.;
+                idx_t b = idx_t(tgt + clen / 2.) / clen * clen;
+                b = max(b, bounds[ri - 1] + min_size);
+                b = min(b, osize - (nri - ri) * min_size);
+                bounds[ri] = b;
+            }
+            if (bounds[1] < min_size || bounds[nri] - bounds[nri - 1] < min_size)
+                continue;
+
+            // Apply.
+            bool dchanged = false;
+            for (int rn = 0; rn < nranks; rn++) {
+                auto ri = rank_idx(rn, di);
+                idx_t sz = bounds[ri + 1] - bounds[ri];
+                if (sz != rank_size(rn, di))
+                    dchanged = true;
+                new_ofs[rn * nddims + di] = bounds[ri];
+                new_size[rn * nddims + di] = sz;
+            }
+            if (dchanged) {
+                changed = true;
+                os << "Rebalancing rank-domain sizes in '" << dname << "' (" <<
+                    makeNumStr((tmax / tmean - 1.) * 100.) << "% imbalance):";
+                for (idx_t ri = 0; ri < nri; ri++)
+                    os << " " << (bounds[ri + 1] - bounds[ri]);
+                os << endl;
+            }
+        }
+        if (!changed)
+            return false;
+
+        // Migrate data.
+        // For each grid, copy the intersection of each old domain with
+        // each new domain. Old domains are extended by the halo only at
+        // the edges of the overall problem, where halos are not
+        // exchanged, so they don't overlap. New domains are extended by
+        // the halo on all sides to fill the corners that are not
+        // covered by halo exchanges.
+        auto ext_box = [&](YkGridPtr gp, int rn, bool is_new,
+                           Indices& first, Indices& last) {
+            bool ok = true;
+            for (int i = 0; i < gp->get_num_dims(); i++) {
+                auto& dname = gp->get_dim_name(i);
+                int di = ddims.lookup_posn(dname);
+                if (di >= 0) {
+                    idx_t ofs = is_new ? new_ofs[rn * nddims + di] : rank_ofs(rn, di);
+                    idx_t sz = is_new ? new_size[rn * nddims + di] : rank_size(rn, di);
+                    first[i] = ofs;
+                    last[i] = ofs + sz - 1;
+                    if (is_new || rank_idx(rn, di) == 0)
+                        first[i] -= gp->get_left_halo_size(dname);
+                    if (is_new || rank_idx(rn, di) == nr[dname] - 1)
+                        last[i] += gp->get_right_halo_size(dname);
+                }
+                else if (dname == _dims->_step_dim) {
+                    first[i] = 0;
+                    last[i] = gp->get_alloc_size(dname) - 1;
+                }
+                else {
+                    first[i] = gp->get_first_misc_index(dname);
+                    last[i] = gp->get_last_misc_index(dname);
+                }
+                if (last[i] < first[i])
+                    ok = false;
+            }
+            return ok;
+        };
+        auto intersect = [&](int nd, Indices& first, Indices& last,
+                             const Indices& first2, const Indices& last2) {
+            bool ok = true;
+            for (int i = 0; i < nd; i++) {
+                first[i] = max(first[i], first2[i]);
+                last[i] = min(last[i], last2[i]);
+                if (last[i] < first[i])
+                    ok = false;
+            }
+            return ok;
+        };
+
+        // Pack and send data from my old domain.
+        struct MigBuf {
+            YkGridPtr gp;
+            int rank;
+            Indices first, last;
+            vector<real_t> data;
+
+            void alloc() {
+                idx_t n = 1;
+                for (int i = 0; i < first.getNumDims(); i++)
+                    n *= last[i] - first[i] + 1;
+                data.resize(n);
+            }
+        };
+        vector<MigBuf> send_bufs, recv_bufs;
+        vector<MPI_Request> reqs;
+        for (size_t gi = 0; gi < gridPtrs.size(); gi++) {
+            auto gp = gridPtrs[gi];
+            if (!gp || gp->is_fixed_size() || !gp->is_storage_allocated())
+                continue;
+            int nd = gp->get_num_dims();
+            for (int rn = 0; rn < nranks; rn++) {
+                MigBuf mb { gp, rn, Indices(nd), Indices(nd) };
+                Indices first2(nd), last2(nd);
+                if (!ext_box(gp, me, false, mb.first, mb.last) ||
+                    !ext_box(gp, rn, true, first2, last2) ||
+                    !intersect(nd, mb.first, mb.last, first2, last2))
+                    continue;
+                mb.alloc();
+                gp->get_elements_in_slice(mb.data.data(), mb.first, mb.last);
+                send_bufs.push_back(move(mb));
+                if (rn == me)
+                    continue;   // local copy.
+                reqs.push_back(MPI_REQUEST_NULL);
+                auto& sb = send_bufs.back();
+                MPI_Isend(sb.data.data(), sb.data.size() * sizeof(real_t), MPI_BYTE,
+                          rn, int(gi), _env->comm, &reqs.back());
+            }
+        }
+
+        // Receive data for my new domain into temporary buffers.  All
+        // transfers are completed before reallocating because allocData()
+        // does its own point-to-point communication.
+        for (size_t gi = 0; gi < gridPtrs.size(); gi++) {
+            auto gp = gridPtrs[gi];
+            if (!gp || gp->is_fixed_size() || !gp->is_storage_allocated())
+                continue;
+            int nd = gp->get_num_dims();
+            for (int rn = 0; rn < nranks; rn++) {
+                if (rn == me)
+                    continue;
+                MigBuf mb { gp, rn, Indices(nd), Indices(nd) };
+                Indices first2(nd), last2(nd);
+                if (!ext_box(gp, rn, false, mb.first, mb.last) ||
+                    !ext_box(gp, me, true, first2, last2) ||
+                    !intersect(nd, mb.first, mb.last, first2, last2))
+                    continue;
+                mb.alloc();
+                recv_bufs.push_back(move(mb));
+                reqs.push_back(MPI_REQUEST_NULL);
+                auto& rb = recv_bufs.back();
+                MPI_Irecv(rb.data.data(), rb.data.size() * sizeof(real_t), MPI_BYTE,
+                          rn, int(gi), _env->comm, &reqs.back());
+            }
+        }
+        MPI_Waitall(int(reqs.size()), reqs.data(), MPI_STATUSES_IGNORE);
+
+        // Set my new domain.
+        for (int di = 0; di < nddims; di++)
+            rs[ddims.getDimName(di)] = new_size[me * nddims + di];
+
+        // Release all data and realloc for new domain.
+        // Silence the usual messages.
+        auto* saved_ostr = _ostr;
+        yask_output_factory yof;
+        auto nullop = yof.new_null_output();
+        _ostr = &nullop->get_ostream();
+        mpiData.clear();
+        freeShmWindow();
+        for (auto gp : gridPtrs) {
+            if (gp && !gp->is_fixed_size())
+                gp->release_storage();
+        }
+        update_grids();
+        setupRank();
+        find_bounding_boxes();
+        allocData();
+        _ostr = saved_ostr;
+
+        // Unpack data into my new domain.
+        for (auto& rb : recv_bufs)
+            rb.gp->set_elements_in_slice(rb.data.data(), rb.first, rb.last);
+        for (auto& sb : send_bufs)
+            if (sb.rank == me)
+                sb.gp->set_elements_in_slice(sb.data.data(), sb.first, sb.last);
+
+        // Halos must be exchanged before next use.
+        for (auto gp : gridPtrs)
+            if (gp)
+                gp->set_dirty_all(true);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Policies are from yk_grid::set_mem_policy() or 'mem_policy'.
+    // 'hbm' and 'ddr' become binds to the fast and other tiers; 'auto'
+    // ranks grids by points read per byte, counted as the points
+    // evaluated by each stencil group that reads the grid, and puts
+    // them in the fast tier in that order while they fit.
+    map<string, string> StencilContext::find_mem_policies(ostream& os) const {
+        map<string, string> policies;
+
+        // Fast-tier nodes and other nodes with memory.
+        auto fast_nodes = _opts->fast_mem_nodes.length() ?
+            parseIntList(_opts->fast_mem_nodes) : getMemNodes(true);
+        vector<int> other_nodes;
+        for (int n : getMemNodes(false))
+            if (find(fast_nodes.begin(), fast_nodes.end(), n) == fast_nodes.end())
+                other_nodes.push_back(n);
+        auto node_str = [](const vector<int>& nodes) {
+            string str;
+            for (int n : nodes)
+                str += (str.length() ? "," : "") + to_string(n);
+            return str;
+        };
+        auto tier_policy = [&](const vector<int>& nodes) {
+            return nodes.size() ? "bind:" + node_str(nodes) : string("default");
+        };
+
+        // Resolve fixed policies, collecting 'auto' grids.
+        GridPtrs auto_grids;
+        bool need_fast = false;
+        for (auto gp : gridPtrs) {
+            if (!gp || gp->is_storage_allocated())
+                continue;
+            auto& gname = gp->get_name();
+            string policy = gp->get_mem_policy();
+            if (policy.empty())
+                policy = _opts->get_mem_policy(gname);
+            auto colon = policy.find(':');
+            string mode = policy.substr(0, colon);
+            if (policy == "default")
+                ;
+            else if (policy == "hbm") {
+                need_fast = true;
+                policy = tier_policy(fast_nodes);
+            }
+            else if (policy == "ddr")
+                policy = tier_policy(other_nodes);
+            else if (policy == "auto") {
+                need_fast = true;
+                auto_grids.push_back(gp);
+                continue;
+            }
+            else if (colon != string::npos &&
+                     (mode == "bind" || mode == "interleave" || mode == "preferred")) {
+                auto nodes = parseIntList(policy.substr(colon + 1));
+                if (nodes.empty() || (mode == "preferred" && nodes.size() != 1)) {
+                    cerr << "Error: memory policy '" << policy << "' for grid '" <<
+                        gname << "' needs " << (mode == "preferred" ? "one node" : "a node list") <<
+                        ".\n";
+                    exit_yask(1);
+                }
+                policy = mode + ":" + node_str(nodes);
+            }
+            else {
+                cerr << "Error: unknown memory policy '" << policy << "' for grid '" <<
+                    gname << "'; use one of 'default', 'hbm', 'ddr', 'auto', "
+                    "'bind:<nodes>', 'interleave:<nodes>', or 'preferred:<node>'.\n";
+                exit_yask(1);
+            }
+            policies[gname] = policy;
+        }
+        if (need_fast && fast_nodes.empty())
+            os << " Note: no fast-tier NUMA nodes found; "
+                "use -fast_mem_nodes to specify them.\n";
+
+        if (auto_grids.size()) {
+
+            // Points read from each grid in one step.
+            map<YkGridPtr, double> reads;
+            for (auto* sg : stGroups)
+                for (auto gp : sg->inputGridPtrs)
+                    reads[gp] += sg->bb_num_points;
+
+            // Capacity of fast tier.
+            idx_t budget = _opts->fast_mem_budget * 1024 * 1024;
+            if (budget <= 0) {
+                budget = 0;
+                for (int n : fast_nodes)
+                    budget += getNodeFreeBytes(n);
+                budget /= max(_env->num_shm_ranks, 1);
+            }
+
+            // Densest first.
+            stable_sort(auto_grids.begin(), auto_grids.end(),
+                        [&](const YkGridPtr& a, const YkGridPtr& b) {
+                            return reads[a] / max(a->get_num_storage_bytes(), idx_t(1)) >
+                                reads[b] / max(b->get_num_storage_bytes(), idx_t(1));
+                        });
+            idx_t fast_bytes = 0;
+            for (auto gp : auto_grids) {
+                auto& gname = gp->get_name();
+                idx_t nbytes = gp->get_num_storage_bytes();
+                bool fast = fast_nodes.size() && reads[gp] > 0 &&
+                    fast_bytes + nbytes <= budget;
+                if (fast)
+                    fast_bytes += nbytes;
+                policies[gname] = tier_policy(fast ? fast_nodes : other_nodes);
+                os << " Memory policy 'auto' for grid '" << gname << "' (" <<
+                    makeNumStr(reads[gp]) << " points read per step in " <<
+                    makeByteStr(nbytes) << "): " << (fast ? "fast" : "other") <<
+                    " tier.\n";
+            }
+            if (fast_nodes.size())
+                os << " Fast-tier usage for 'auto' grids: " << makeByteStr(fast_bytes) <<
+                    " of " << makeByteStr(budget) << ".\n";
+        }
+        return policies;
+    }
+
     // Allocate memory for grids that do not already have storage.
+    // Grids with the same memory policy share one buffer.
     // Create MPI buffers.
-    // TODO: allow different types of memory for different grids, MPI bufs, etc.
     void StencilContext::allocData() {
         ostream& os = get_ostr();
 
+        // Forget buffers that have been freed.
+        _data_bufs.erase(remove_if(_data_bufs.begin(), _data_bufs.end(),
+                                   [](const pair<weak_ptr<char>, size_t>& b) {
+                                       return b.first.expired(); }),
+                         _data_bufs.end());
+
         // Remove any old MPI data. We do this early to give preference
         // to grids for any HBM memory that might be available.
         mpiData.clear();
 
-        // Base ptrs for all default-alloc'd data.
+        // Base ptrs for all default-alloc'd data, one grid buffer per
+        // memory policy.
         // These pointers will be shared by the ones in the grid
         // objects, which will take over ownership when these go
         // out of scope.
-        shared_ptr<char> _grid_data_buf;
+        map<string, shared_ptr<char>> _grid_data_bufs;
         shared_ptr<char> _mpi_data_buf;
 
+        // Memory policy of each grid to be alloc'd.
+        auto mem_policies = find_mem_policies(os);
+
         // Alloc grid memory.
-        // Pass 0: count required size, allocate chunk of memory at end.
-        // Pass 1: distribute parts of already-allocated memory chunk.
+        // Pass 0: count required size, allocate chunk of memory per policy at end.
+        // Pass 1: distribute parts of already-allocated memory chunks.
         for (int pass = 0; pass < 2; pass++) {
             TRACE_MSG("allocData pass " << pass << " for " <<
                       gridPtrs.size() << " grid(s)");
         
-            // Determine how many bytes are needed and actually alloc'd.
-            size_t gbytes = 0, agbytes = 0;
-            int ngrids = 0;
+            // Determine how many bytes are needed and actually alloc'd
+            // for each policy.
+            map<string, size_t> agbytes;
+            map<string, int> ngrids;
         
             // Grids.
             for (auto gp : gridPtrs) {
@@ -1090,39 +2894,70 @@ namespace yask {
                 // Grid data.
                 // Don't alloc if already done.
                 if (!gp->is_storage_allocated()) {
+                    auto& mp = mem_policies.at(gname);
 
                     // Set storage if buffer has been allocated.
                     if (pass == 1) {
-                        gp->set_storage(_grid_data_buf, agbytes);
+                        gp->set_storage(_grid_data_bufs.at(mp), agbytes[mp]);
                         gp->print_info(os);
                         os << endl;
                     }
 
                     // Determine size used (also offset to next location).
-                    gbytes += gp->get_num_storage_bytes();
-                    agbytes += ROUND_UP(gp->get_num_storage_bytes() + _data_buf_pad,
-                                        CACHELINE_BYTES);
-                    ngrids++;
+                    agbytes[mp] += ROUND_UP(gp->get_num_storage_bytes() + _data_buf_pad,
+                                            CACHELINE_BYTES);
+                    ngrids[mp]++;
                     TRACE_MSG(" grid '" << gname << "' needs " <<
-                              makeByteStr(gp->get_num_storage_bytes()));
+                              makeByteStr(gp->get_num_storage_bytes()) <<
+                              " with memory policy '" << mp << "'");
                 }
             }
 
-            // Don't need pad after last one.
-            if (agbytes >= _data_buf_pad)
-                agbytes -= _data_buf_pad;
-
             // Allocate data.
             if (pass == 0) {
-                os << "Allocating " << makeByteStr(agbytes) <<
-                    " for " << ngrids << " grid(s)...\n" << flush;
-                _grid_data_buf = shared_ptr<char>(alignedAlloc(agbytes), AlignedDeleter());
+                for (auto& i : agbytes) {
+                    auto& mp = i.first;
+                    auto nbytes = i.second;
+
+                    // Don't need pad after last one.
+                    if (nbytes >= _data_buf_pad)
+                        nbytes -= _data_buf_pad;
+
+                    os << "Allocating " << makeByteStr(nbytes) <<
+                        " for " << ngrids[mp] << " grid(s)";
+                    if (mp != "default")
+                        os << " with memory policy '" << mp << "'";
+                    os << "...\n" << flush;
+                    string policy;
+                    auto buf = pageAlloc(nbytes, _opts->huge_pages, policy);
+                    _grid_data_bufs[mp] = buf;
+                    _data_bufs.push_back({ buf, nbytes });
+                    if (policy != _opts->huge_pages)
+                        os << " Note: '" << _opts->huge_pages <<
+                            "' pages not available; using '" << policy << "'.\n";
+
+                    // Set NUMA policy before first touch.
+                    if (mp != "default") {
+                        auto colon = mp.find(':');
+                        if (!bindMemory(buf.get(), nbytes, mp.substr(0, colon),
+                                        parseIntList(mp.substr(colon + 1))))
+                            os << " Note: memory policy '" << mp <<
+                                "' not available; using 'default'.\n";
+                    }
+                }
             }
         }
         
 #ifdef USE_MPI
         int num_exchanges = 0;
+        int num_shm_uncoded = 0; // buffers whose requested codec is not used.
         auto me = _env->my_rank;
+
+        // Number of buffer slots for steps in flight.
+        // Must match across ranks because shared-memory send buffers
+        // are laid out by the receiver.
+        int num_slots = max(_opts->halo_buf_slots, 1);
+        assertEqualityOverRanks(num_slots, _env->comm, "number of halo-buffer slots");
         
         // Need to determine the size and shape of all MPI buffers.
         // Visit all neighbors.
@@ -1134,20 +2969,14 @@ namespace yask {
                 // Manhattan dist.
                 int mandist = _mpiInfo->man_dists.at(nidx);
                     
-                // Check against max dist needed.  TODO: determine max dist
-                // automatically from stencils; may not be same for all
-                // grids.
-#ifndef MAX_EXCH_DIST
-#define MAX_EXCH_DIST 3
-#endif
-
-                // Check distance.
-                // TODO: calculate and use exch dist for each grid.
+                // Check against optional global max dist.
+#ifdef MAX_EXCH_DIST
                 if (mandist > MAX_EXCH_DIST) {
                     TRACE_MSG("no halo exchange needed with rank " << nrank <<
                               " because L1-norm = " << mandist);
                     return;     // from lambda fn.
                 }
+#endif
         
                 // Determine size of MPI buffers between nrank and my rank.
                 // Create send and receive buffers for each grid that has a halo
@@ -1157,10 +2986,19 @@ namespace yask {
                         continue;
                     auto& gname = gp->get_name();
 
+                    // Check distance against footprint of this grid
+                    // determined by the stencil compiler.
+                    if (mandist > gp->get_max_exch_dist()) {
+                        TRACE_MSG("no halo exchange needed for grid '" << gname <<
+                                  "' with rank " << nrank <<
+                                  " because L1-norm = " << mandist);
+                        continue;
+                    }
+
                     // Lookup first & last domain indices and halo sizes
                     // for this grid.
                     bool found_delta = false;
-                    IdxTuple halo_sizes, first_idx, last_idx;
+                    IdxTuple left_halo_sizes, right_halo_sizes, first_idx, last_idx;
                     for (auto& dim : _dims->_domain_dims.getDims()) {
                         auto& dname = dim.getName();
                         if (gp->is_dim_used(dname)) {
@@ -1168,8 +3006,10 @@ namespace yask {
                             // Get domain stats for this grid.
                             first_idx.addDimBack(dname, gp->get_first_rank_domain_index(dname));
                             last_idx.addDimBack(dname, gp->get_last_rank_domain_index(dname));
-                            auto halo_size = gp->get_halo_size(dname);
-                            halo_sizes.addDimBack(dname, halo_size);
+                            auto lhalo_size = gp->get_left_halo_size(dname);
+                            auto rhalo_size = gp->get_right_halo_size(dname);
+                            left_halo_sizes.addDimBack(dname, lhalo_size);
+                            right_halo_sizes.addDimBack(dname, rhalo_size);
 
                             // Vectorized exchange allowed based on domain sizes?
                             // Both my rank and neighbor rank must have all domain sizes
@@ -1182,7 +3022,8 @@ namespace yask {
                             // TODO: add a heuristic to avoid increasing by a large factor.
                             if (vec_ok) {
                                 auto vec_size = _dims->_fold_pts[dname];
-                                halo_sizes.setVal(dname, ROUND_UP(halo_size, vec_size));
+                                left_halo_sizes.setVal(dname, ROUND_UP(lhalo_size, vec_size));
+                                right_halo_sizes.setVal(dname, ROUND_UP(rhalo_size, vec_size));
                             }
                             
                             // Is there a neighbor in this domain direction?
@@ -1210,7 +3051,7 @@ namespace yask {
                         IdxTuple copy_end = gp->get_allocs();
 
                         // Adjust along domain dims in this grid.
-                        for (auto& dim : halo_sizes.getDims()) {
+                        for (auto& dim : left_halo_sizes.getDims()) {
                             auto& dname = dim.getName();
 
                             // Init range to whole rank domain (inside halos).
@@ -1230,15 +3071,17 @@ namespace yask {
                                 // Is this neighbor 'before' me in this dim?
                                 if (neigh_ofs == idx_t(MPIInfo::rank_prev)) {
 
-                                    // Only read slice as wide as halo from beginning.
-                                    copy_end[dname] = first_idx[dname] + halo_sizes[dname];
+                                    // Only read slice as wide as neighbor's
+                                    // right halo from beginning.
+                                    copy_end[dname] = first_idx[dname] + right_halo_sizes[dname];
                                 }
                             
                                 // Is this neighbor 'after' me in this dim?
                                 else if (neigh_ofs == idx_t(MPIInfo::rank_next)) {
                                     
-                                    // Only read slice as wide as halo before end.
-                                    copy_begin[dname] = last_idx[dname] + 1 - halo_sizes[dname];
+                                    // Only read slice as wide as neighbor's
+                                    // left halo before end.
+                                    copy_begin[dname] = last_idx[dname] + 1 - left_halo_sizes[dname];
                                 }
                             
                                 // Else, this neighbor is in same posn as I am in this dim,
@@ -1251,17 +3094,17 @@ namespace yask {
                                 // Is this neighbor 'before' me in this dim?
                                 if (neigh_ofs == idx_t(MPIInfo::rank_prev)) {
 
-                                    // Only read slice as wide as halo before beginning.
-                                    copy_begin[dname] = first_idx[dname] - halo_sizes[dname];
+                                    // Only read slice as wide as left halo before beginning.
+                                    copy_begin[dname] = first_idx[dname] - left_halo_sizes[dname];
                                     copy_end[dname] = first_idx[dname];
                                 }
                             
                                 // Is this neighbor 'after' me in this dim?
                                 else if (neigh_ofs == idx_t(MPIInfo::rank_next)) {
                                     
-                                    // Only read slice as wide as halo after end.
+                                    // Only read slice as wide as right halo after end.
                                     copy_begin[dname] = last_idx[dname] + 1;
-                                    copy_end[dname] = last_idx[dname] + 1 + halo_sizes[dname];
+                                    copy_end[dname] = last_idx[dname] + 1 + right_halo_sizes[dname];
                                 }
                                 
                                 // Else, this neighbor is in same posn as I am in this dim,
@@ -1277,7 +3120,7 @@ namespace yask {
                             idx_t dsize = 1;
 
                             // domain dim?
-                            if (halo_sizes.lookup(dname)) {
+                            if (left_halo_sizes.lookup(dname)) {
                                 dsize = copy_end[dname] - copy_begin[dname];
 
                                 // Check whether size is multiple of vlen.
@@ -1346,6 +3189,14 @@ namespace yask {
                         buf.num_pts = buf_sizes;
                         buf.name = bufname;
                         buf.has_all_vlen_mults = vlen_mults;
+                        buf.use_shm = _opts->use_shm &&
+                            _mpiInfo->shm_ranks.at(nidx) != MPI_PROC_NULL;
+                        buf.codec = _opts->get_halo_codec(gname);
+                        if (buf.use_shm && buf.codec != halo_codec_none) {
+                            buf.codec = halo_codec_none;
+                            num_shm_uncoded++;
+                        }
+                        buf.num_slots = num_slots;
                         
                         TRACE_MSG("configured MPI buffer object '" << buf.name <<
                                   "' for rank at relative offsets " <<
@@ -1359,8 +3210,18 @@ namespace yask {
                 } // grids.
             });   // neighbors.
         TRACE_MSG("number of halo-exchanges needed on this rank: " << num_exchanges);
+        if (num_shm_uncoded)
+            os << "Note: halo codec not used for " << num_shm_uncoded <<
+                " buffer(s) exchanged with ranks on the same node via shared memory.\n";
+
+        // Base ptr for receive buffers in shared memory.
+        // The memory is owned by the MPI window, so there is no deleter.
+        shared_ptr<char> _shm_data_buf;
 
         // Allocate MPI buffers.
+        // Receive buffers for neighbors on this node are allocated in
+        // a shared-memory window; send buffers for those neighbors are
+        // set to point directly into the neighbors' receive buffers.
         // Pass 0: count required size, allocate chunk of memory at end.
         // Pass 1: distribute parts of already-allocated memory chunk.
         for (int pass = 0; pass < 2; pass++) {
@@ -1370,6 +3231,8 @@ namespace yask {
             // Determine how many bytes are needed and actually alloc'd.
             size_t bbytes = 0, abbytes = 0; // for MPI buffers.
             int nbufs = 0;
+            size_t sbbytes = 0, asbbytes = 0; // for shared-memory buffers.
+            int nsbufs = 0;
         
             // Grids.
             for (auto gp : gridPtrs) {
@@ -1393,17 +3256,48 @@ namespace yask {
                                 auto& buf = grid_mpi_data.getBuf(MPIBufs::BufDir(bd), roffsets);
                                 if (buf.get_size() == 0)
                                     continue;
+                                auto sbytes = buf.get_ring_bytes();
 
-                                if (pass == 1)
-                                    buf.set_storage(_mpi_data_buf, abbytes);
+                                // Shared-memory send buf: storage is
+                                // in the neighbor's window.
+                                if (buf.use_shm && bd == MPIBufs::bufSend)
+                                    continue;
+
+                                // Shared-memory recv buf.
+                                else if (buf.use_shm) {
+                                    if (pass == 1)
+                                        buf.set_storage(_shm_data_buf, asbbytes);
+                                    sbbytes += sbytes;
+                                    asbbytes += ROUND_UP(sbytes + _data_buf_pad,
+                                                         CACHELINE_BYTES);
+                                    nsbufs++;
+                                }
 
-                                auto sbytes = buf.get_bytes();
-                                bbytes += sbytes;
-                                abbytes += ROUND_UP(sbytes + _data_buf_pad,
-                                                    CACHELINE_BYTES);
-                                nbufs++;
+                                // Private buf.
+                                else {
+                                    if (pass == 1)
+                                        buf.set_storage(_mpi_data_buf, abbytes);
+                                    bbytes += sbytes;
+                                    abbytes += ROUND_UP(sbytes + _data_buf_pad,
+                                                        CACHELINE_BYTES);
+                                    nbufs++;
+
+                                    // Encoded data.
+                                    auto wbytes = buf.get_wire_ring_bytes();
+                                    if (wbytes) {
+                                        if (pass == 1)
+                                            buf.set_wire_storage(_mpi_data_buf, abbytes);
+                                        bbytes += wbytes;
+                                        abbytes += ROUND_UP(wbytes + _data_buf_pad,
+                                                            CACHELINE_BYTES);
+                                    }
+                                }
                                 TRACE_MSG("  MPI buf '" << buf.name << "' needs " <<
-                                          makeByteStr(sbytes));
+                                          makeByteStr(sbytes) <<
+                                          (buf.use_shm ? " in shared memory" : "") <<
+                                          (buf.codec != halo_codec_none ?
+                                           " plus space for '" + getHaloCodecName(buf.codec) +
+                                           "' encoding" : ""));
                             }
                         } );
                 }
@@ -1412,17 +3306,134 @@ namespace yask {
             // Don't need pad after last one.
             if (abbytes >= _data_buf_pad)
                 abbytes -= _data_buf_pad;
+            if (asbbytes >= _data_buf_pad)
+                asbbytes -= _data_buf_pad;
 
             // Allocate data.
             if (pass == 0) {
                 os << "Allocating " << makeByteStr(abbytes) <<
                     " for " << nbufs << " MPI buffer(s)...\n" << flush;
-                _mpi_data_buf = shared_ptr<char>(alignedAlloc(abbytes), AlignedDeleter());
+                string policy;
+                _mpi_data_buf = pageAlloc(abbytes, _opts->huge_pages, policy);
+                _data_bufs.push_back({ _mpi_data_buf, abbytes });
+                if (policy != _opts->huge_pages)
+                    os << " Note: '" << _opts->huge_pages <<
+                        "' pages not available; using '" << policy << "'.\n";
+
+                // Allocate shared-memory window.
+                // This is collective across ranks on this node,
+                // so it is done even if this rank needs no shared buffers.
+                freeShmWindow();
+                if (_opts->use_shm && _env->num_shm_ranks > 1) {
+                    os << "Allocating " << makeByteStr(asbbytes) <<
+                        " for " << nsbufs << " MPI buffer(s) in shared memory...\n" << flush;
+                    char* p = 0;
+                    MPI_Win_allocate_shared(asbbytes, 1, MPI_INFO_NULL, _env->shm_comm,
+                                            &p, &_shm_win);
+
+                    // Passive-target epoch for the life of the window,
+                    // needed for MPI_Win_sync() during exchanges.
+                    MPI_Win_lock_all(MPI_MODE_NOCHECK, _shm_win);
+                    _shm_data_buf = shared_ptr<char>(p, [](char*){});
+                }
+            }
+        }
+
+        // Tell each on-node neighbor where its send buffers are,
+        // i.e., the offsets of my receive buffers in my window.
+        if (_shm_win != MPI_WIN_NULL) {
+
+            // Buffers that need to be exchanged.
+            struct ShmBufInfo {
+                MPIBuf* buf;
+                bool is_recv;
+                int rank, shm_rank, tag;
+            };
+            vector<ShmBufInfo> sbufs;
+
+            // Grids.
+            int gi = 0;
+            for (auto gp : gridPtrs) {
+                if (!gp)
+                    continue;
+                auto& gname = gp->get_name();
+                gi++;
+                if (mpiData.count(gname) == 0)
+                    continue;
+                auto& grid_mpi_data = mpiData.at(gname);
+
+                grid_mpi_data.visitNeighbors
+                    ([&](const IdxTuple& roffsets,
+                         int rank,
+                         int idx,
+                         MPIBufs& nbufs) {
+                        for (int bd = 0; bd < MPIBufs::nBufDirs; bd++) {
+                            auto& buf = nbufs.bufs[bd];
+                            if (buf.get_size() == 0 || !buf.use_shm)
+                                continue;
+                            sbufs.push_back({ &buf, bd == MPIBufs::bufRecv,
+                                        rank, _mpiInfo->shm_ranks.at(idx), gi });
+                        }
+                    });
+            }
+
+            // Send offsets of my recv bufs; get offsets of neighbors' recv bufs.
+            vector<size_t> offsets(sbufs.size(), 0);
+            vector<MPI_Request> reqs(sbufs.size(), MPI_REQUEST_NULL);
+            for (size_t i = 0; i < sbufs.size(); i++) {
+                auto& sb = sbufs[i];
+                if (sb.is_recv) {
+                    offsets[i] = (char*)sb.buf->_elems - _shm_data_buf.get();
+                    MPI_Isend(&offsets[i], sizeof(size_t), MPI_BYTE,
+                              sb.rank, sb.tag, _env->comm, &reqs[i]);
+                } else
+                    MPI_Irecv(&offsets[i], sizeof(size_t), MPI_BYTE,
+                              sb.rank, sb.tag, _env->comm, &reqs[i]);
+            }
+            MPI_Waitall(int(reqs.size()), reqs.data(), MPI_STATUSES_IGNORE);
+
+            // Point send bufs into neighbors' windows.
+            for (size_t i = 0; i < sbufs.size(); i++) {
+                auto& sb = sbufs[i];
+                if (sb.is_recv)
+                    continue;
+                auto* buf = sb.buf;
+                MPI_Aint nbytes;
+                int disp;
+                char* p = 0;
+                MPI_Win_shared_query(_shm_win, sb.shm_rank, &nbytes, &disp, &p);
+                if (offsets[i] + buf->get_ring_bytes() > size_t(nbytes)) {
+                    cerr << "Internal error: MPI buffer '" << buf->name <<
+                        "' does not fit in shared memory of rank " << sb.rank << endl;
+                    exit_yask(1);
+                }
+                shared_ptr<char> nbase(p, [](char*){});
+                buf->set_storage(nbase, offsets[i]);
+                TRACE_MSG("  MPI buf '" << buf->name << "' mapped to shared memory of rank " <<
+                          sb.rank << " at offset " << offsets[i]);
             }
         }
 #endif
     }
 
+    // Release the shared-memory window used for on-node MPI buffers.
+    void StencilContext::freeShmWindow() {
+#ifdef USE_MPI
+        if (_shm_win == MPI_WIN_NULL)
+            return;
+
+        // Window cannot be freed after MPI has been finalized;
+        // the OS will reclaim it.
+        int finalized = 0;
+        MPI_Finalized(&finalized);
+        if (!finalized) {
+            MPI_Win_unlock_all(_shm_win);
+            MPI_Win_free(&_shm_win);
+        }
+        _shm_win = MPI_WIN_NULL;
+#endif
+    }
+
     // Set grid sizes and offsets based on settings.
     // Set max halos across grids.
     // This should be called anytime a setting or rank offset is changed.
@@ -1432,6 +3443,8 @@ namespace yask {
 
         // Reset halos.
         max_halos = _dims->_domain_dims;
+        wf_halos = _dims->_domain_dims;
+        auto& step_dim = _dims->_step_dim;
         
         // Loop through each grid.
         for (auto gp : gridPtrs) {
@@ -1458,9 +3471,22 @@ namespace yask {
                     // Offsets.
                     gp->_set_offset(dname, rank_domain_offsets[dname]);
 
-                    // Update max halo across grids, used for wavefront angles.
-                    auto hsz = gp->get_halo_size(dname);
-                    max_halos[dname] = max(max_halos[dname], hsz);
+                    // Update max halo across grids.
+                    auto lhsz = gp->get_left_halo_size(dname);
+                    auto rhsz = gp->get_right_halo_size(dname);
+                    max_halos[dname] = max(max_halos[dname], max(lhsz, rhsz));
+
+                    // Update halo used for wavefront angles.  Regions are
+                    // only shifted backward, so each shift must cover
+                    // reads after the domain (right halo). Reads before the
+                    // domain (left halo) only need to be covered before the
+                    // previous region overwrites the step being read, which
+                    // takes (step-alloc - 1) shifts.
+                    idx_t nshifts = gp->is_dim_used(step_dim) ?
+                        gp->get_alloc_size(step_dim) - 1 : 0;
+                    auto wfsz = (nshifts > 0) ?
+                        max(rhsz, CEIL_DIV(lhsz, nshifts)) : max(lhsz, rhsz);
+                    wf_halos[dname] = max(wf_halos[dname], wfsz);
                 }
             }
         }
@@ -1493,13 +3519,15 @@ namespace yask {
         // reset time keepers.
         clear_timers();
 
-        // Init auto-tuner to run silently during normal operation.
-        _at.clear(false, false);
-
         // Adjust all settings before setting MPI buffers or sizing grids.
         // Prints out final settings.
         _opts->adjustSettings(os, _env);
 
+        // Init auto-tuner to run silently during normal operation.
+        // Done after adjusting settings so its search starts from
+        // the final sizes.
+        _at.clear(false, false);
+
         // Size grids based on finalized settings.
         update_grids();
         
@@ -1516,6 +3544,7 @@ namespace yask {
         os << "  Num threads per region: " << omp_get_max_threads() << endl;
         set_block_threads(); // Temporary; just for reporting.
         os << "  Num threads per block: " << omp_get_max_threads() << endl;
+        setup_block_thread_binding();
 
         // Set the number of threads for a region to help avoid expensive
         // thread-number changing.
@@ -1583,8 +3612,8 @@ namespace yask {
             " minimum-padding:      " << _opts->_min_pad_sizes.makeDimValStr() << endl <<
             " wave-front-angles:    " << angles.makeDimValStr() << endl <<
             " max-halos:            " << max_halos.makeDimValStr() << endl <<
-            " L1-prefetch-distance: " << PFD_L1 << endl <<
-            " L2-prefetch-distance: " << PFD_L2 << endl <<
+            " L1-prefetch-distance: " << _opts->_prefetch_L1_dist << endl <<
+            " L2-prefetch-distance: " << _opts->_prefetch_L2_dist << endl <<
             endl;
         
         // sums across groups for this rank.
@@ -1726,6 +3755,12 @@ namespace yask {
                 "time in halo exch (sec):                " << makeNumStr(mtime);
             float pct = 100. * mtime / rtime;
             os << " (" << pct << "%)" << endl;
+            if (halo_raw_bytes > 0) {
+                os <<
+                    "halo data sent before encoding:         " << makeByteStr(halo_raw_bytes) << endl <<
+                    "halo data sent after encoding:          " << makeByteStr(halo_wire_bytes);
+                os << " (" << (100. * halo_wire_bytes / halo_raw_bytes) << "%)" << endl;
+            }
 #endif
         }
 
@@ -1749,6 +3784,7 @@ namespace yask {
 
         // Release any MPI data.
         mpiData.clear();
+        freeShmWindow();
 
         // Release grid data.
         for (auto gp : gridPtrs) {
@@ -1863,8 +3899,14 @@ namespace yask {
         bb_end = rank_domain_offsets.addElements(_opts->_rank_sizes, false);
         update_bb(os, "rank", *this, true);
 
+        find_wf_angles();
+    }
+
+    // Set the wave-front angles based on the region sizes.
+    void StencilContext::find_wf_angles()
+    {
         // Determine the max spatial skewing angles for temporal wavefronts
-        // based on the max halos.  This assumes the smallest granularity of
+        // based on the wave-front halos.  This assumes the smallest granularity of
         // calculation is CPTS_* in each dim.  We only need non-zero angles
         // if the region size is less than the rank size, i.e., if the
         // region covers the whole rank in a given dimension, no wave-front
@@ -1873,8 +3915,43 @@ namespace yask {
         for (auto& dim : _dims->_domain_dims.getDims()) {
             auto& dname = dim.getName();
             angles[dname] = (_opts->_region_sizes[dname] < bb_len[dname]) ?
-                ROUND_UP(max_halos[dname], _dims->_cluster_pts[dname]) : 0;
+                ROUND_UP(wf_halos[dname], _dims->_cluster_pts[dname]) : 0;
+        }
+    }
+
+    // Estimate bytes of grid data reused while streaming through a block.
+    // Blocks are evaluated as a sequence of slabs one cluster thick in
+    // the outer domain dim, so the data that should stay in cache is one
+    // such slab plus the halos needed to reuse it in every dim.
+    idx_t StencilContext::get_block_working_set(const IdxTuple& block_sizes) const {
+        auto& step_dim = _dims->_step_dim;
+        auto& outer_dim = _dims->_domain_dims.getDimName(0);
+        idx_t nbytes = 0;
+        for (auto gp : gridPtrs) {
+            idx_t npts = 1;
+            for (int i = 0; i < gp->get_num_dims(); i++) {
+                auto& dname = gp->get_dim_name(i);
+
+                // Allocated steps.
+                if (dname == step_dim)
+                    npts *= gp->get_alloc_size(dname);
+
+                // Halo-extended slab.
+                else if (_dims->_domain_dims.lookup(dname)) {
+                    idx_t sz = (dname == outer_dim) ?
+                        _dims->_cluster_pts[dname] :
+                        block_sizes.lookup(dname) ? block_sizes[dname] : _opts->_block_sizes[dname];
+                    sz += gp->get_left_halo_size(dname) + gp->get_right_halo_size(dname);
+                    npts *= ROUND_UP(sz, _dims->_fold_pts[dname]);
+                }
+
+                // Misc dims.
+                else
+                    npts *= gp->get_alloc_size(dname);
+            }
+            nbytes += npts * REAL_BYTES;
         }
+        return nbytes;
     }
 
     // Exchange dirty halo data for all grids, regardless
@@ -1917,22 +3994,45 @@ namespace yask {
         auto opts = get_settings();
         auto& sd = _dims->_step_dim;
 
-        // 1D array to store send request handles.
-        // We use a 1D array so we can call MPI_Waitall().
-        MPI_Request send_reqs[sg.inputGridPtrs.size() * _mpiInfo->neighborhood_size];
+        // 2D array to store send request handles: one row for each
+        // buffer slot, so sends for one step may still be in progress
+        // while later steps use other slots.  We use a 1D array for each
+        // slot so we can call MPI_Waitall().  Up to two sends per
+        // neighbor when using shared memory.
+        int num_slots = max(opts->halo_buf_slots, 1);
+        MPI_Request send_reqs[num_slots][sg.inputGridPtrs.size() * _mpiInfo->neighborhood_size * 2];
+        int num_send_reqs[num_slots];
+        for (int si = 0; si < num_slots; si++)
+            num_send_reqs[si] = 0;
 
         // 2D array for receive request handles.
         // We use a 2D array to simplify individual indexing.
         MPI_Request recv_reqs[sg.inputGridPtrs.size()][_mpiInfo->neighborhood_size];
 
+        // 2D array for handles of requests for notices that a neighbor's
+        // shared-memory receive buffer is ready to be written.
+        MPI_Request ready_reqs[sg.inputGridPtrs.size()][_mpiInfo->neighborhood_size];
+
         // Loop through steps.  This loop has to be outside halo-step loop
-        // because we only have one buffer per step. Normally, we only
-        // exchange one step; in that case, it doesn't matter.
-        // TODO: this will need to be addressed if/when comm/compute overlap is added.
+        // because each step uses one buffer slot. Normally, we only
+        // exchange one step; in that case, it doesn't matter.  When
+        // exchanging several steps, the buffers cycle through the slots,
+        // and sends for a step are only waited for when its slot is needed
+        // again or at the end.
         assert(start != stop);
         idx_t step = (start < stop) ? 1 : -1;
-        for (idx_t t = start; t != stop; t += step) {
-            int num_send_reqs = 0;
+        int slot = 0;
+        for (idx_t t = start; t != stop; t += step, slot = (slot + 1) % num_slots) {
+            MPI_Request* slot_send_reqs = send_reqs[slot];
+            int& num_slot_send_reqs = num_send_reqs[slot];
+
+            // Wait for sends from the last step that used this slot.
+            if (num_slot_send_reqs) {
+                TRACE_MSG("exchange_halos: waiting for " << num_slot_send_reqs <<
+                          " MPI send request(s) in slot " << slot << " to complete...");
+                MPI_Waitall(num_slot_send_reqs, slot_send_reqs, MPI_STATUS_IGNORE);
+                num_slot_send_reqs = 0;
+            }
 
             // Sequence of things to do for each grid's neighbors
             // (isend includes packing).
@@ -1950,6 +4050,13 @@ namespace yask {
                 for (size_t gi = 0; gi < sg.inputGridPtrs.size(); gi++) {
                     auto gp = sg.inputGridPtrs[gi];
                     MPI_Request* grid_recv_reqs = recv_reqs[gi];
+                    MPI_Request* grid_ready_reqs = ready_reqs[gi];
+
+                    // Message tags for data (or notice that shared-memory
+                    // data has been written) and notice that a shared-memory
+                    // buffer is ready to be written.
+                    int data_tag = int(gi) * 2;
+                    int ready_tag = data_tag + 1;
 
                     // Only need to swap grids whose halos are not up-to-date
                     // for this step.
@@ -1973,11 +4080,18 @@ namespace yask {
                             auto& recvBuf = bufs.bufs[MPIBufs::bufRecv];
                             
                             // Nothing to do if there are no buffers.
-                            if (sendBuf.get_size() == 0)
+                            // With asymmetric halos, a neighbor may need
+                            // only a send or only a receive buffer.
+                            bool do_send = sendBuf.get_size() != 0;
+                            bool do_recv = recvBuf.get_size() != 0;
+                            if (!do_send && !do_recv)
                                 return;
-                            assert(recvBuf.get_size() != 0);
-                            assert(sendBuf._elems != 0);
-                            assert(recvBuf._elems != 0);
+                            if (do_send)
+                                sendBuf.set_slot(slot);
+                            if (do_recv)
+                                recvBuf.set_slot(slot);
+                            assert(!do_send || sendBuf._elems != 0);
+                            assert(!do_recv || recvBuf._elems != 0);
                             TRACE_MSG("  with rank " << neighbor_rank << " at relative position " <<
                                       offsets.subElements(1).makeDimValOffsetStr() << "...");
 
@@ -1993,15 +4107,44 @@ namespace yask {
                          
                             // Submit async request to receive data from neighbor.
                             if (hi == halo_irecv) {
-                                auto nbytes = recvBuf.get_bytes();
-                                void* buf = (void*)recvBuf._elems;
-                                TRACE_MSG("   requesting " << makeByteStr(nbytes) << "...");
-                                MPI_Irecv(buf, nbytes, MPI_BYTE,
-                                          neighbor_rank, int(gi), _env->comm, &grid_recv_reqs[ni]);
+                                if (do_recv && recvBuf.use_shm) {
+
+                                    // My shared buffer is no longer in use, so tell
+                                    // neighbor it may write to it. Then, request
+                                    // notice that it has done so.
+                                    TRACE_MSG("   requesting " << makeByteStr(recvBuf.get_bytes()) <<
+                                              " via shared memory...");
+                                    MPI_Win_sync(_shm_win);
+                                    MPI_Isend(NULL, 0, MPI_BYTE,
+                                              neighbor_rank, ready_tag, _env->comm,
+                                              &slot_send_reqs[num_slot_send_reqs++]);
+                                    MPI_Irecv(NULL, 0, MPI_BYTE,
+                                              neighbor_rank, data_tag, _env->comm, &grid_recv_reqs[ni]);
+                                }
+                                else if (do_recv) {
+                                    auto nbytes = recvBuf.get_bytes();
+                                    void* buf = (void*)recvBuf._elems;
+
+                                    // Encoded data is received into the
+                                    // wire buffer; actual size may be less.
+                                    if (recvBuf.codec != halo_codec_none) {
+                                        nbytes = recvBuf.get_wire_bytes();
+                                        buf = (void*)recvBuf._wire;
+                                    }
+                                    TRACE_MSG("   requesting up to " << makeByteStr(nbytes) << "...");
+                                    MPI_Irecv(buf, nbytes, MPI_BYTE,
+                                              neighbor_rank, data_tag, _env->comm, &grid_recv_reqs[ni]);
+                                }
+
+                                // Request notice that neighbor's shared
+                                // buffer is ready.
+                                if (do_send && sendBuf.use_shm)
+                                    MPI_Irecv(NULL, 0, MPI_BYTE,
+                                              neighbor_rank, ready_tag, _env->comm, &grid_ready_reqs[ni]);
                             }
 
                             // Pack data into send buffer, then send to neighbor.
-                            else if (hi == halo_pack_isend) {
+                            else if (hi == halo_pack_isend && do_send) {
 
                                 // Vec ok?
                                 // Domain sizes must be ok, and buffer size must be ok
@@ -2026,6 +4169,14 @@ namespace yask {
                                           (send_vec_ok ? " with" : " without") <<
                                           " vector copy...");
 
+                                // Wait until neighbor's shared buffer is
+                                // ready to be written.
+                                if (sendBuf.use_shm) {
+                                    TRACE_MSG("   waiting for shared buffer...");
+                                    MPI_Wait(&grid_ready_reqs[ni], MPI_STATUS_IGNORE);
+                                    MPI_Win_sync(_shm_win);
+                                }
+
                                 // Copy data from grid to buffer.
                                 void* buf = (void*)sendBuf._elems;
                                 if (send_vec_ok)
@@ -2033,20 +4184,56 @@ namespace yask {
                                 else
                                     gp->get_elements_in_slice(buf, first, last);
 
+                                // Data is already in neighbor's buffer;
+                                // just notify it.
+                                if (sendBuf.use_shm) {
+                                    TRACE_MSG("   notifying neighbor of " <<
+                                              makeByteStr(sendBuf.get_bytes()) << " in shared memory...");
+                                    MPI_Win_sync(_shm_win);
+                                    MPI_Isend(NULL, 0, MPI_BYTE,
+                                              neighbor_rank, data_tag, _env->comm,
+                                              &slot_send_reqs[num_slot_send_reqs++]);
+                                }
+
                                 // Send packed buffer to neighbor.
-                                auto nbytes = sendBuf.get_bytes();
-                                TRACE_MSG("   sending " << makeByteStr(nbytes) << "...");
-                                MPI_Isend(buf, nbytes, MPI_BYTE,
-                                          neighbor_rank, int(gi), _env->comm,
-                                          &send_reqs[num_send_reqs++]);
+                                else {
+                                    auto nbytes = sendBuf.get_bytes();
+                                    halo_raw_bytes += nbytes;
+
+                                    // Encode if requested.
+                                    if (sendBuf.codec != halo_codec_none) {
+                                        nbytes = sendBuf.encode();
+                                        buf = (void*)sendBuf._wire;
+                                        TRACE_MSG("   encoded " << makeByteStr(sendBuf.get_bytes()) <<
+                                                  " to " << makeByteStr(nbytes) << " with '" <<
+                                                  getHaloCodecName(sendBuf.codec) << "' codec");
+                                    }
+                                    halo_wire_bytes += nbytes;
+                                    TRACE_MSG("   sending " << makeByteStr(nbytes) << "...");
+                                    MPI_Isend(buf, nbytes, MPI_BYTE,
+                                              neighbor_rank, data_tag, _env->comm,
+                                              &slot_send_reqs[num_slot_send_reqs++]);
+                                }
                             }
 
                             // Wait for data from neighbor, then unpack it.
-                            else if (hi == halo_unpack) {
+                            else if (hi == halo_unpack && do_recv) {
 
                                 // Wait for data from neighbor before unpacking it.
                                 TRACE_MSG("   waiting for MPI data...");
-                                MPI_Wait(&grid_recv_reqs[ni], MPI_STATUS_IGNORE);
+                                MPI_Status status;
+                                MPI_Wait(&grid_recv_reqs[ni], &status);
+                                if (recvBuf.use_shm)
+                                    MPI_Win_sync(_shm_win);
+
+                                // Decode into elements.
+                                if (recvBuf.codec != halo_codec_none) {
+                                    int nbytes = 0;
+                                    MPI_Get_count(&status, MPI_BYTE, &nbytes);
+                                    TRACE_MSG("   decoding " << makeByteStr(nbytes) << " with '" <<
+                                              getHaloCodecName(recvBuf.codec) << "' codec");
+                                    recvBuf.decode(nbytes);
+                                }
 
                                 // Vec ok?
                                 bool recv_vec_ok = vec_ok && recvBuf.has_all_vlen_mults;
@@ -2090,16 +4277,17 @@ namespace yask {
                 }
             }
 
-            // Wait for all send requests to complete.
-            if (num_send_reqs) {
-                TRACE_MSG("exchange_halos: waiting for " << num_send_reqs <<
-                          " MPI send request(s) to complete...");
-                MPI_Waitall(num_send_reqs, send_reqs, MPI_STATUS_IGNORE);
+        } // steps.
+
+        // Wait for all remaining send requests to complete.
+        for (int si = 0; si < num_slots; si++) {
+            if (num_send_reqs[si]) {
+                TRACE_MSG("exchange_halos: waiting for " << num_send_reqs[si] <<
+                          " MPI send request(s) in slot " << si << " to complete...");
+                MPI_Waitall(num_send_reqs[si], send_reqs[si], MPI_STATUS_IGNORE);
                 TRACE_MSG(" done waiting for MPI send request(s)");
             }
-            else
-                TRACE_MSG("exchange_halos: no MPI send requests to wait for");
-        } // steps.
+        }
         
         mpi_time.stop();
 #endif
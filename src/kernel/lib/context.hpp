@@ -130,6 +130,10 @@ namespace yask {
         // in the HW.
         size_t _data_buf_pad = (YASK_PAD * CACHELINE_BYTES);
 
+        // Grid and MPI buffers allocated by allocData() and their sizes,
+        // used to report huge-page usage.
+        std::vector<std::pair<std::weak_ptr<char>, size_t>> _data_bufs;
+
         // Check whether dim is appropriate type.
         virtual void checkDimType(const std::string& dim,
                                   const std::string& fn_name,
@@ -167,8 +171,19 @@ namespace yask {
         // Maximum halos and skewing angles over all grids and
         // groups. Used for calculating worst-case minimum regions.
         IdxTuple max_halos;  // spatial halos.
+        IdxTuple wf_halos;   // spatial halos that determine wave-front angles.
         IdxTuple angles;     // temporal skewing angles.
 
+        // Sub-domain evaluated by run_solution() while
+        // run_auto_tuner_now() is using a sample of the rank domain.
+        bool use_tune_sample = false;
+        IdxTuple tune_sample_begin, tune_sample_end;
+        double tune_sample_frac = 1.; // fraction of rank domain in sample.
+
+        // Groups of CPUs for the threads of each block when
+        // 'bind_block_threads' is used; empty if not binding.
+        std::vector<std::vector<int>> block_cpu_groups;
+
         // Various amount-of-work metrics calculated in prepare_solution().
         // 'rank_' prefix indicates for this rank.
         // 'tot_' prefix indicates over all ranks.
@@ -189,6 +204,10 @@ namespace yask {
         YaskTimer run_time;     // time in run_solution(), including MPI.
         YaskTimer mpi_time;     // time spent just doing MPI.
         idx_t steps_done = 0;   // number of steps that have been run.
+        idx_t rebal_steps = 0;  // steps since last load-balance check.
+        double rebal_secs = 0.; // compute time since last load-balance check.
+        size_t halo_raw_bytes = 0;  // halo data sent via MPI before encoding.
+        size_t halo_wire_bytes = 0; // halo data sent via MPI after encoding.
         double domain_pts_ps = 0.; // points-per-sec in domain.
         double writes_ps = 0.;     // writes-per-sec.
         double flops = 0.;      // est. FLOPS.
@@ -202,8 +221,41 @@ namespace yask {
         // Map key: grid name.
         std::map<std::string, MPIData> mpiData;
 
+#ifdef USE_MPI
+        // Shared-memory window holding this rank's receive buffers
+        // for neighbors on the same node.
+        MPI_Win _shm_win = MPI_WIN_NULL;
+#endif
+
         // Auto-tuner state.
         class AT {
+        public:
+
+            // Levels of settings that can be tuned, from coarsest to
+            // finest. Levels are searched one at a time in this order,
+            // i.e., from the largest to the smallest working sets in
+            // the cache hierarchy.
+            enum Level {
+                at_region,
+                at_block,
+                at_block_group,
+                at_block_threads,
+                at_sub_block,
+                at_sub_block_group,
+                at_prefetch,
+                at_loops,
+                at_num_levels
+            };
+            static const char* get_level_name(int level);
+
+            // Strategies for searching the values of a level.
+            enum Search {
+                at_gd,          // gradient descent with shrinking radius.
+                at_model,       // surrogate model of measured rates.
+                at_num_searches
+            };
+
+        protected:
             StencilContext* _context = 0;
             
             // Null stream to throw away debug info.
@@ -221,50 +273,98 @@ namespace yask {
             idx_t max_radius = 64;
             idx_t min_pts = 512; // 8^3.
             idx_t min_blks = 4;
+            idx_t max_wf_steps = 16; // max temporal region size.
+            idx_t max_pfd = 8;       // max prefetch distance.
+            size_t max_model_evals = 24; // max settings measured per level by model search.
+            size_t max_model_cands = 20000; // max candidates considered by model search.
+            double model_len_scale = 0.3; // correlation length in normalized log-space.
+            double model_noise = 0.03;    // relative std-dev of rate measurements.
+            double model_min_gain = 0.02; // stop when expected relative gain is below this.
+
+            // Levels to search and current one.
+            std::vector<int> levels;
+            size_t level_idx = 0;
+            bool allow_regions = false;
+            int search = at_gd;
+
+            // Whether all ranks use the settings found by the first one,
+            // rated by the slowest rank.
+            bool all_ranks = false;
+
+            // Limits on the values searched in the current level.
+            IdxTuple min_vals, max_vals;
 
             // Results.
             std::map<IdxTuple, double> results;
-            int n2big = 0, n2small = 0;
+            int n2big = 0, n2small = 0, n2ws = 0;
+
+            // Max block working set in bytes; 0 => no limit.
+            idx_t max_ws = 0;
 
             // Best so far.
-            IdxTuple best_block;
+            IdxTuple best_vals;
             double best_rate = 0.;
+            double best_comp_secs = 0.; // compute time per step.
+            double best_mpi_secs = 0.;  // halo-exchange time per step.
 
             // Current point in search.
-            IdxTuple center_block;
+            IdxTuple center_vals;
+            IdxTuple neigh_sizes;
             idx_t radius = 0;
             bool done = false;
             idx_t neigh_idx = 0;
             bool better_neigh_found = false;
 
+            // Model-search state.
+            std::vector<IdxTuple> candidates;
+            std::set<IdxTuple> tried;
+
             // Cumulative vars.
             double ctime = 0.;
+            double cmpi_time = 0.;      // part of 'ctime' spent in halo exchange.
             idx_t csteps = 0;
             bool in_warmup = true;
 
+            // Get and set the values of the current level in the settings.
+            IdxTuple get_vals() const;
+            void set_vals(const IdxTuple& vals);
+
+            // Start searching the current level.
+            void start_level();
+
+            // Apply best values of current level and move to the next one.
+            void next_level();
+
+            // Whether the values are allowed for the current level.
+            bool is_valid(const IdxTuple& vals);
+
+            // Set the next values to measure in the current level.
+            // Return false if the search of the level is done.
+            bool next_gd_vals();
+            bool next_model_vals();
+
+            // Make the list of candidates for the model search.
+            void make_candidates();
+
+            // Copy settings and search state from the first rank.
+            void sync_ranks();
+
         public:
             AT(StencilContext* ctx) :
                 _context(ctx) { }
             
             // Reset all state to beginning.
-            void clear(bool mark_done, bool verbose = false);
+            // Region sizes are only searched if 'tune_regions' is set because
+            // they may only be changed between calls to run_solution().
+            void clear(bool mark_done, bool verbose = false,
+                       bool tune_regions = false);
 
             // Evaluate the previous run and take next auto-tuner step.
-            void eval(idx_t steps, double elapsed_time);
+            // 'mpi_time' is the part of 'elapsed_time' spent in halo exchange.
+            void eval(idx_t steps, double elapsed_time, double mpi_time);
 
             // Apply settings.
-            void apply() {
-                auto _opts = _context->_opts;
-                auto _env = _context->_env;
-
-                // Change sub-block size to 0 so adjustSettings()
-                // will set it to the default.
-                _opts->_sub_block_sizes.setValsSame(0);
-                _opts->_sub_block_group_sizes.setValsSame(0);
-                
-                // Make sure everything is resized based on block size.
-                _opts->adjustSettings(nullop->get_ostream(), _env);
-            }
+            void apply();
 
             // Done?
             bool is_done() { return done; }
@@ -289,6 +389,7 @@ namespace yask {
             rank_domain_offsets = _dims->_domain_dims;
             overall_domain_sizes = _dims->_domain_dims;
             max_halos = _dims->_domain_dims;
+            wf_halos = _dims->_domain_dims;
             angles = _dims->_domain_dims;
             
             // Set output to msg-rank per settings.
@@ -321,6 +422,7 @@ namespace yask {
             run_time.clear();
             mpi_time.clear();
             steps_done = 0;
+            halo_raw_bytes = halo_wire_bytes = 0;
         }
 
         // Access to settings.
@@ -340,6 +442,12 @@ namespace yask {
             return _mpiInfo;
         }
 
+        // Prefetch distance in clusters for cache 'level' (1 or 2).
+        // Read by the generated inner loops, so it is not virtual.
+        int get_prefetch_dist(int level) const {
+            return (level == 1) ? _opts->_prefetch_L1_dist : _opts->_prefetch_L2_dist;
+        }
+
         // Add a new grid to the containers.
         virtual void addGrid(YkGridPtr gp, bool is_output);
         
@@ -348,10 +456,37 @@ namespace yask {
         // Called from prepare_solution(), so it doesn't normally need to be called from user code.
         virtual void setupRank();
 
+        // Set number of ranks in dims where it is zero and set this
+        // rank's logical indices according to the rank-layout setting.
+        // Called from setupRank().
+        virtual void findRankIndices();
+
+        // Set this rank's domain sizes to balance estimated compute cost
+        // across ranks. Called from setupRank().
+        virtual void balanceRankSizes();
+
+        // Compare compute time across ranks and, if the imbalance is
+        // too large, move rank boundaries and migrate grid data.
+        // Collective across all ranks. Called from run_solution().
+        // Return whether rank domains changed.
+        virtual bool rebalanceRanks(double compute_secs);
+
         // Allocate grid, param, and MPI memory.
         // Called from prepare_solution(), so it doesn't normally need to be called from user code.
         virtual void allocData();
 
+        // Resolve the memory policy of each grid that needs storage to
+        // 'default' or '<mode>:<nodes>'. Prints the 'auto' choices to 'os'.
+        virtual std::map<std::string, std::string> find_mem_policies(std::ostream& os) const;
+
+        // Number of bytes in grid and MPI buffers allocated by allocData()
+        // that are currently backed by huge pages.
+        virtual size_t get_huge_page_bytes() const;
+
+        // Release the shared-memory window used for on-node MPI buffers.
+        // Collective across ranks on this node.
+        virtual void freeShmWindow();
+
         // Allocate grids, params, MPI bufs, etc.
         // Calculate rank position in problem.
         // Initialize some other data structures.
@@ -396,8 +531,14 @@ namespace yask {
 
         // Init all grids & params to different values within grids,
         // and different for each grid.
+        // If rank domains may be rebalanced during the run, the values
+        // are based on overall indices, so a reference solution using
+        // the final rank sizes will start with the same data.
         virtual void initDiff() {
-            initValues([&](YkGridPtr gp, real_t seed){ gp->set_all_elements_in_seq(seed); });
+            if (_opts->rebalance_steps > 0)
+                initValues([&](YkGridPtr gp, real_t seed){ gp->set_all_elements_in_global_seq(seed); });
+            else
+                initValues([&](YkGridPtr gp, real_t seed){ gp->set_all_elements_in_seq(seed); });
         }
 
         // Init all grids & params.
@@ -482,6 +623,35 @@ namespace yask {
             return nt;
         }
 
+        // Adjust 'steps' in the domain dims for scanning from 'begin' to
+        // 'end' with 'nthreads' threads to reduce load imbalance.
+        virtual void balance_steps(const Indices& begin, const Indices& end,
+                                   Indices& steps, int nthreads) const;
+
+        // Find the CPU groups used for binding block threads.
+        virtual void setup_block_thread_binding();
+
+        // Bind the calling block thread to a CPU in the group of its
+        // region thread, if block-thread binding is enabled.  Region
+        // thread 'r' uses group 'r % ngroups'; when there are more region
+        // threads than groups, the later ones use the following CPUs in
+        // each group.  Threads are only re-bound when their CPU changes.
+        void bind_block_thread() {
+            if (block_cpu_groups.empty())
+                return;
+#ifdef _OPENMP
+            int ngroups = int(block_cpu_groups.size());
+            int rthread = omp_get_ancestor_thread_num(1);
+            auto& grp = block_cpu_groups[rthread % ngroups];
+            int bthread = omp_get_thread_num() +
+                (rthread / ngroups) * _opts->num_block_threads;
+            int cpu = grp[bthread % grp.size()];
+            static thread_local int bound_cpu = -1;
+            if (cpu != bound_cpu && bindThreadToCpu(cpu))
+                bound_cpu = cpu;
+#endif
+        }
+
         // Reference stencil calculations.
         virtual void calc_rank_ref();
 
@@ -496,6 +666,14 @@ namespace yask {
         virtual void calc_region(StencilGroupSet* stGroup_set,
                                  const ScanIndices& rank_idxs);
 
+        // Calculate results for group 'sg' in the tile of the region from
+        // 'tile_begin' to 'tile_end' by recursive bisection.
+        virtual void calc_tile_rec(StencilGroupBase* sg,
+                                   const ScanIndices& region_idxs,
+                                   const Indices& tile_begin,
+                                   const Indices& tile_end,
+                                   int depth);
+
         // Exchange all dirty halo data.
         virtual void exchange_halos_all();
 
@@ -508,6 +686,14 @@ namespace yask {
         // Set the bounding-box around all eq groups.
         virtual void find_bounding_boxes();
 
+        // Set the wave-front angles based on the region sizes.
+        virtual void find_wf_angles();
+
+        // Estimated bytes of grid data reused while streaming through a
+        // block of the given sizes, i.e., the halo-extended slab of one
+        // cluster in the outer domain dim over all grids and step slots.
+        virtual idx_t get_block_working_set(const IdxTuple& block_sizes) const;
+
         // Make a new grid iff its dims match any in the stencil.
         // Returns pointer to the new grid or nullptr if no match.
         virtual YkGridPtr newStencilGrid (const std::string & name,
@@ -631,6 +817,14 @@ namespace yask {
         virtual bool is_auto_tuner_enabled() {
             return !_at.is_done();
         }
+        virtual bool load_auto_tuner_db(const std::string& file_name);
+        virtual void save_auto_tuner_db(const std::string& file_name);
+
+        // Key identifying this solution in an auto-tuner DB.
+        virtual std::string get_tuner_db_key() const;
+
+        // Tuned settings as command-line options.
+        virtual std::string get_tuned_options() const;
     };
 
 } // yask namespace.
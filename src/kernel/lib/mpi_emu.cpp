@@ -0,0 +1,614 @@
+/*****************************************************************************
+
+YASK: Yet Another Stencil Kernel
+Copyright (c) 2014-2018, Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to
+deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+IN THE SOFTWARE.
+
+*****************************************************************************/
+
+
+// Emulation of the MPI subset used by YASK with threads as ranks.
+// See mpi_emu.hpp.
+
+#include "yask.hpp"
+
+#ifdef USE_MPI_EMU
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <list>
+
+using namespace std;
+
+// A pending request.
+// Sends are eager, so they are always complete when returned.
+struct MPI_EmuRequest {
+    bool done = false;
+    int owner = 0;              // world rank that will wait on this.
+    void* buf = 0;              // receive buffer.
+    size_t max_bytes = 0;       // receive buffer size.
+    size_t nbytes = 0;          // bytes actually received.
+    MPI_Comm comm = MPI_COMM_WORLD;
+    int source = MPI_PROC_NULL; // rank in 'comm'.
+    int tag = 0;
+};
+
+namespace yask {
+
+    // World rank of the calling thread.
+    static thread_local int emu_world_rank = 0;
+    static thread_local bool emu_is_init = false;
+    static thread_local bool emu_is_final = false;
+
+    // Info about one communicator.
+    struct EmuComm {
+        vector<int> members;    // world rank of each rank in this comm.
+        vector<int> dims, periods; // Cartesian topology, if any.
+
+        // Barrier and scratch space for collectives.
+        mutex m;
+        condition_variable cv;
+        int count = 0;
+        unsigned long gen = 0;
+        vector<const void*> slots;
+
+        // Rank of the calling thread in this comm.
+        int my_rank() const {
+            for (size_t i = 0; i < members.size(); i++)
+                if (members[i] == emu_world_rank)
+                    return int(i);
+            return MPI_UNDEFINED;
+        }
+
+        void barrier() {
+            unique_lock<mutex> lk(m);
+            auto g = gen;
+            if (++count == int(members.size())) {
+                count = 0;
+                gen++;
+                cv.notify_all();
+            }
+            else
+                cv.wait(lk, [&]{ return gen != g; });
+        }
+
+        // Give each rank a view of every rank's 'mine' ptr.
+        // 'use' is called by each rank while all ptrs are valid.
+        void exchange(const void* mine,
+                      function<void (const vector<const void*>& all)> use) {
+            {
+                lock_guard<mutex> lk(m);
+                slots.resize(members.size());
+                slots[my_rank()] = mine;
+            }
+            barrier();
+            use(slots);
+            barrier();
+        }
+    };
+
+    // Info about one shared window.
+    struct EmuWin {
+        MPI_Comm comm;
+        vector<void*> bases;
+        vector<MPI_Aint> sizes;
+    };
+
+    // Messages and posted receives for one world rank.
+    struct EmuMsg {
+        MPI_Comm comm;
+        int source;             // rank in 'comm'.
+        int tag;
+        vector<char> data;
+    };
+    struct EmuMailbox {
+        mutex m;
+        condition_variable cv;
+        list<MPI_Request> posted;
+        list<EmuMsg> unexpected;
+    };
+
+    // Global state shared by all ranks.
+    static mutex emu_lock;
+    static int emu_num_ranks = 1;
+    static vector<unique_ptr<EmuComm>> emu_comms;
+    static vector<unique_ptr<EmuWin>> emu_wins;
+    static vector<unique_ptr<EmuMailbox>> emu_boxes;
+
+    // Set up world comm and mailboxes for 'n' ranks.
+    static void emuSetup(int n) {
+        lock_guard<mutex> lk(emu_lock);
+        emu_num_ranks = n;
+        emu_comms.clear();
+        emu_wins.clear();
+        emu_boxes.clear();
+        emu_comms.emplace_back(new EmuComm);
+        for (int i = 0; i < n; i++) {
+            emu_comms[0]->members.push_back(i);
+            emu_boxes.emplace_back(new EmuMailbox);
+        }
+    }
+
+    static EmuComm& emuGetComm(MPI_Comm comm) {
+        lock_guard<mutex> lk(emu_lock);
+        if (emu_comms.empty()) {
+            emu_comms.emplace_back(new EmuComm);
+            emu_comms[0]->members.push_back(0);
+            emu_boxes.emplace_back(new EmuMailbox);
+        }
+        if (comm < 0 || size_t(comm) >= emu_comms.size()) {
+            cerr << "Error: invalid emulated MPI communicator " << comm << ".\n";
+            abort();
+        }
+        return *emu_comms[comm];
+    }
+
+    static EmuMailbox& emuGetBox(int world_rank) {
+        lock_guard<mutex> lk(emu_lock);
+        return *emu_boxes.at(world_rank);
+    }
+
+    // Make a new comm with the same members as 'comm'.
+    // Collective over 'comm'.
+    static MPI_Comm emuDupComm(MPI_Comm comm, const vector<int>& dims,
+                               const vector<int>& periods) {
+        auto& ci = emuGetComm(comm);
+        MPI_Comm newcomm = MPI_COMM_WORLD;
+        if (ci.my_rank() == 0) {
+            lock_guard<mutex> lk(emu_lock);
+            newcomm = MPI_Comm(emu_comms.size());
+            emu_comms.emplace_back(new EmuComm);
+            emu_comms.back()->members = ci.members;
+            emu_comms.back()->dims = dims;
+            emu_comms.back()->periods = periods;
+        }
+        ci.exchange(&newcomm, [&](const vector<const void*>& all) {
+                newcomm = *(const MPI_Comm*)all[0];
+            });
+        return newcomm;
+    }
+
+    // Size in bytes of one element of 'type'.
+    static size_t emuTypeSize(MPI_Datatype type) {
+        return size_t(type & 0xff);
+    }
+
+    // Apply 'op' to 'count' elements of type 'T'.
+    template <typename T>
+    static void emuReduce(T* out, const vector<const void*>& all,
+                          int count, MPI_Op op) {
+        for (int i = 0; i < count; i++) {
+            T v = ((const T*)all[0])[i];
+            for (size_t r = 1; r < all.size(); r++) {
+                T x = ((const T*)all[r])[i];
+                if (op == MPI_SUM)
+                    v += x;
+                else if (op == MPI_MIN)
+                    v = min(v, x);
+                else if (op == MPI_MAX)
+                    v = max(v, x);
+            }
+            out[i] = v;
+        }
+    }
+
+    // Number of ranks to emulate.
+    int getNumEmulatedRanks() {
+        const char* s = getenv("YASK_EMU_RANKS");
+        int n = s ? atoi(s) : 1;
+        return max(n, 1);
+    }
+
+    // Run ranks as threads.
+    int runEmulatedRanks(int num_ranks, std::function<int ()> rank_fn) {
+        emuSetup(num_ranks);
+        int nthreads = max(1, omp_get_max_threads() / num_ranks);
+        vector<int> rets(num_ranks, 0);
+        vector<thread> threads;
+        for (int r = 0; r < num_ranks; r++)
+            threads.emplace_back([&, r]() {
+                    emu_world_rank = r;
+                    omp_set_num_threads(nthreads);
+                    rets[r] = rank_fn();
+                });
+        for (auto& t : threads)
+            t.join();
+        return *max_element(rets.begin(), rets.end());
+    }
+}
+
+using namespace yask;
+
+///// Environment.
+
+int MPI_Init_thread(int* argc, char*** argv, int required, int* provided) {
+    emu_is_init = true;
+    *provided = MPI_THREAD_MULTIPLE;
+    return MPI_SUCCESS;
+}
+int MPI_Initialized(int* flag) {
+    *flag = emu_is_init;
+    return MPI_SUCCESS;
+}
+int MPI_Finalize() {
+    MPI_Barrier(MPI_COMM_WORLD);
+    emu_is_final = true;
+    return MPI_SUCCESS;
+}
+int MPI_Finalized(int* flag) {
+    *flag = emu_is_final;
+    return MPI_SUCCESS;
+}
+int MPI_Abort(MPI_Comm comm, int code) {
+
+    // Other ranks may still be running, so don't run global dtors.
+    cout << flush;
+    cerr << flush;
+    _Exit(code);
+}
+
+///// Communicators and groups.
+
+int MPI_Comm_rank(MPI_Comm comm, int* rank) {
+    *rank = emuGetComm(comm).my_rank();
+    return MPI_SUCCESS;
+}
+int MPI_Comm_size(MPI_Comm comm, int* size) {
+    *size = int(emuGetComm(comm).members.size());
+    return MPI_SUCCESS;
+}
+int MPI_Comm_split_type(MPI_Comm comm, int split_type, int key,
+                        MPI_Info info, MPI_Comm* newcomm) {
+
+    // All ranks share one node; 'key' is always the rank in
+    // 'comm' in YASK, so order is unchanged.
+    *newcomm = emuDupComm(comm, {}, {});
+    return MPI_SUCCESS;
+}
+int MPI_Comm_free(MPI_Comm* comm) {
+
+    // Comm ids are never reused, so nothing to release.
+    *comm = MPI_COMM_WORLD;
+    return MPI_SUCCESS;
+}
+int MPI_Comm_group(MPI_Comm comm, MPI_Group* group) {
+
+    // A group is identified by the comm it came from.
+    *group = comm;
+    return MPI_SUCCESS;
+}
+int MPI_Group_translate_ranks(MPI_Group group1, int n, const int* ranks1,
+                              MPI_Group group2, int* ranks2) {
+    auto& c1 = emuGetComm(group1);
+    auto& c2 = emuGetComm(group2);
+    for (int i = 0; i < n; i++) {
+        ranks2[i] = MPI_UNDEFINED;
+        if (ranks1[i] == MPI_PROC_NULL) {
+            ranks2[i] = MPI_PROC_NULL;
+            continue;
+        }
+        int wr = c1.members.at(ranks1[i]);
+        for (size_t j = 0; j < c2.members.size(); j++)
+            if (c2.members[j] == wr)
+                ranks2[i] = int(j);
+    }
+    return MPI_SUCCESS;
+}
+int MPI_Group_free(MPI_Group* group) {
+    *group = MPI_COMM_WORLD;
+    return MPI_SUCCESS;
+}
+int MPI_Dims_create(int nnodes, int ndims, int* dims) {
+
+    // Factor the free part of 'nnodes', giving largest primes first
+    // to the currently-smallest free dims.
+    int nfree = nnodes;
+    vector<int> free_dims;
+    for (int i = 0; i < ndims; i++) {
+        if (dims[i] > 0)
+            nfree /= dims[i];
+        else {
+            free_dims.push_back(i);
+            dims[i] = 1;
+        }
+    }
+    if (free_dims.empty())
+        return MPI_SUCCESS;
+    vector<int> primes;
+    for (int p = 2; nfree > 1; ) {
+        if (nfree % p == 0) {
+            primes.push_back(p);
+            nfree /= p;
+        }
+        else
+            p++;
+    }
+    for (auto pi = primes.rbegin(); pi != primes.rend(); pi++) {
+        int best = free_dims[0];
+        for (auto i : free_dims)
+            if (dims[i] < dims[best])
+                best = i;
+        dims[best] *= *pi;
+    }
+
+    // MPI returns free dims in non-increasing order.
+    vector<int> vals;
+    for (auto i : free_dims)
+        vals.push_back(dims[i]);
+    sort(vals.rbegin(), vals.rend());
+    for (size_t j = 0; j < free_dims.size(); j++)
+        dims[free_dims[j]] = vals[j];
+    return MPI_SUCCESS;
+}
+int MPI_Cart_create(MPI_Comm comm, int ndims, const int* dims,
+                    const int* periods, int reorder, MPI_Comm* comm_cart) {
+
+    // Never reorders.
+    *comm_cart = emuDupComm(comm, vector<int>(dims, dims + ndims),
+                            vector<int>(periods, periods + ndims));
+    return MPI_SUCCESS;
+}
+int MPI_Cart_coords(MPI_Comm comm, int rank, int maxdims, int* coords) {
+    auto& ci = emuGetComm(comm);
+    int nd = int(ci.dims.size());
+
+    // Last dim varies fastest.
+    for (int i = nd - 1; i >= 0; i--) {
+        if (i < maxdims)
+            coords[i] = rank % ci.dims[i];
+        rank /= ci.dims[i];
+    }
+    return MPI_SUCCESS;
+}
+
+///// Collectives.
+
+int MPI_Barrier(MPI_Comm comm) {
+    emuGetComm(comm).barrier();
+    return MPI_SUCCESS;
+}
+int MPI_Bcast(void* buf, int count, MPI_Datatype type, int root, MPI_Comm comm) {
+    auto& ci = emuGetComm(comm);
+    bool is_root = ci.my_rank() == root;
+    ci.exchange(buf, [&](const vector<const void*>& all) {
+            if (!is_root)
+                memcpy(buf, all[root], count * emuTypeSize(type));
+        });
+    return MPI_SUCCESS;
+}
+int MPI_Allreduce(const void* sendbuf, void* recvbuf, int count,
+                  MPI_Datatype type, MPI_Op op, MPI_Comm comm) {
+    emuGetComm(comm).exchange(sendbuf, [&](const vector<const void*>& all) {
+            if (type == MPI_DOUBLE)
+                emuReduce((double*)recvbuf, all, count, op);
+            else if (type == MPI_INTEGER8)
+                emuReduce((int64_t*)recvbuf, all, count, op);
+            else if (type == MPI_INT)
+                emuReduce((int*)recvbuf, all, count, op);
+            else
+                emuReduce((unsigned char*)recvbuf, all, count, op);
+        });
+    return MPI_SUCCESS;
+}
+int MPI_Allgather(const void* sendbuf, int sendcount, MPI_Datatype sendtype,
+                  void* recvbuf, int recvcount, MPI_Datatype recvtype,
+                  MPI_Comm comm) {
+    size_t nbytes = recvcount * emuTypeSize(recvtype);
+    emuGetComm(comm).exchange(sendbuf, [&](const vector<const void*>& all) {
+            for (size_t r = 0; r < all.size(); r++)
+                memcpy((char*)recvbuf + r * nbytes, all[r], nbytes);
+        });
+    return MPI_SUCCESS;
+}
+
+///// Point-to-point.
+
+int MPI_Isend(const void* buf, int count, MPI_Datatype type,
+              int dest, int tag, MPI_Comm comm, MPI_Request* req) {
+    *req = MPI_REQUEST_NULL;
+    if (dest == MPI_PROC_NULL)
+        return MPI_SUCCESS;
+    auto& ci = emuGetComm(comm);
+    int me = ci.my_rank();
+    size_t nbytes = count * emuTypeSize(type);
+    auto& box = emuGetBox(ci.members.at(dest));
+
+    // Copy directly into a matching posted receive or
+    // queue a copy of the data.
+    {
+        lock_guard<mutex> lk(box.m);
+        bool found = false;
+        for (auto i = box.posted.begin(); i != box.posted.end(); i++) {
+            auto r = *i;
+            if (r->comm == comm && r->source == me && r->tag == tag) {
+                if (nbytes > r->max_bytes) {
+                    cerr << "Error: emulated MPI message truncated.\n";
+                    abort();
+                }
+                memcpy(r->buf, buf, nbytes);
+                r->nbytes = nbytes;
+                r->done = true;
+                box.posted.erase(i);
+                found = true;
+                break;
+            }
+        }
+        if (found)
+            box.cv.notify_all();
+        else {
+            const char* p = (const char*)buf;
+            box.unexpected.push_back({comm, me, tag, vector<char>(p, p + nbytes)});
+        }
+    }
+
+    // The send buffer may be reused now.
+    auto r = new MPI_EmuRequest;
+    r->owner = emu_world_rank;
+    r->done = true;
+    *req = r;
+    return MPI_SUCCESS;
+}
+int MPI_Irecv(void* buf, int count, MPI_Datatype type,
+              int source, int tag, MPI_Comm comm, MPI_Request* req) {
+    *req = MPI_REQUEST_NULL;
+    if (source == MPI_PROC_NULL)
+        return MPI_SUCCESS;
+    auto& box = emuGetBox(emu_world_rank);
+    auto r = new MPI_EmuRequest;
+    r->owner = emu_world_rank;
+    r->buf = buf;
+    r->max_bytes = count * emuTypeSize(type);
+    r->comm = comm;
+    r->source = source;
+    r->tag = tag;
+
+    // Take the oldest matching message that already arrived
+    // or post the receive.
+    {
+        lock_guard<mutex> lk(box.m);
+        bool found = false;
+        for (auto i = box.unexpected.begin(); i != box.unexpected.end(); i++) {
+            if (i->comm == comm && i->source == source && i->tag == tag) {
+                if (i->data.size() > r->max_bytes) {
+                    cerr << "Error: emulated MPI message truncated.\n";
+                    abort();
+                }
+                memcpy(buf, i->data.data(), i->data.size());
+                r->nbytes = i->data.size();
+                r->done = true;
+                box.unexpected.erase(i);
+                found = true;
+                break;
+            }
+        }
+        if (!found)
+            box.posted.push_back(r);
+    }
+    *req = r;
+    return MPI_SUCCESS;
+}
+int MPI_Wait(MPI_Request* req, MPI_Status* status) {
+    auto r = *req;
+    if (!r) {
+        if (status) {
+            status->MPI_SOURCE = MPI_PROC_NULL;
+            status->MPI_TAG = 0;
+            status->MPI_ERROR = MPI_SUCCESS;
+            status->_nbytes = 0;
+        }
+        return MPI_SUCCESS;
+    }
+    auto& box = emuGetBox(r->owner);
+    {
+        unique_lock<mutex> lk(box.m);
+        box.cv.wait(lk, [&]{ return r->done; });
+    }
+    if (status) {
+        status->MPI_SOURCE = r->source;
+        status->MPI_TAG = r->tag;
+        status->MPI_ERROR = MPI_SUCCESS;
+        status->_nbytes = r->nbytes;
+    }
+    delete r;
+    *req = MPI_REQUEST_NULL;
+    return MPI_SUCCESS;
+}
+int MPI_Waitall(int count, MPI_Request* reqs, MPI_Status* statuses) {
+    for (int i = 0; i < count; i++)
+        MPI_Wait(&reqs[i], statuses ? &statuses[i] : MPI_STATUS_IGNORE);
+    return MPI_SUCCESS;
+}
+int MPI_Get_count(const MPI_Status* status, MPI_Datatype type, int* count) {
+    *count = int(status->_nbytes / emuTypeSize(type));
+    return MPI_SUCCESS;
+}
+
+///// Shared-memory windows.
+
+int MPI_Win_allocate_shared(MPI_Aint size, int disp_unit, MPI_Info info,
+                            MPI_Comm comm, void* baseptr, MPI_Win* win) {
+    auto& ci = emuGetComm(comm);
+    struct WinArg {
+        void* base;
+        MPI_Aint size;
+        MPI_Win win;
+    } mine;
+    mine.base = size ? alignedAlloc(size) : 0;
+    mine.size = size;
+    mine.win = MPI_WIN_NULL;
+    if (ci.my_rank() == 0) {
+        lock_guard<mutex> lk(emu_lock);
+        mine.win = MPI_Win(emu_wins.size());
+        emu_wins.emplace_back(new EmuWin);
+        emu_wins.back()->comm = comm;
+    }
+    ci.exchange(&mine, [&](const vector<const void*>& all) {
+            auto a0 = (const WinArg*)all[0];
+            *win = a0->win;
+            if (ci.my_rank() == 0) {
+                lock_guard<mutex> lk(emu_lock);
+                auto& wi = *emu_wins[a0->win];
+                for (auto p : all) {
+                    auto a = (const WinArg*)p;
+                    wi.bases.push_back(a->base);
+                    wi.sizes.push_back(a->size);
+                }
+            }
+        });
+    *(void**)baseptr = mine.base;
+    return MPI_SUCCESS;
+}
+int MPI_Win_shared_query(MPI_Win win, int rank, MPI_Aint* size,
+                         int* disp_unit, void* baseptr) {
+    lock_guard<mutex> lk(emu_lock);
+    auto& wi = *emu_wins.at(win);
+    *size = wi.sizes.at(rank);
+    *disp_unit = 1;
+    *(void**)baseptr = wi.bases.at(rank);
+    return MPI_SUCCESS;
+}
+int MPI_Win_lock_all(int assert_flags, MPI_Win win) {
+    return MPI_SUCCESS;
+}
+int MPI_Win_unlock_all(MPI_Win win) {
+    return MPI_SUCCESS;
+}
+int MPI_Win_sync(MPI_Win win) {
+    atomic_thread_fence(memory_order_seq_cst);
+    return MPI_SUCCESS;
+}
+int MPI_Win_free(MPI_Win* win) {
+
+    // Each rank frees its own segment after all are done with them.
+    EmuWin* wi = 0;
+    {
+        lock_guard<mutex> lk(emu_lock);
+        wi = emu_wins.at(*win).get();
+    }
+    auto& ci = emuGetComm(wi->comm);
+    ci.barrier();
+    free(wi->bases.at(ci.my_rank()));
+    *win = MPI_WIN_NULL;
+    return MPI_SUCCESS;
+}
+
+#endif
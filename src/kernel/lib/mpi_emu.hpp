@@ -0,0 +1,149 @@
+/*****************************************************************************
+
+YASK: Yet Another Stencil Kernel
+Copyright (c) 2014-2018, Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to
+deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+IN THE SOFTWARE.
+
+*****************************************************************************/
+
+
+// Purpose: emulate the subset of MPI used by YASK with threads as ranks
+// inside one process. Enabled by building with 'mpi=emu', which defines
+// USE_MPI and USE_MPI_EMU, so all the code under USE_MPI is used as
+// with a real MPI library.
+//
+// Each rank runs in its own thread via yask::runEmulatedRanks().
+// Messages are copied through per-rank mailboxes, collectives use
+// shared scratch space, and "shared-memory" windows are ordinary
+// allocations visible to all ranks.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+// Handles.
+typedef int MPI_Comm;
+typedef int MPI_Group;
+typedef int MPI_Win;
+typedef int MPI_Info;
+typedef int MPI_Datatype;
+typedef int MPI_Op;
+typedef std::ptrdiff_t MPI_Aint;
+struct MPI_EmuRequest;
+typedef MPI_EmuRequest* MPI_Request;
+
+// Status of a completed receive.
+struct MPI_Status {
+    int MPI_SOURCE;
+    int MPI_TAG;
+    int MPI_ERROR;
+    std::size_t _nbytes;
+};
+
+// Constants.
+#define MPI_SUCCESS             (0)
+#define MPI_COMM_WORLD          (0)
+#define MPI_PROC_NULL           (-1)
+#define MPI_UNDEFINED           (-32766)
+#define MPI_WIN_NULL            (-1)
+#define MPI_INFO_NULL           (0)
+#define MPI_REQUEST_NULL        ((MPI_Request)0)
+#define MPI_STATUS_IGNORE       ((MPI_Status*)0)
+#define MPI_STATUSES_IGNORE     ((MPI_Status*)0)
+#define MPI_THREAD_SINGLE       (0)
+#define MPI_THREAD_FUNNELED     (1)
+#define MPI_THREAD_SERIALIZED   (2)
+#define MPI_THREAD_MULTIPLE     (3)
+#define MPI_COMM_TYPE_SHARED    (1)
+#define MPI_MODE_NOCHECK        (1024)
+
+// Datatypes are their sizes in bytes.
+#define MPI_BYTE                (1)
+#define MPI_INT                 (int(sizeof(int)))
+#define MPI_INTEGER8            (8)
+#define MPI_DOUBLE              (int(sizeof(double)) | 0x100)
+
+// Reduction ops.
+#define MPI_SUM                 (1)
+#define MPI_MIN                 (2)
+#define MPI_MAX                 (3)
+
+// Environment.
+int MPI_Init_thread(int* argc, char*** argv, int required, int* provided);
+int MPI_Initialized(int* flag);
+int MPI_Finalize();
+int MPI_Finalized(int* flag);
+int MPI_Abort(MPI_Comm comm, int code);
+
+// Communicators and groups.
+int MPI_Comm_rank(MPI_Comm comm, int* rank);
+int MPI_Comm_size(MPI_Comm comm, int* size);
+int MPI_Comm_split_type(MPI_Comm comm, int split_type, int key,
+                        MPI_Info info, MPI_Comm* newcomm);
+int MPI_Comm_free(MPI_Comm* comm);
+int MPI_Comm_group(MPI_Comm comm, MPI_Group* group);
+int MPI_Group_translate_ranks(MPI_Group group1, int n, const int* ranks1,
+                              MPI_Group group2, int* ranks2);
+int MPI_Group_free(MPI_Group* group);
+int MPI_Dims_create(int nnodes, int ndims, int* dims);
+int MPI_Cart_create(MPI_Comm comm, int ndims, const int* dims,
+                    const int* periods, int reorder, MPI_Comm* comm_cart);
+int MPI_Cart_coords(MPI_Comm comm, int rank, int maxdims, int* coords);
+
+// Collectives.
+int MPI_Barrier(MPI_Comm comm);
+int MPI_Bcast(void* buf, int count, MPI_Datatype type, int root, MPI_Comm comm);
+int MPI_Allreduce(const void* sendbuf, void* recvbuf, int count,
+                  MPI_Datatype type, MPI_Op op, MPI_Comm comm);
+int MPI_Allgather(const void* sendbuf, int sendcount, MPI_Datatype sendtype,
+                  void* recvbuf, int recvcount, MPI_Datatype recvtype,
+                  MPI_Comm comm);
+
+// Point-to-point.
+int MPI_Isend(const void* buf, int count, MPI_Datatype type,
+              int dest, int tag, MPI_Comm comm, MPI_Request* req);
+int MPI_Irecv(void* buf, int count, MPI_Datatype type,
+              int source, int tag, MPI_Comm comm, MPI_Request* req);
+int MPI_Wait(MPI_Request* req, MPI_Status* status);
+int MPI_Waitall(int count, MPI_Request* reqs, MPI_Status* statuses);
+int MPI_Get_count(const MPI_Status* status, MPI_Datatype type, int* count);
+
+// Shared-memory windows.
+int MPI_Win_allocate_shared(MPI_Aint size, int disp_unit, MPI_Info info,
+                            MPI_Comm comm, void* baseptr, MPI_Win* win);
+int MPI_Win_shared_query(MPI_Win win, int rank, MPI_Aint* size,
+                         int* disp_unit, void* baseptr);
+int MPI_Win_lock_all(int assert_flags, MPI_Win win);
+int MPI_Win_unlock_all(MPI_Win win);
+int MPI_Win_sync(MPI_Win win);
+int MPI_Win_free(MPI_Win* win);
+
+namespace yask {
+
+    // Number of ranks to emulate, from the YASK_EMU_RANKS env var.
+    // Default is one.
+    extern int getNumEmulatedRanks();
+
+    // Run 'rank_fn' in 'num_ranks' threads, each acting as one rank.
+    // Threads for OpenMP are divided evenly among the ranks.
+    // Return the max value returned by any rank.
+    extern int runEmulatedRanks(int num_ranks, std::function<int ()> rank_fn);
+}
@@ -50,14 +50,16 @@ namespace yask {
         // All values are in units of reals, not underlying elements, if different.
         // Settings for domain dims | non-domain dims.
         Indices _domains;   // rank domain sizes copied from the solution | alloc size.
-        Indices _pads;      // extra space around domains | zero.
-        Indices _halos;     // space within pads for halo exchange | zero.
+        Indices _left_pads;   // extra space before domains | zero.
+        Indices _right_pads;  // extra space after domains | zero.
+        Indices _left_halos;  // space within left pads for halo exchange | zero.
+        Indices _right_halos; // space within right pads for halo exchange | zero.
         Indices _offsets;   // offsets of this rank in overall domain | first index.
         Indices _vec_lens;  // num reals in each elem | one.
         Indices _allocs;    // actual grid allocation in reals | as domain dims.
 
         // Indices in vectors for sizes that are always vec lens (to avoid division).
-        Indices _vec_pads;
+        Indices _vec_left_pads;
         Indices _vec_allocs;
 
         // Whether step dim is used.
@@ -75,6 +77,14 @@ namespace yask {
         // Whether to resize this grid based on solution parameters.
         bool _do_resize = true;
 
+        // Requested NUMA placement policy | empty to use the option.
+        std::string _mem_policy;
+
+        // Max L1-norm of neighbor ranks whose halo data is read,
+        // as determined by the stencil compiler.
+        // Default is all neighbors.
+        int _max_exch_dist = MAX_DIMS;
+
         // Convenience function to format indices like
         // "x=5, y=3".
         virtual std::string makeIndexString(const Indices& idxs,
@@ -147,12 +157,14 @@ namespace yask {
             // Init indices.
             int n = int(ndims);
             _domains.setFromConst(0, n);
-            _pads.setFromConst(0, n);
-            _halos.setFromConst(0, n);
+            _left_pads.setFromConst(0, n);
+            _right_pads.setFromConst(0, n);
+            _left_halos.setFromConst(0, n);
+            _right_halos.setFromConst(0, n);
             _offsets.setFromConst(0, n);
             _vec_lens.setFromConst(1, n);
             _allocs.setFromConst(1, n);
-            _vec_pads.setFromConst(1, n);
+            _vec_left_pads.setFromConst(1, n);
             _vec_allocs.setFromConst(1, n);
             
         }
@@ -166,6 +178,10 @@ namespace yask {
         // Resize flag accessors.
         virtual bool is_fixed_size() const { return !_do_resize; }
         virtual void set_resize(bool resize) { _do_resize = resize; }
+
+        // Halo-exchange footprint accessors.
+        virtual int get_max_exch_dist() const { return _max_exch_dist; }
+        virtual void set_max_exch_dist(int dist) { _max_exch_dist = dist; }
         
         // Lookup position by dim name.
         // Return -1 or die if not found, depending on flag.
@@ -246,6 +262,12 @@ namespace yask {
         // Set elements to a sequence of values using seed.
         // Cf. set_all_elements_same().
         virtual void set_all_elements_in_seq(double seed) =0;
+
+        // Set elements to a sequence of values using seed, where each
+        // value depends only on its overall-problem indices.  Unlike
+        // set_all_elements_in_seq(), the values do not depend on how
+        // the problem is divided among ranks.
+        virtual void set_all_elements_in_global_seq(double seed);
         
         // Get a pointer to one element.
         // Indices are relative to overall problem domain.
@@ -338,7 +360,8 @@ namespace yask {
         GET_GRID_API(_get_first_alloc_index)
         GET_GRID_API(_get_last_alloc_index)
         SET_GRID_API(_set_domain_size)
-        SET_GRID_API(_set_pad_size)
+        SET_GRID_API(_set_left_pad_size)
+        SET_GRID_API(_set_right_pad_size)
         SET_GRID_API(_set_offset)
 
         // Exposed APIs.
@@ -346,10 +369,14 @@ namespace yask {
         GET_GRID_API(get_first_rank_domain_index)
         GET_GRID_API(get_last_rank_domain_index)
         GET_GRID_API(get_halo_size)
+        GET_GRID_API(get_left_halo_size)
+        GET_GRID_API(get_right_halo_size)
         GET_GRID_API(get_first_rank_halo_index)
         GET_GRID_API(get_last_rank_halo_index)
         GET_GRID_API(get_extra_pad_size)
         GET_GRID_API(get_pad_size)
+        GET_GRID_API(get_left_pad_size)
+        GET_GRID_API(get_right_pad_size)
         GET_GRID_API(get_alloc_size)
         GET_GRID_API(get_first_rank_alloc_index)
         GET_GRID_API(get_last_rank_alloc_index)
@@ -357,6 +384,8 @@ namespace yask {
         GET_GRID_API(get_last_misc_index)
 
         SET_GRID_API(set_halo_size)
+        SET_GRID_API(set_left_halo_size)
+        SET_GRID_API(set_right_halo_size)
         SET_GRID_API(set_min_pad_size)
         SET_GRID_API(set_extra_pad_size)
         SET_GRID_API(set_alloc_size)
@@ -422,6 +451,12 @@ namespace yask {
             const Indices last(last_indices);
             return set_elements_in_slice(buffer_ptr, first, last);
         }
+        virtual void set_mem_policy(const std::string& policy) {
+            _mem_policy = policy;
+        }
+        virtual const std::string& get_mem_policy() const {
+            return _mem_policy;
+        }
         virtual void alloc_storage() {
             _ggb->default_alloc();
         }
@@ -519,7 +554,7 @@ namespace yask {
 
                     // Adjust for offset and padding.
                     // This gives a 0-based local element index.
-                    adj_idxs[i] = idxs[i] - _offsets[i] + _pads[i];
+                    adj_idxs[i] = idxs[i] - _offsets[i] + _left_pads[i];
                 }
             }
             
@@ -686,7 +721,7 @@ namespace yask {
 
                     // Adjust for offset and padding.
                     // This gives a positive 0-based local element index.
-                    idx_t ai = idxs[i] - _offsets[i] + _pads[i];
+                    idx_t ai = idxs[i] - _offsets[i] + _left_pads[i];
                     assert(ai >= 0);
                     uidx_t adj_idx = uidx_t(ai);
                     
@@ -794,7 +829,7 @@ namespace yask {
 
                     // Adjust for padding.
                     // This gives a 0-based local *vector* index.
-                    adj_idxs[i] = idxs[i] + _vec_pads[i];
+                    adj_idxs[i] = idxs[i] + _vec_left_pads[i];
                 }
             }
 
@@ -863,6 +898,74 @@ namespace yask {
 #endif
         }
 
+        // Copy vectors between a buffer and the slice of this grid
+        // starting at 'firstv' with sizes 'numVecsTuple'. Indices must be
+        // normalized. This is the fast path used to pack and unpack halo
+        // buffers: the step index must be the same for all points, so it
+        // is computed once. Each row of vectors along the buffer's
+        // unit-stride dim is copied with a constant stride in the grid
+        // (contiguously when possible), and rows are split across threads.
+        template<bool is_get>
+        void _copy_vecs_in_slice(real_vec_t* buf,
+                                 const Indices& firstv,
+                                 const IdxTuple& numVecsTuple) const {
+            int nd = numVecsTuple.getNumDims();
+            int id = numVecsTuple.isFirstInner() ? 0 : nd - 1;
+            idx_t ninner = numVecsTuple.getVal(id);
+            if (ninner <= 0)
+                return;
+            idx_t nrows = numVecsTuple.product() / ninner;
+            idx_t asi = get_alloc_step_index(firstv[Indices::step_posn]);
+
+            // Distance between vectors in the grid along the inner dim.
+            // This is constant because layouts are linear.
+            idx_t stride = 1;
+            if (ninner > 1) {
+                Indices pt1 = firstv;
+                pt1[id]++;
+                stride = getVecPtrNorm(pt1, asi) - getVecPtrNorm(firstv, asi);
+            }
+
+            // Rows are the outer dims of the buffer.
+            IdxTuple rowsTuple(numVecsTuple);
+            rowsTuple.setVal(id, 1);
+
+#pragma omp parallel for schedule(static)
+            for (idx_t r = 0; r < nrows; r++) {
+                IdxTuple ofs = rowsTuple.unlayout(r);
+                Indices pt = firstv.addElements(ofs);
+                real_vec_t* gp = const_cast<real_vec_t*>(getVecPtrNorm(pt, asi));
+                real_vec_t* bp = buf + r * ninner;
+
+                if (stride == 1) {
+                    if (is_get)
+                        memcpy((void*)bp, (const void*)gp, ninner * sizeof(real_vec_t));
+                    else
+                        memcpy((void*)gp, (const void*)bp, ninner * sizeof(real_vec_t));
+                }
+                else if (is_get) {
+                    for (idx_t i = 0; i < ninner; i++)
+                        bp[i] = gp[i * stride];
+                }
+                else {
+                    for (idx_t i = 0; i < ninner; i++)
+                        gp[i * stride] = bp[i];
+                }
+            }
+        }
+
+        // Whether _copy_vecs_in_slice() can be used for a slice.
+        bool _is_copy_vecs_ok(const Indices& firstv,
+                              const Indices& lastv) const {
+#ifdef TRACE_MEM
+            return false;
+#else
+            return get_num_dims() > 0 &&
+                (!_has_step_dim ||
+                 firstv[Indices::step_posn] == lastv[Indices::step_posn]);
+#endif
+        }
+
         // Vectorized version of set/get_elements_in_slice().
         virtual idx_t set_vecs_in_slice(const void* buffer_ptr,
                                         const Indices& first_indices,
@@ -880,8 +983,10 @@ namespace yask {
                        makeIndexString(firstv) << " to " <<
                        makeIndexString(lastv));
 
-            // Visit points in slice.
-            numVecsTuple.visitAllPointsInParallel
+            // Copy rows if possible, else visit points in slice.
+            if (_is_copy_vecs_ok(firstv, lastv))
+                _copy_vecs_in_slice<false>((real_vec_t*)buffer_ptr, firstv, numVecsTuple);
+            else numVecsTuple.visitAllPointsInParallel
                 ([&](const IdxTuple& ofs,
                      size_t idx) {
                     Indices pt = firstv.addElements(ofs);
@@ -918,9 +1023,11 @@ namespace yask {
                        numVecsTuple.makeDimValStr(" * ") << " vecs from " <<
                        makeIndexString(firstv) << " to " <<
                        makeIndexString(lastv));
-        
-            // Visit points in slice.
-            numVecsTuple.visitAllPointsInParallel
+
+            // Copy rows if possible, else visit points in slice.
+            if (_is_copy_vecs_ok(firstv, lastv))
+                _copy_vecs_in_slice<true>((real_vec_t*)buffer_ptr, firstv, numVecsTuple);
+            else numVecsTuple.visitAllPointsInParallel
                 ([&](const IdxTuple& ofs,
                      size_t idx) {
                     Indices pt = firstv.addElements(ofs);
@@ -91,6 +91,11 @@ namespace yask {
         comm = MPI_COMM_WORLD;
         MPI_Comm_rank(comm, &my_rank);
         MPI_Comm_size(comm, &num_ranks);
+
+        // Find ranks that can share memory with this one.
+        MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, my_rank, MPI_INFO_NULL, &shm_comm);
+        MPI_Comm_rank(shm_comm, &my_shm_rank);
+        MPI_Comm_size(shm_comm, &num_shm_ranks);
 #else
         comm = 0;
 #endif
@@ -151,13 +156,156 @@ namespace yask {
         
         // Set plain pointer to new data.
         if (base.get()) {
-            char* p = _base.get() + offset;
-            _elems = (real_t*)p;
+            _slots = _base.get() + offset;
+            _elems = (real_t*)_slots;
         } else {
+            _slots = 0;
             _elems = 0;
         }
     }
     
+    // Halo codec names, in same order as HaloCodec.
+    static const string halo_codec_names[] = { "none", "lossless", "fp16", "bf16" };
+    HaloCodec getHaloCodec(const string& name) {
+        for (int i = 0; i < halo_codec_n; i++)
+            if (name == halo_codec_names[i])
+                return HaloCodec(i);
+        cerr << "Error: unknown halo codec '" << name << "'; expected one of";
+        for (int i = 0; i < halo_codec_n; i++)
+            cerr << " '" << halo_codec_names[i] << "'";
+        cerr << ".\n";
+        exit_yask(1);
+        return halo_codec_none;
+    }
+    const string& getHaloCodecName(HaloCodec codec) {
+        assert(codec >= 0 && codec < halo_codec_n);
+        return halo_codec_names[codec];
+    }
+
+    // Max size of an encoded message.
+    // Lossless messages have a one-byte header indicating whether
+    // the data is compressed; data is sent raw if it doesn't compress.
+    size_t MPIBuf::get_wire_bytes() const {
+        switch (codec) {
+        case halo_codec_lossless:
+            return 1 + get_bytes();
+        case halo_codec_fp16:
+        case halo_codec_bf16:
+            return get_size() * sizeof(uint16_t);
+        default:
+            return get_bytes();
+        }
+    }
+
+    // Wire buffer plus scratch space for shuffled data.
+    size_t MPIBuf::get_wire_alloc_bytes() const {
+        if (codec == halo_codec_none)
+            return 0;
+        if (codec == halo_codec_lossless)
+            return ROUND_UP(get_wire_bytes(), CACHELINE_BYTES) + get_bytes();
+        return get_wire_bytes();
+    }
+
+    // Set pointer to wire storage.
+    void MPIBuf::set_wire_storage(std::shared_ptr<char>& base, size_t offset) {
+        _wire_base = base;
+        _wire_slots = base.get() ? base.get() + offset : 0;
+        _wire = _wire_slots;
+    }
+
+    // Encode elements into wire buffer.
+    size_t MPIBuf::encode() {
+        assert(_elems);
+        assert(_wire);
+        size_t n = get_size();
+        switch (codec) {
+
+        case halo_codec_lossless: {
+            size_t nbytes = get_bytes();
+            char* scratch = _wire + ROUND_UP(get_wire_bytes(), CACHELINE_BYTES);
+            byteShuffle((const char*)_elems, n, sizeof(real_t), scratch);
+            size_t cbytes = lzCompress(scratch, nbytes, _wire + 1, nbytes - 1);
+            if (cbytes) {
+                _wire[0] = 1;
+                return 1 + cbytes;
+            }
+            _wire[0] = 0;
+            memcpy(_wire + 1, _elems, nbytes);
+            return 1 + nbytes;
+        }
+
+        case halo_codec_fp16: {
+            uint16_t* wp = (uint16_t*)_wire;
+            for (size_t i = 0; i < n; i++)
+                wp[i] = floatToHalf(float(_elems[i]));
+            return n * sizeof(uint16_t);
+        }
+
+        case halo_codec_bf16: {
+            uint16_t* wp = (uint16_t*)_wire;
+            for (size_t i = 0; i < n; i++)
+                wp[i] = floatToBfloat16(float(_elems[i]));
+            return n * sizeof(uint16_t);
+        }
+
+        default:
+            memcpy(_wire, _elems, get_bytes());
+            return get_bytes();
+        }
+    }
+
+    // Decode wire buffer into elements.
+    void MPIBuf::decode(size_t nbytes) {
+        assert(_elems);
+        assert(_wire);
+        size_t n = get_size();
+        size_t rbytes = get_bytes();
+        bool ok = true;
+        switch (codec) {
+
+        case halo_codec_lossless:
+            if (nbytes < 1)
+                ok = false;
+            else if (_wire[0]) {
+                char* scratch = _wire + ROUND_UP(get_wire_bytes(), CACHELINE_BYTES);
+                ok = lzDecompress(_wire + 1, nbytes - 1, scratch, rbytes) == rbytes;
+                if (ok)
+                    byteUnshuffle(scratch, n, sizeof(real_t), (char*)_elems);
+            }
+            else if (nbytes == 1 + rbytes)
+                memcpy(_elems, _wire + 1, rbytes);
+            else
+                ok = false;
+            break;
+
+        case halo_codec_fp16: {
+            ok = nbytes == n * sizeof(uint16_t);
+            const uint16_t* wp = (const uint16_t*)_wire;
+            for (size_t i = 0; ok && i < n; i++)
+                _elems[i] = real_t(halfToFloat(wp[i]));
+            break;
+        }
+
+        case halo_codec_bf16: {
+            ok = nbytes == n * sizeof(uint16_t);
+            const uint16_t* wp = (const uint16_t*)_wire;
+            for (size_t i = 0; ok && i < n; i++)
+                _elems[i] = real_t(bfloat16ToFloat(wp[i]));
+            break;
+        }
+
+        default:
+            ok = nbytes == rbytes;
+            if (ok)
+                memcpy(_elems, _wire, nbytes);
+        }
+        if (!ok) {
+            cerr << "Error: cannot decode " << nbytes << " byte(s) of '" <<
+                getHaloCodecName(codec) << "' data for MPI buffer '" << name << "'.\n";
+            exit_yask(1);
+        }
+    }
+
     // Apply a function to each neighbor rank.
     // Called visitor function will contain the rank index of the neighbor.
     void MPIData::visitNeighbors(std::function<void
@@ -234,6 +382,84 @@ namespace yask {
                           ("msg_rank",
                            "Index of MPI rank that will print informational messages.",
                            msg_rank));
+        parser.add_option(new CommandLineParser::BoolOption
+                          ("use_shm",
+                           "Exchange halos with ranks on the same node via shared memory. "
+                           "Each receive buffer is allocated in an MPI-3 shared-memory window, "
+                           "and the sending rank packs its halo data directly into it, "
+                           "avoiding an MPI transfer. "
+                           "Halo data is still packed and unpacked; grid data is not shared.",
+                           use_shm));
+        parser.add_option(new CommandLineParser::StringOption
+                          ("rank_layout",
+                           "How to assign logical rank indices when not provided: "
+                           "'simple' lays out ranks in order of their MPI index; "
+                           "'cart' lets MPI reorder them via MPI_Cart_create(); "
+                           "'node' groups ranks on the same node into compact blocks "
+                           "to minimize inter-node halo exchange. "
+                           "A number of ranks of zero in any dimension is "
+                           "determined automatically via MPI_Dims_create().",
+                           rank_layout));
+        parser.add_option(new CommandLineParser::BoolOption
+                          ("balance_ranks",
+                           "Set rank-domain sizes so that the estimated compute cost "
+                           "is the same on all ranks. "
+                           "The cost of each point is the sum of the FP ops of the "
+                           "stencil groups valid at that point. "
+                           "The overall problem size is the rank-domain size times "
+                           "the number of ranks in each dimension.",
+                           balance_ranks));
+        parser.add_option(new CommandLineParser::IntOption
+                          ("rebalance_steps",
+                           "Number of steps between checks of the compute time "
+                           "(excluding MPI time) on each rank during run_solution(). "
+                           "If the imbalance exceeds the threshold, rank-domain "
+                           "boundaries are moved and grid data is migrated between ranks. "
+                           "Zero disables rebalancing.",
+                           rebalance_steps));
+        parser.add_option(new CommandLineParser::IntOption
+                          ("rebalance_pct",
+                           "Minimum imbalance, as a percentage of the mean compute time, "
+                           "that triggers rebalancing.",
+                           rebalance_pct));
+        parser.add_option(new CommandLineParser::StringOption
+                          ("halo_codec",
+                           "Encoding of halo data sent between ranks via MPI: "
+                           "'none', "
+                           "'lossless' (byte-shuffle plus LZ compression), "
+                           "'fp16' (IEEE half precision; lossy), or "
+                           "'bf16' (bfloat16; lossy). "
+                           "Specify a comma-separated list to set individual grids, "
+                           "e.g., 'lossless,pressure=fp16' sets 'pressure' to 'fp16' "
+                           "and all other grids to 'lossless'. "
+                           "Data sent via shared memory with '-use_shm' is never encoded, "
+                           "so the codec has no effect for neighbors on the same node.",
+                           halo_codec));
+        parser.add_option(new CommandLineParser::IntOption
+                          ("halo_buf_slots",
+                           "Number of halo-buffer slots per neighbor. "
+                           "When exchanging halos for several steps, "
+                           "the exchange for a step may start while sends for up to this "
+                           "many previous steps are still in progress. "
+                           "Each slot adds the size of every MPI send and receive buffer. "
+                           "Must be the same on all ranks.",
+                           halo_buf_slots));
+        parser.add_option(new CommandLineParser::BoolOption
+                          ("tune_halo_exchange",
+                           "Exchange halos while auto-tuning and rate each setting by its "
+                           "end-to-end step time, including halo packing, unpacking, and MPI. "
+                           "Otherwise, only compute time is used. "
+                           "Must be the same on all ranks.",
+                           tune_halo_exchange));
+        parser.add_option(new CommandLineParser::BoolOption
+                          ("auto_tune_all_ranks",
+                           "Coordinate the auto-tuner across ranks: "
+                           "rate each setting by the step time of the slowest rank, "
+                           "and search only on the first rank, so all ranks "
+                           "converge on the same settings. "
+                           "Otherwise, each rank is tuned independently. "
+                           "Must be the same on all ranks.",
+                           tune_all_ranks));
 #endif
         parser.add_option(new CommandLineParser::IntOption
                           ("max_threads",
@@ -247,6 +473,145 @@ namespace yask {
                           ("block_threads",
                            "Number of threads to use within each block.",
                            num_block_threads));
+        parser.add_option(new CommandLineParser::StringOption
+                          ("huge_pages",
+                           "Page policy for the grid and MPI buffers allocated by prepare_solution(): "
+                           "'thp' to request transparent huge pages via madvise(), "
+                           "'hugetlb' to map pages from the pre-reserved huge-page pool "
+                           "(falling back to 'thp' if the pool is too small), "
+                           "or 'none' for default pages.",
+                           huge_pages));
+        parser.add_option(new CommandLineParser::StringOption
+                          ("mem_policy",
+                           "NUMA placement of the grid data allocated by prepare_solution(): "
+                           "'default' for the OS default (usually first-touch), "
+                           "'hbm' to bind to the fast-tier nodes, "
+                           "'ddr' to bind to the other nodes with memory, "
+                           "'bind:<nodes>', 'interleave:<nodes>', or 'preferred:<node>' "
+                           "for explicit nodes, e.g., 'interleave:0-1', "
+                           "or 'auto' to bind the most frequently read grids to the fast tier "
+                           "while they fit within -fast_mem_budget and the rest to the other nodes. "
+                           "Specify a comma-separated list to set individual grids, "
+                           "e.g., 'ddr,pressure=hbm' binds 'pressure' to the fast tier "
+                           "and all other grids to the other nodes. "
+                           "A policy set via yk_grid::set_mem_policy() takes precedence.",
+                           mem_policy));
+        parser.add_option(new CommandLineParser::StringOption
+                          ("fast_mem_nodes",
+                           "NUMA nodes of the fast memory tier used by the 'hbm' and 'auto' "
+                           "memory policies, e.g., '1' or '4-7'. "
+                           "If empty, nodes with memory but without CPUs are used, "
+                           "as with high-bandwidth memory in flat mode. "
+                           "Set to an ordinary node to emulate a fast tier.",
+                           fast_mem_nodes));
+        parser.add_option(new CommandLineParser::IdxOption
+                          ("fast_mem_budget",
+                           "Capacity of the fast memory tier in MiB available to each rank "
+                           "for the 'auto' memory policy. "
+                           "If zero, the free memory on the fast-tier nodes divided by "
+                           "the number of ranks on the node is used.",
+                           fast_mem_budget));
+        parser.add_option(new CommandLineParser::BoolOption
+                          ("balance_blocks",
+                           "Adjust the block sizes in each region and the sub-block sizes "
+                           "in each block so that the number of blocks (sub-blocks) is a multiple "
+                           "of the number of threads per region (block) when possible and "
+                           "their sizes are nearly equal. "
+                           "Each adjusted size is a multiple of the cluster size "
+                           "between one half and all of the given size.",
+                           balance_blocks));
+        parser.add_option(new CommandLineParser::StringOption
+                          ("bind_block_threads",
+                           "Bind the threads of each block to the logical CPUs of one "
+                           "'core' (hyper-thread siblings) or of one 'l2' cache domain "
+                           "(e.g., a tile of two cores), read from sysfs, "
+                           "so that adjacent sub-blocks evaluated together by the block's threads "
+                           "share the halos loaded into those caches; "
+                           "or 'none' to leave thread placement to the OpenMP runtime.",
+                           bind_block_threads));
+        parser.add_option(new CommandLineParser::IntOption
+                          ("pfd_l1",
+                           "Number of clusters to prefetch ahead into the L1 cache "
+                           "in the inner loop (0 => no L1 prefetch).",
+                           _prefetch_L1_dist));
+        parser.add_option(new CommandLineParser::IntOption
+                          ("pfd_l2",
+                           "Number of clusters to prefetch ahead into the L2 cache "
+                           "in the inner loop (0 => no L2 prefetch).",
+                           _prefetch_L2_dist));
+        parser.add_option(new CommandLineParser::IntOption
+                          ("region_loop_variant",
+                           "Index of the generated loop code used to scan each region "
+                           "(0 => REGION_LOOP_CODE; " + to_string(NUM_REGION_LOOP_VARIANTS) +
+                           " variant(s) available).",
+                           _region_loop_variant));
+        parser.add_option(new CommandLineParser::IntOption
+                          ("block_loop_variant",
+                           "Index of the generated loop code used to scan each block "
+                           "(0 => BLOCK_LOOP_CODE; " + to_string(NUM_BLOCK_LOOP_VARIANTS) +
+                           " variant(s) available).",
+                           _block_loop_variant));
+        parser.add_option(new CommandLineParser::IntOption
+                          ("sub_block_loop_variant",
+                           "Index of the generated loop code used to scan each sub-block "
+                           "(0 => SUB_BLOCK_LOOP_CODE; " + to_string(NUM_SUB_BLOCK_LOOP_VARIANTS) +
+                           " variant(s) available).",
+                           _sub_block_loop_variant));
+        parser.add_option(new CommandLineParser::BoolOption
+                          ("recursive_tiling",
+                           "Evaluate each region by recursively bisecting it "
+                           "along its longest domain dimension until each tile has "
+                           "at most 'rec_base_pts' points, evaluating each tile as a block. "
+                           "Upper levels of the recursion run as OpenMP tasks. "
+                           "Block and block-group sizes are not used, so "
+                           "the working set fits in each cache level without tuning them.",
+                           rec_tiling));
+        parser.add_option(new CommandLineParser::IdxOption
+                          ("rec_base_pts",
+                           "Max number of points in each tile when using recursive tiling.",
+                           rec_base_pts));
+        parser.add_option(new CommandLineParser::IntOption
+                          ("rec_task_depth",
+                           "Max recursion depth at which OpenMP tasks are created "
+                           "when using recursive tiling; "
+                           "deeper tiles are evaluated by the thread that created them.",
+                           rec_task_depth));
+        parser.add_option(new CommandLineParser::StringOption
+                          ("auto_tune_levels",
+                           "Comma-separated list of settings searched by the auto-tuner: "
+                           "'region' (including temporal wave-front depth when using one rank), "
+                           "'block', 'block_group', 'block_threads', 'sub_block', 'sub_block_group', "
+                           "'prefetch' (L1 and L2 prefetch distances), "
+                           "and 'loops' (generated region, block, and sub-block loop variants). "
+                           "Levels are always searched from coarsest to finest in that order, "
+                           "each starting from the best values of the previous ones. "
+                           "Region sizes are only searched by run_auto_tuner_now(), "
+                           "e.g., via '-pre_auto_tune' in yask_kernel.",
+                           tune_levels));
+        parser.add_option(new CommandLineParser::StringOption
+                          ("auto_tune_search",
+                           "Strategy used by the auto-tuner to search the values of each level: "
+                           "'gd' for gradient descent over neighboring values with a shrinking radius, or "
+                           "'model' to fit a surrogate model to the measured rates and "
+                           "measure the most promising values next. "
+                           "The 'model' search usually needs fewer measurements.",
+                           tune_search));
+        parser.add_option(new CommandLineParser::IntOption
+                          ("auto_tune_max_ws_pct",
+                           "Block sizes whose estimated working set exceeds this percentage "
+                           "of the L2 cache size are not measured by the auto-tuner. "
+                           "The working set is the data reused while streaming through a block, "
+                           "including halos, over all grids and allocated steps. "
+                           "The cache size is read from sysfs. "
+                           "Use zero to disable this limit.",
+                           tune_max_ws_pct));
+        _add_domain_option(parser, "ts",
+                           "Size of the sample sub-domain in the center of each rank used "
+                           "by run_auto_tuner_now(); block sizes are limited to it, "
+                           "so a slab in the outer dimension is usually best, "
+                           "and region sizes are not searched "
+                           "(0 => entire rank domain)",
+                           _tune_sample_sizes);
     }
     
     // Print usage message.
@@ -389,6 +754,56 @@ namespace yask {
         return prod;
     }
 
+    // Get the halo codec for the named grid.
+    // Entries in 'halo_codec' are 'codec' or 'grid=codec'; an entry
+    // for the grid takes precedence over a default.
+    HaloCodec KernelSettings::get_halo_codec(const string& grid_name) const {
+        HaloCodec def_codec = halo_codec_none;
+        int grid_codec = -1;
+        istringstream iss(halo_codec);
+        string item;
+        while (getline(iss, item, ',')) {
+            if (item.empty())
+                continue;
+            auto eq = item.find('=');
+            if (eq == string::npos)
+                def_codec = getHaloCodec(item);
+            else {
+                auto codec = getHaloCodec(item.substr(eq + 1));
+                if (item.substr(0, eq) == grid_name)
+                    grid_codec = codec;
+            }
+        }
+        return (grid_codec >= 0) ? HaloCodec(grid_codec) : def_codec;
+    }
+
+    // Get the memory policy for the named grid.
+    // Same syntax as 'halo_codec', except that an item starting with a
+    // digit continues the node list of the previous item, e.g.,
+    // 'interleave:0,2' or 'p=bind:0,2'.
+    string KernelSettings::get_mem_policy(const string& grid_name) const {
+        vector<string> items;
+        istringstream iss(mem_policy);
+        string item;
+        while (getline(iss, item, ',')) {
+            if (item.empty())
+                continue;
+            if (isdigit(item[0]) && items.size())
+                items.back() += "," + item;
+            else
+                items.push_back(item);
+        }
+        string def_policy = "default", grid_policy;
+        for (auto& item : items) {
+            auto eq = item.find('=');
+            if (eq == string::npos)
+                def_policy = item;
+            else if (item.substr(0, eq) == grid_name)
+                grid_policy = item.substr(eq + 1);
+        }
+        return grid_policy.length() ? grid_policy : def_policy;
+    }
+
     // Make sure all user-provided settings are valid and finish setting up some
     // other vars before allocating memory.
     // Called from prepare_solution(), so it doesn't normally need to be called from user code.
@@ -417,6 +832,9 @@ namespace yask {
                                  _dims->_cluster_pts);
         os << " num-blocks-per-region: " << nb << endl;
         os << " num-blocks-per-rank-domain: " << (nb * nr) << endl;
+        if (rec_tiling)
+            os << " Since recursive tiling is enabled, regions are bisected into tiles of up to " <<
+                rec_base_pts << " points instead of blocks.\n";
 
         // Adjust defaults for sub-blocks to be slab.
         // Otherwise, findNumSubsets() would set default
@@ -478,6 +896,22 @@ namespace yask {
                                    _sub_block_group_sizes, "sub-block-group",
                                    _dims->_cluster_pts);
         os << " num-sub-blocks-per-sub-block-group: " << nsb_g << endl;
+
+        // Check generated loop variants.
+        auto check_variant = [&](int val, int nvals, const string& name) {
+            if (val < 0 || val >= nvals) {
+                cerr << "Error: " << name << "-loop variant " << val <<
+                    " is not between 0 and " << (nvals - 1) << ".\n";
+                exit_yask(1);
+            }
+        };
+        check_variant(_region_loop_variant, NUM_REGION_LOOP_VARIANTS, "region");
+        check_variant(_block_loop_variant, NUM_BLOCK_LOOP_VARIANTS, "block");
+        check_variant(_sub_block_loop_variant, NUM_SUB_BLOCK_LOOP_VARIANTS, "sub-block");
+        os << "\nLoop variants:" << endl <<
+            " region-loop-variant: " << _region_loop_variant << endl <<
+            " block-loop-variant: " << _block_loop_variant << endl <<
+            " sub-block-loop-variant: " << _sub_block_loop_variant << endl;
     }
 
 } // namespace yask.
@@ -68,7 +68,7 @@ namespace yask {
         Indices(const idx_t src[], int ndims) {
             setFromArray(src, ndims);
         }
-        Indices(idx_t src, int ndims) {
+        Indices(idx_t src, int ndims) : _ndims(ndims) {
             setFromConst(src, ndims);
         }
         
@@ -399,6 +399,11 @@ namespace yask {
         int num_ranks=1;        // total number of ranks.
         int my_rank=0;          // MPI-assigned index.
 
+        // MPI vars for ranks that can share memory, i.e., on the same node.
+        MPI_Comm shm_comm=0;    // shared-memory communicator.
+        int num_shm_ranks=1;    // number of ranks on this node.
+        int my_shm_rank=0;      // index in shm_comm.
+
         // OMP vars.
         int max_threads=0;      // initial value from OMP.
 
@@ -545,6 +550,11 @@ namespace yask {
         // Whether each neighbor has all its rank-domain
         // sizes as a multiple of the vector length.
         std::vector<bool> has_all_vlen_mults;
+
+        // Rank of each neighbor in the shared-memory communicator.
+        // MPI_PROC_NULL => not on this node.
+        // Vector index is per getNeighborIndex().
+        Neighbors shm_ranks;
         
         // Ctor based on pre-set problem dimensions.
         MPIInfo(DimsPtr dims) : _dims(dims) {
@@ -563,6 +573,7 @@ namespace yask {
             my_neighbors.resize(neighborhood_size, MPI_PROC_NULL);
             man_dists.resize(neighborhood_size, 0);
             has_all_vlen_mults.resize(neighborhood_size, false);
+            shm_ranks.resize(neighborhood_size, MPI_PROC_NULL);
         }
 
         // Get a 1D index for a neighbor.
@@ -584,6 +595,20 @@ namespace yask {
     };
     typedef std::shared_ptr<MPIInfo> MPIInfoPtr;
 
+    // Encodings for halo data sent between ranks.
+    enum HaloCodec {
+        halo_codec_none,        // raw data.
+        halo_codec_lossless,    // byte-shuffle + LZ compression.
+        halo_codec_fp16,        // IEEE half precision (lossy).
+        halo_codec_bf16,        // bfloat16 (lossy).
+        halo_codec_n
+    };
+
+    // Convert between codec names and values.
+    // Exit on bad name.
+    extern HaloCodec getHaloCodec(const std::string& name);
+    extern const std::string& getHaloCodecName(HaloCodec codec);
+
     // MPI data for one buffer for one neighbor of one grid.
     struct MPIBuf {
 
@@ -591,9 +616,16 @@ namespace yask {
         std::string name;
         
         // Send or receive buffer.
+        // Points into the current slot.
         std::shared_ptr<char> _base;
         real_t* _elems = 0;
 
+        // Ring of storage slots, one for each step whose exchange may be
+        // in flight. Slots are contiguous, starting at '_slots'.
+        int num_slots = 1;
+        int cur_slot = 0;
+        char* _slots = 0;
+
         // Range to copy to/from grid.
         // NB: step index not set properly for grids with step dim.
         IdxTuple begin_pt, last_pt;
@@ -605,6 +637,19 @@ namespace yask {
         // vector length in all dims.
         bool has_all_vlen_mults = false;
 
+        // Whether this buffer is in memory shared with the neighbor.
+        // If so, a send buffer points directly to the neighbor's
+        // receive buffer, and no data is sent via MPI.
+        bool use_shm = false;
+
+        // Encoding of data sent to or received from the neighbor.
+        // If not 'none', data is encoded into the wire buffer before
+        // sending and decoded from it after receiving.
+        HaloCodec codec = halo_codec_none;
+        std::shared_ptr<char> _wire_base;
+        char* _wire = 0;        // in current slot.
+        char* _wire_slots = 0;
+
         // Number of points overall.
         idx_t get_size() const {
             if (num_pts.size() == 0)
@@ -615,15 +660,62 @@ namespace yask {
             return get_size() * sizeof(real_t);
         }
 
+        // Max number of bytes in an encoded message.
+        size_t get_wire_bytes() const;
+
+        // Number of bytes needed for the wire buffer, including any
+        // scratch space used while encoding.
+        size_t get_wire_alloc_bytes() const;
+
+        // Bytes between slots and total bytes for all slots.
+        size_t get_slot_bytes() const {
+            return ROUND_UP(get_bytes(), CACHELINE_BYTES);
+        }
+        size_t get_ring_bytes() const {
+            return get_slot_bytes() * num_slots;
+        }
+        size_t get_wire_slot_bytes() const {
+            return ROUND_UP(get_wire_alloc_bytes(), CACHELINE_BYTES);
+        }
+        size_t get_wire_ring_bytes() const {
+            return get_wire_slot_bytes() * num_slots;
+        }
+
         // Set pointer to storage.
         // Free old storage.
-        // 'base' should provide get_num_bytes() bytes at offset bytes.
+        // 'base' should provide get_ring_bytes() bytes at offset bytes.
         void set_storage(std::shared_ptr<char>& base, size_t offset);
 
+        // Set pointer to wire storage.
+        // 'base' should provide get_wire_ring_bytes() bytes at offset bytes.
+        void set_wire_storage(std::shared_ptr<char>& base, size_t offset);
+
+        // Point '_elems' and '_wire' to given slot.
+        void set_slot(int slot) {
+            assert(slot >= 0 && slot < num_slots);
+            cur_slot = slot;
+            if (_slots)
+                _elems = (real_t*)(_slots + get_slot_bytes() * slot);
+            if (_wire_slots)
+                _wire = _wire_slots + get_wire_slot_bytes() * slot;
+        }
+
+        // Encode data from elements into wire buffer.
+        // Return number of bytes to send.
+        size_t encode();
+
+        // Decode 'nbytes' bytes from wire buffer into elements.
+        void decode(size_t nbytes);
+
         // Release storage.
         void release_storage() {
             _base.reset();
             _elems = 0;
+            _slots = 0;
+            _wire_base.reset();
+            _wire = 0;
+            _wire_slots = 0;
+            cur_slot = 0;
         }
 
         // Reset.
@@ -707,16 +799,49 @@ namespace yask {
         IdxTuple _rank_indices;    // my rank index in each dim.
         bool find_loc=true;        // whether my rank index needs to be calculated.
         int msg_rank=0;            // rank that prints informational messages.
+        bool use_shm=false;        // use shared-memory halo buffers for ranks on same node.
+        std::string rank_layout="simple"; // how to assign rank indices: simple, cart, or node.
+        bool balance_ranks=false;  // set rank sizes based on est. cost of stencil groups.
+        bool ranks_balanced=false; // whether rank sizes have already been balanced.
+        int rebalance_steps=0;     // steps between dynamic load-balance checks; 0=>never.
+        int rebalance_pct=10;      // min imbalance (percent) to trigger rebalancing.
+        std::string halo_codec="none"; // encoding of halo data, optionally per grid.
+        int halo_buf_slots=1;      // number of steps whose halo exchanges may be in flight.
+        bool tune_halo_exchange=false; // include halo-exchange time in auto-tuner measurements.
+        bool tune_all_ranks=false; // use the same auto-tuner settings on all ranks.
 
         // OpenMP settings.
         int max_threads=0;      // Initial number of threads to use overall; 0=>OMP default.
         int thread_divisor=1;   // Reduce number of threads by this amount.
         int num_block_threads=1; // Number of threads to use for a block.
-
-        // Prefetch distances.
-        // Prefetching must be enabled via YASK_PREFETCH_L[12] macros.
-        int _prefetch_L1_dist=1;
-        int _prefetch_L2_dist=2;
+        std::string bind_block_threads="none"; // CPUs shared by a block's threads: none, core, or l2.
+        bool balance_blocks=false; // adjust block and sub-block sizes to balance threads.
+
+        // Memory settings.
+        std::string huge_pages="none"; // page policy for grid and MPI buffers: none, thp, or hugetlb.
+        std::string mem_policy="default"; // NUMA placement of grid data, optionally per grid.
+        std::string fast_mem_nodes; // NUMA nodes of the fast tier; empty=>nodes w/o CPUs.
+        idx_t fast_mem_budget=0; // MiB of fast tier for 'auto' placement; 0=>free memory.
+
+        // Auto-tuner settings.
+        std::string tune_levels="block"; // comma-separated levels to search.
+        std::string tune_search="gd";    // search strategy.
+        int tune_max_ws_pct=200;  // max block working set as pct of L2 size; 0=>no limit.
+        IdxTuple _tune_sample_sizes; // sub-domain used by run_auto_tuner_now(); 0=>full rank.
+
+        // Prefetch distances in clusters; 0 => no prefetch.
+        int _prefetch_L1_dist=PFD_L1;
+        int _prefetch_L2_dist=PFD_L2;
+
+        // Generated loop variants to run; see *_LOOP_VARIANTS in the Makefile.
+        int _region_loop_variant=0;
+        int _block_loop_variant=0;
+        int _sub_block_loop_variant=0;
+
+        // Recursive tiling settings.
+        bool rec_tiling=false;    // bisect regions recursively instead of using blocks.
+        idx_t rec_base_pts=32768; // max points in a leaf tile.
+        int rec_task_depth=8;     // max recursion depth at which tasks are created.
 
         // Ctor.
         KernelSettings(DimsPtr dims, KernelEnvPtr env) : 
@@ -757,6 +882,10 @@ namespace yask {
             
             _rank_indices = dims->_domain_dims;
             _rank_indices.setValsSame(0);
+
+            // Use domain dims only for auto-tuner sample.
+            _tune_sample_sizes = dims->_domain_dims;
+            _tune_sample_sizes.setValsSame(0);
         }
         virtual ~KernelSettings() { }
 
@@ -789,6 +918,11 @@ namespace yask {
         // Prints informational info to 'os'.
         virtual void adjustSettings(std::ostream& os, KernelEnvPtr env);
 
+        // Get the halo codec for the named grid from 'halo_codec'.
+        virtual HaloCodec get_halo_codec(const std::string& grid_name) const;
+
+        // Get the memory policy for the named grid from 'mem_policy'.
+        virtual std::string get_mem_policy(const std::string& grid_name) const;
     };
     typedef std::shared_ptr<KernelSettings> KernelSettingsPtr;
     
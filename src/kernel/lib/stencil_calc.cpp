@@ -51,7 +51,12 @@ namespace yask {
 
         // Set number of threads for a block.
         // This should be nested within a top-level OpenMP task.
-        _generic_context->set_block_threads();
+        int nbt = _generic_context->set_block_threads();
+
+        // Balance sub-blocks across the block threads.
+        if (opts->balance_blocks)
+            _generic_context->balance_steps(block_idxs.begin, block_idxs.end,
+                                            block_idxs.step, nbt);
 
         // Include automatically-generated loop code that calls
         // calc_sub_block() for each sub-block in this block.  Loops through
@@ -105,6 +110,9 @@ namespace yask {
         TRACE_MSG3("calc_sub_block: " << block_idxs.start.makeValStr(nsdims) <<
                   " ... (end before) " << block_idxs.stop.makeValStr(nsdims));
 
+        // Keep this block's threads on CPUs that share caches.
+        cp->bind_block_thread();
+
         // Init sub-block begin & end from block start & stop indices.
         // These indices are in element units.
         ScanIndices sub_block_idxs(nsdims);
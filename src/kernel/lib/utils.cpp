@@ -60,6 +60,102 @@ namespace yask {
         return static_cast<char*>(p);
     }
 
+    // Size of default huge pages from /proc/meminfo, e.g., from
+    // "Hugepagesize:       2048 kB".
+    static size_t getHugePageSize() {
+        ifstream fs("/proc/meminfo");
+        string line;
+        size_t kb = 0;
+        while (getline(fs, line)) {
+            istringstream iss(line);
+            string key;
+            iss >> key;
+            if (key == "Hugepagesize:") {
+                iss >> kb;
+                break;
+            }
+        }
+        return kb ? kb * 1024 : 2 * 1024 * 1024;
+    }
+
+    // Page-policy allocation.
+    shared_ptr<char> pageAlloc(size_t nbytes,
+                               const string& policy,
+                               string& used_policy) {
+        if (policy != "none" && policy != "thp" && policy != "hugetlb") {
+            cerr << "Error: unknown huge-page policy '" << policy <<
+                "'; use one of 'none', 'thp', or 'hugetlb'.\n";
+            exit_yask(1);
+        }
+        used_policy = policy;
+#ifdef __linux__
+        size_t hpsize = getHugePageSize();
+        size_t hpbytes = ROUND_UP(max(nbytes, size_t(1)), hpsize);
+
+        // Map pages from the huge-page pool.
+        if (used_policy == "hugetlb") {
+            void* p = mmap(NULL, hpbytes, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (p != MAP_FAILED)
+                return shared_ptr<char>(static_cast<char*>(p),
+                                        [hpbytes](char* p) { munmap(p, hpbytes); });
+            used_policy = "thp";
+        }
+
+        // Align to huge pages and ask for transparent huge pages.
+        if (used_policy == "thp") {
+            void* p = 0;
+            if (posix_memalign(&p, hpsize, hpbytes) == 0) {
+                if (madvise(p, hpbytes, MADV_HUGEPAGE) == 0)
+                    return shared_ptr<char>(static_cast<char*>(p), AlignedDeleter());
+                free(p);
+            }
+            used_policy = "none";
+        }
+#else
+        used_policy = "none";
+#endif
+        return shared_ptr<char>(alignedAlloc(nbytes), AlignedDeleter());
+    }
+
+    // Sum the huge-page fields of the mappings in /proc/self/smaps that
+    // overlap the given range, e.g.,
+    // "7f0000000000-7f0000400000 rw-p 00000000 00:00 0" followed by
+    // "AnonHugePages:      4096 kB" or "Private_Hugetlb:    4096 kB".
+    size_t getHugePageBytes(const char* p, size_t nbytes) {
+        ifstream fs("/proc/self/smaps");
+        uintptr_t begin = uintptr_t(p), end = begin + nbytes;
+        uintptr_t mbegin = 0, mend = 0;
+        size_t total = 0;
+        string line;
+        while (getline(fs, line)) {
+            istringstream iss(line);
+            string key;
+            iss >> key;
+            if (key.empty())
+                continue;
+
+            // Header of a mapping.
+            auto dash = key.find('-');
+            if (key.back() != ':' && dash != string::npos) {
+                mbegin = stoull(key.substr(0, dash), 0, 16);
+                mend = stoull(key.substr(dash + 1), 0, 16);
+                continue;
+            }
+
+            // Huge pages in an overlapping mapping.
+            if (mend > begin && mbegin < end &&
+                (key == "AnonHugePages:" || key == "Shared_Hugetlb:" ||
+                 key == "Private_Hugetlb:")) {
+                size_t kb = 0;
+                iss >> kb;
+                size_t overlap = min(mend, end) - max(mbegin, begin);
+                total += min(kb * 1024, overlap);
+            }
+        }
+        return total;
+    }
+
     // Return num with SI multiplier and "iB" suffix,
     // e.g., 412KiB.
     string makeByteStr(size_t nbytes)
@@ -122,6 +218,414 @@ namespace yask {
         return res;
     }
     
+    // Byte-shuffle elements.
+    void byteShuffle(const char* src, size_t nelems, size_t elem_bytes, char* dst) {
+        for (size_t b = 0; b < elem_bytes; b++)
+            for (size_t i = 0; i < nelems; i++)
+                dst[b * nelems + i] = src[i * elem_bytes + b];
+    }
+    void byteUnshuffle(const char* src, size_t nelems, size_t elem_bytes, char* dst) {
+        for (size_t b = 0; b < elem_bytes; b++)
+            for (size_t i = 0; i < nelems; i++)
+                dst[i * elem_bytes + b] = src[b * nelems + i];
+    }
+
+    // LZ77-class compression using the LZ4 block format: a sequence of
+    // tokens, each with a count of literal bytes and the length and
+    // offset of a match. The last token has only literals.
+    size_t lzCompress(const char* src, size_t nbytes, char* dst, size_t max_bytes) {
+        const int hash_bits = 12;
+        const size_t min_match = 4;
+        const size_t max_ofs = 65535;
+        const uint8_t* ip = (const uint8_t*)src;
+        uint8_t* op = (uint8_t*)dst;
+        uint8_t* oend = op + max_bytes;
+
+        // Position of last occurrence of each hashed 4-byte sequence.
+        uint32_t table[1 << hash_bits];
+        memset(table, 0, sizeof(table));
+        auto read32 = [&](size_t i) {
+            uint32_t v;
+            memcpy(&v, ip + i, sizeof(v));
+            return v;
+        };
+        auto hash = [&](uint32_t v) {
+            return (v * 2654435761u) >> (32 - hash_bits);
+        };
+
+        // Write an extended length.
+        auto put_len = [&](size_t len) {
+            for (; len >= 255; len -= 255) {
+                if (op >= oend)
+                    return false;
+                *op++ = 255;
+            }
+            if (op >= oend)
+                return false;
+            *op++ = uint8_t(len);
+            return true;
+        };
+
+        // Write literals from 'anchor' and a match, if any.
+        size_t anchor = 0;
+        auto put_seq = [&](size_t nlits, size_t mlen, size_t ofs) {
+            if (op >= oend)
+                return false;
+            uint8_t* token = op++;
+            *token = uint8_t(min(nlits, size_t(15)) << 4);
+            if (nlits >= 15 && !put_len(nlits - 15))
+                return false;
+            if (size_t(oend - op) < nlits)
+                return false;
+            memcpy(op, ip + anchor, nlits);
+            op += nlits;
+            if (mlen) {
+                if (oend - op < 2)
+                    return false;
+                *op++ = uint8_t(ofs);
+                *op++ = uint8_t(ofs >> 8);
+                mlen -= min_match;
+                *token |= uint8_t(min(mlen, size_t(15)));
+                if (mlen >= 15 && !put_len(mlen - 15))
+                    return false;
+            }
+            return true;
+        };
+
+        // Find matches, leaving a few bytes at the end as literals.
+        // Skip faster through data that isn't matching.
+        size_t limit = (nbytes > 12) ? nbytes - 12 : 0;
+        size_t i = 0;
+        while (i < limit) {
+            uint32_t v = read32(i);
+            auto h = hash(v);
+            size_t cand = table[h];
+            table[h] = uint32_t(i);
+            if (cand < i && i - cand <= max_ofs && read32(cand) == v) {
+                size_t mlen = min_match;
+                while (i + mlen < limit && ip[cand + mlen] == ip[i + mlen])
+                    mlen++;
+                if (!put_seq(i - anchor, mlen, i - cand))
+                    return 0;
+                i += mlen;
+                anchor = i;
+            }
+            else
+                i += 1 + ((i - anchor) >> 6);
+        }
+        if (!put_seq(nbytes - anchor, 0, 0))
+            return 0;
+        return op - (uint8_t*)dst;
+    }
+
+    // Decompress data from lzCompress().
+    size_t lzDecompress(const char* src, size_t nbytes, char* dst, size_t max_bytes) {
+        const uint8_t* ip = (const uint8_t*)src;
+        const uint8_t* iend = ip + nbytes;
+        uint8_t* op = (uint8_t*)dst;
+        uint8_t* oend = op + max_bytes;
+
+        // Read an extended length; return 0 on failure.
+        auto get_len = [&](size_t len) {
+            uint8_t b;
+            do {
+                if (ip >= iend)
+                    return size_t(0);
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+            return len;
+        };
+
+        while (ip < iend) {
+            uint8_t token = *ip++;
+            size_t nlits = token >> 4;
+            if (nlits == 15 && !(nlits = get_len(nlits)))
+                return 0;
+            if (nlits > size_t(iend - ip) || nlits > size_t(oend - op))
+                return 0;
+            memcpy(op, ip, nlits);
+            ip += nlits;
+            op += nlits;
+
+            // Last token has no match.
+            if (ip == iend)
+                break;
+            if (iend - ip < 2)
+                return 0;
+            size_t ofs = ip[0] | (size_t(ip[1]) << 8);
+            ip += 2;
+            size_t mlen = token & 15;
+            if (mlen == 15 && !(mlen = get_len(mlen)))
+                return 0;
+            mlen += 4;
+            if (ofs == 0 || ofs > size_t(op - (uint8_t*)dst) ||
+                mlen > size_t(oend - op))
+                return 0;
+
+            // Byte copy, because the match may overlap the output.
+            const uint8_t* mp = op - ofs;
+            for (size_t j = 0; j < mlen; j++)
+                op[j] = mp[j];
+            op += mlen;
+        }
+        return op - (uint8_t*)dst;
+    }
+
+    // FP32 to IEEE half precision.
+    uint16_t floatToHalf(float f) {
+        uint32_t x;
+        memcpy(&x, &f, sizeof(x));
+        uint32_t sign = (x >> 16) & 0x8000;
+        uint32_t ax = x & 0x7fffffff;
+
+        // Inf or NaN.
+        if (ax >= 0x7f800000)
+            return uint16_t(sign | 0x7c00 | (ax > 0x7f800000 ? 0x200 : 0));
+
+        // Too big: rounds to inf.
+        if (ax >= 0x477ff000)
+            return uint16_t(sign | 0x7c00);
+
+        // Too small for a normal half: make subnormal or zero.
+        if (ax < 0x38800000) {
+            if (ax <= 0x33000000)
+                return uint16_t(sign);
+            uint32_t e = ax >> 23;
+            uint32_t m = (ax & 0x7fffff) | 0x800000;
+            int shift = 126 - e;
+            uint32_t r = m >> shift;
+            uint32_t rem = m & ((1u << shift) - 1);
+            uint32_t halfway = 1u << (shift - 1);
+            if (rem > halfway || (rem == halfway && (r & 1)))
+                r++;
+            return uint16_t(sign | r);
+        }
+
+        // Normal: rebias exponent and round mantissa.
+        uint32_t r = ax - 0x38000000;
+        r = (r + 0xfff + ((r >> 13) & 1)) >> 13;
+        return uint16_t(sign | r);
+    }
+    float halfToFloat(uint16_t h) {
+        uint32_t sign = uint32_t(h & 0x8000) << 16;
+        uint32_t e = (h >> 10) & 0x1f;
+        uint32_t m = h & 0x3ff;
+        uint32_t x;
+        if (e == 0x1f)
+            x = sign | 0x7f800000 | (m << 13);
+        else if (e)
+            x = sign | ((e + 112) << 23) | (m << 13);
+        else {
+            float f = float(m) * (1.f / 16777216.f);
+            memcpy(&x, &f, sizeof(x));
+            x |= sign;
+        }
+        float f;
+        memcpy(&f, &x, sizeof(f));
+        return f;
+    }
+
+    // FP32 to bfloat16, i.e., the upper 16 bits.
+    uint16_t floatToBfloat16(float f) {
+        uint32_t x;
+        memcpy(&x, &f, sizeof(x));
+        if ((x & 0x7fffffff) > 0x7f800000)
+            return uint16_t((x >> 16) | 0x40); // keep NaN quiet.
+        x += 0x7fff + ((x >> 16) & 1);
+        return uint16_t(x >> 16);
+    }
+    float bfloat16ToFloat(uint16_t h) {
+        uint32_t x = uint32_t(h) << 16;
+        float f;
+        memcpy(&f, &x, sizeof(f));
+        return f;
+    }
+
+    // Find cache size from sysfs, e.g., from
+    // /sys/devices/system/cpu/cpu0/cache/index2/{level,type,size}.
+    idx_t getCacheBytes(int level) {
+        for (int i = 0; ; i++) {
+            string dir = "/sys/devices/system/cpu/cpu0/cache/index" + to_string(i) + "/";
+            ifstream lfs(dir + "level");
+            if (!lfs)
+                break;
+            int lvl = 0;
+            string type, size;
+            lfs >> lvl;
+            ifstream tfs(dir + "type");
+            tfs >> type;
+            if (lvl != level || type == "Instruction")
+                continue;
+            ifstream sfs(dir + "size");
+            sfs >> size;
+
+            // Size is a number with an optional K, M, or G suffix.
+            idx_t nbytes = atol(size.c_str());
+            if (size.find('K') != string::npos)
+                nbytes *= 1024;
+            else if (size.find('M') != string::npos)
+                nbytes *= 1024 * 1024;
+            else if (size.find('G') != string::npos)
+                nbytes *= 1024 * 1024 * 1024;
+            return nbytes;
+        }
+        return 0;
+    }
+
+    // Find CPU groups from sysfs, e.g., from
+    // /sys/devices/system/cpu/cpu0/topology/thread_siblings_list or
+    // /sys/devices/system/cpu/cpu0/cache/index2/shared_cpu_list.
+    // Lists are comma-separated CPUs or ranges, e.g., "0-1,36-37".
+    vector<vector<int>> getCpuGroups(const string& share) {
+        set<vector<int>> groups;
+#ifdef __linux__
+        cpu_set_t allowed;
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+            return vector<vector<int>>();
+        int ncpus = int(sysconf(_SC_NPROCESSORS_CONF));
+        for (int cpu = 0; cpu < ncpus; cpu++) {
+            if (!CPU_ISSET(cpu, &allowed))
+                continue;
+            string dir = "/sys/devices/system/cpu/cpu" + to_string(cpu) + "/";
+            string list;
+            if (share == "core") {
+                ifstream fs(dir + "topology/thread_siblings_list");
+                fs >> list;
+            }
+            else {
+                for (int i = 0; ; i++) {
+                    string cdir = dir + "cache/index" + to_string(i) + "/";
+                    ifstream lfs(cdir + "level");
+                    if (!lfs)
+                        break;
+                    int lvl = 0;
+                    string type;
+                    lfs >> lvl;
+                    ifstream tfs(cdir + "type");
+                    tfs >> type;
+                    if (lvl == 2 && type != "Instruction") {
+                        ifstream fs(cdir + "shared_cpu_list");
+                        fs >> list;
+                        break;
+                    }
+                }
+            }
+            if (list.empty())
+                return vector<vector<int>>();
+
+            // Parse list, keeping only allowed CPUs.
+            vector<int> group;
+            for (int c : parseIntList(list))
+                if (c < CPU_SETSIZE && CPU_ISSET(c, &allowed))
+                    group.push_back(c);
+            groups.insert(group);
+        }
+#endif
+        return vector<vector<int>>(groups.begin(), groups.end());
+    }
+
+    bool bindThreadToCpu(int cpu) {
+#ifdef __linux__
+        cpu_set_t cs;
+        CPU_ZERO(&cs);
+        CPU_SET(cpu, &cs);
+        return sched_setaffinity(0, sizeof(cs), &cs) == 0;
+#else
+        return false;
+#endif
+    }
+
+    // Parse a list like "0-1,36-37".
+    vector<int> parseIntList(const string& list) {
+        vector<int> vals;
+        istringstream iss(list);
+        string item;
+        while (getline(iss, item, ',')) {
+            if (item.empty())
+                continue;
+            int first = atoi(item.c_str());
+            auto dash = item.find('-');
+            int last = (dash == string::npos) ? first : atoi(item.c_str() + dash + 1);
+            for (int v = first; v <= last; v++)
+                vals.push_back(v);
+        }
+        return vals;
+    }
+
+    // Find NUMA nodes from /sys/devices/system/node/has_memory and
+    // /sys/devices/system/node/has_cpu.
+    vector<int> getMemNodes(bool cpuless_only) {
+        vector<int> nodes;
+        string mlist, clist;
+        ifstream mfs("/sys/devices/system/node/has_memory");
+        mfs >> mlist;
+        ifstream cfs("/sys/devices/system/node/has_cpu");
+        cfs >> clist;
+        auto cnodes = parseIntList(clist);
+        for (int n : parseIntList(mlist))
+            if (!cpuless_only || find(cnodes.begin(), cnodes.end(), n) == cnodes.end())
+                nodes.push_back(n);
+        return nodes;
+    }
+
+    // Find free memory from sysfs, e.g., from
+    // "Node 1 MemFree:        4747604 kB" in
+    // /sys/devices/system/node/node1/meminfo.
+    idx_t getNodeFreeBytes(int node) {
+        ifstream fs("/sys/devices/system/node/node" + to_string(node) + "/meminfo");
+        string line;
+        while (getline(fs, line)) {
+            istringstream iss(line);
+            string word, n, key;
+            iss >> word >> n >> key;
+            if (key == "MemFree:") {
+                idx_t kb = 0;
+                iss >> kb;
+                return kb * 1024;
+            }
+        }
+        return 0;
+    }
+
+    // Set NUMA policy via the mbind() system call, which avoids a
+    // dependency on libnuma. Values are from <numaif.h>.
+    bool bindMemory(char* p, size_t nbytes,
+                    const string& mode, const vector<int>& nodes) {
+#if defined(__linux__) && defined(SYS_mbind)
+        const int mpol_preferred = 1, mpol_bind = 2, mpol_interleave = 3;
+        const unsigned mpol_mf_move = 1 << 1;
+        int mpol = (mode == "bind") ? mpol_bind :
+            (mode == "interleave") ? mpol_interleave :
+            (mode == "preferred") ? mpol_preferred : -1;
+        if (mpol < 0 || nodes.empty())
+            return false;
+
+        // Node mask.
+        const int nbits = sizeof(unsigned long) * 8;
+        vector<unsigned long> mask(1);
+        for (int n : nodes) {
+            if (n < 0)
+                return false;
+            if (size_t(n / nbits) >= mask.size())
+                mask.resize(n / nbits + 1);
+            mask[n / nbits] |= 1UL << (n % nbits);
+        }
+
+        // Only whole pages can be bound.
+        uintptr_t pgsize = sysconf(_SC_PAGESIZE);
+        uintptr_t begin = ROUND_UP(uintptr_t(p), pgsize);
+        uintptr_t end = (uintptr_t(p) + nbytes) / pgsize * pgsize;
+        if (end <= begin)
+            return true;
+        long ret = syscall(SYS_mbind, begin, end - begin, mpol,
+                           mask.data(), mask.size() * nbits + 1, mpol_mf_move);
+        return ret == 0;
+#else
+        return false;
+#endif
+    }
+
     // Find sum of rank_vals over all ranks.
     idx_t sumOverRanks(idx_t rank_val, MPI_Comm comm) {
         idx_t sum_val = rank_val;
@@ -286,6 +790,28 @@ namespace yask {
             _val << "." << endl;
     }
     
+    // Check for a string option.
+    bool CommandLineParser::StringOption::check_arg(std::vector<std::string>& args,
+                                                    int& argi) {
+        if (_check_arg(args, argi, _name)) {
+            if (size_t(argi) >= args.size() || args[argi].length() == 0) {
+                cerr << "Error: no argument for option '" << args[argi - 1] << "'." << endl;
+                exit_yask(1);
+            }
+            _val = args[argi++];
+            return true;
+        }
+        return false;
+    }
+
+    // Print help on a string option.
+    void CommandLineParser::StringOption::print_help(ostream& os,
+                                                     int width) const {
+        _print_help(os, _name + " <string>", width);
+        os << _help_leader << _current_value_str <<
+            "'" << _val << "'." << endl;
+    }
+    
     // Print help on an multi-idx_t option.
     void CommandLineParser::MultiIdxOption::print_help(ostream& os,
                                                   int width) const {
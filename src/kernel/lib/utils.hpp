@@ -57,11 +57,66 @@ namespace yask {
     extern void assertEqualityOverRanks(idx_t rank_val, MPI_Comm comm,
                                         const std::string& descr);
     
+    // Size in bytes of the data or unified cache at 'level' (1, 2, ...)
+    // used by the current core, as reported by sysfs, or zero if unknown.
+    extern idx_t getCacheBytes(int level);
+
+    // Groups of logical CPUs allowed for this process that share a core
+    // ('core') or an L2 cache ('l2'), as reported by sysfs, ordered by
+    // their first CPU. Empty if unknown.
+    extern std::vector<std::vector<int>> getCpuGroups(const std::string& share);
+
+    // Bind the calling thread to logical CPU 'cpu'.
+    // Return whether successful.
+    extern bool bindThreadToCpu(int cpu);
+
+    // List of ints from a comma-separated list of ints or ranges,
+    // e.g., "0-1,4" => 0, 1, 4.
+    extern std::vector<int> parseIntList(const std::string& list);
+
+    // NUMA nodes that have memory, as reported by sysfs. If
+    // 'cpuless_only' is set, only those without CPUs, e.g.,
+    // high-bandwidth memory in flat mode. Empty if unknown.
+    extern std::vector<int> getMemNodes(bool cpuless_only);
+
+    // Free memory on NUMA node 'node' in bytes, as reported by sysfs,
+    // or zero if unknown.
+    extern idx_t getNodeFreeBytes(int node);
+
+    // Apply NUMA policy 'mode' ('bind', 'interleave', or 'preferred') over
+    // 'nodes' to the whole pages from 'p' to 'p + nbytes', moving any that
+    // have already been touched. Return whether successful.
+    extern bool bindMemory(char* p, std::size_t nbytes,
+                           const std::string& mode, const std::vector<int>& nodes);
+
     // Round up val to a multiple of mult.
     // Print a message if rounding is done and do_print is set.
     extern idx_t roundUp(std::ostream& os, idx_t val, idx_t mult,
                          const std::string& name, bool do_print);
 
+    // Byte-shuffle 'nelems' elements of 'elem_bytes' bytes each from
+    // 'src' into 'dst', i.e., write byte 0 of every element, then byte 1,
+    // etc. This groups similar bytes (e.g., sign and exponent) together.
+    extern void byteShuffle(const char* src, size_t nelems, size_t elem_bytes, char* dst);
+    extern void byteUnshuffle(const char* src, size_t nelems, size_t elem_bytes, char* dst);
+
+    // Simple LZ77-class byte compressor.
+    // Return number of bytes written to 'dst', or zero if the result would
+    // not fit in 'max_bytes'.
+    extern size_t lzCompress(const char* src, size_t nbytes, char* dst, size_t max_bytes);
+
+    // Decompress from 'src' to 'dst'.
+    // Return number of bytes written to 'dst', or zero if 'src' is corrupt
+    // or the result would not fit in 'max_bytes'.
+    extern size_t lzDecompress(const char* src, size_t nbytes, char* dst, size_t max_bytes);
+
+    // Conversions between FP32 and 16-bit FP formats,
+    // using round-to-nearest-even.
+    extern uint16_t floatToHalf(float f);
+    extern float halfToFloat(uint16_t h);
+    extern uint16_t floatToBfloat16(float f);
+    extern float bfloat16ToFloat(uint16_t h);
+
     // Helpers for shared and aligned malloc and free.
     // Use like this:
     // shared_ptr<char> p(alignedAlloc(nbytes), AlignedDeleter());
@@ -72,6 +127,20 @@ namespace yask {
         }
     };
 
+    // Allocate 'nbytes' using the page policy 'policy': 'none' for
+    // alignedAlloc(), 'thp' for transparent huge pages requested via
+    // madvise(), or 'hugetlb' for pages from the huge-page pool via
+    // mmap().  If 'hugetlb' fails, 'thp' is tried; if 'thp' is not
+    // supported, 'none' is used. The policy actually used is returned in
+    // 'used_policy'.
+    extern std::shared_ptr<char> pageAlloc(std::size_t nbytes,
+                                           const std::string& policy,
+                                           std::string& used_policy);
+
+    // Number of bytes from 'p' to 'p + nbytes' currently backed by huge
+    // pages, as reported in /proc/self/smaps, or zero if unknown.
+    extern std::size_t getHugePageBytes(const char* p, std::size_t nbytes);
+
     // A class for maintaining elapsed time.
     class YaskTimer {
 
@@ -219,6 +288,21 @@ namespace yask {
             virtual bool check_arg(std::vector<std::string>& args, int& argi);
         };
 
+        // An allowed string option.
+        class StringOption : public OptionBase {
+            std::string& _val;
+            
+        public:
+            StringOption(const std::string& name,
+                         const std::string& help_msg,
+                         std::string& val) :
+                OptionBase(name, help_msg), _val(val) { }
+
+            virtual void print_help(std::ostream& os,
+                                    int width) const;
+            virtual bool check_arg(std::vector<std::string>& args, int& argi);
+        };
+
         // An allowed idx_t option that sets multiple vars.
         class MultiIdxOption : public OptionBase {
             std::vector<idx_t*> _vals;
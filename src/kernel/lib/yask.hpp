@@ -71,6 +71,9 @@ typedef std::uint64_t uidx_t;
 #include <vector>
 
 #ifndef WIN32
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 #include <stdint.h>
 #include <immintrin.h>
@@ -104,7 +107,11 @@ typedef std::uint64_t uidx_t;
 
 // MPI or stubs.
 #ifdef USE_MPI
+#ifdef USE_MPI_EMU
+#include "mpi_emu.hpp"
+#else
 #include "mpi.h"
+#endif
 #else
 #define MPI_PROC_NULL (-1)
 #define MPI_Barrier(comm) ((void)0)
@@ -181,9 +188,8 @@ inline void omp_set_nested(int n) { }
 #define L2_HINT _MM_HINT_T1
 
 ////// Default prefetch distances.
-// These are only used if and when prefetch code is generated by
-// gen-loops.pl.
-// TODO: move prefetch generation to stencil compiler.
+// These are the initial values of the '-pfd_l1' and '-pfd_l2'
+// options, which may be changed at run-time.
 
 // How far to prefetch ahead for L1 (0 => no prefetch).
 #ifndef PFD_L1
@@ -29,6 +29,10 @@ IN THE SOFTWARE.
 #include <iostream>
 #include <vector>
 #include <set>
+#include <cstdio>
+#include <cmath>
+#include <map>
+#include <algorithm>
 
 using namespace std;
 using namespace yask;
@@ -67,6 +71,22 @@ int main() {
         fgrid_sizes.push_back(5);
     auto fgrid = soln->new_fixed_size_grid("fgrid", soln_dims, fgrid_sizes);
 
+    // Request NUMA placement for the first two grids that are not
+    // fixed-size.  The remaining grids use the '-mem_policy' option.
+    vector<string> mem_policies = { "default", "interleave:0" };
+    size_t npolicies = 0;
+    for (auto grid : soln->get_grids()) {
+        if (grid->is_fixed_size() || npolicies >= mem_policies.size())
+            continue;
+        auto& policy = mem_policies[npolicies++];
+        grid->set_mem_policy(policy);
+        if (grid->get_mem_policy() != policy) {
+            cout << "Error: memory policy for grid '" << grid->get_name() <<
+                "' is '" << grid->get_mem_policy() << "' instead of '" << policy << "'.\n";
+            return 1;
+        }
+    }
+
     // Simple rank configuration in 1st dim only.
     auto ddim1 = soln_dims[0];
     soln->set_num_ranks(ddim1, env->get_num_ranks());
@@ -88,6 +108,8 @@ int main() {
     cout << endl;
 
     // Print out some info about the grids and init their data.
+    // Save the slices that are set so the data can be recreated below.
+    map<string, pair<vector<idx_t>, vector<idx_t>>> init_slices;
     for (auto grid : soln->get_grids()) {
         cout << "    " << grid->get_name() << "(";
         for (auto dname : grid->get_dim_names())
@@ -149,6 +171,7 @@ int main() {
         // Init the values using the indices created above.
         idx_t nset = grid->set_elements_in_slice_same(0.9, first_indices, last_indices);
         cout << "      " << nset << " element(s) set.\n";
+        init_slices[grid->get_name()] = make_pair(first_indices, last_indices);
 
         // Raw access to this grid.
         auto raw_p = grid->get_raw_storage_buffer();
@@ -168,6 +191,98 @@ int main() {
     cout << "Running the solution for 10 more steps...\n";
     soln->run_solution(1, 10);
 
+    // Save the current settings to a tuner DB.
+    string db_file = "yask_kernel_api_test.tuner_db";
+    if (env->get_rank_index() == 0)
+        remove(db_file.c_str());
+    env->global_barrier();
+    cout << "Saving settings to '" << db_file << "'...\n";
+    soln->save_auto_tuner_db(db_file);
+
+    // Make another solution with the same domain, but default block
+    // sizes, and load the settings from the DB.
+    auto soln2 = kfac.new_solution(env);
+    for (auto dim_name : soln_dims) {
+        soln2->set_rank_domain_size(dim_name, 128);
+        soln2->set_min_pad_size(dim_name, 1);
+    }
+    soln2->set_num_ranks(ddim1, env->get_num_ranks());
+    soln2->prepare_solution();
+    cout << "Loading settings from '" << db_file << "'...\n";
+    if (!soln2->load_auto_tuner_db(db_file)) {
+        cout << "Error: no settings loaded from '" << db_file << "'.\n";
+        return 1;
+    }
+    for (auto dim_name : soln_dims) {
+        if (soln2->get_block_size(dim_name) != soln->get_block_size(dim_name)) {
+            cout << "Error: block size in '" << dim_name << "' is " <<
+                soln2->get_block_size(dim_name) << " after loading but " <<
+                soln->get_block_size(dim_name) << " when saved.\n";
+            return 1;
+        }
+    }
+    env->global_barrier();
+    if (env->get_rank_index() == 0)
+        remove(db_file.c_str());
+
+    // Init the second solution in the same way, but with the default
+    // memory policies, and run it for the same steps.
+    for (auto grid2 : soln2->get_grids()) {
+        grid2->set_all_elements_same(0.1);
+        auto si = init_slices.find(grid2->get_name());
+        if (si != init_slices.end())
+            grid2->set_elements_in_slice_same(0.9, si->second.first, si->second.second);
+    }
+    env->global_barrier();
+    cout << "Running the second solution for 11 steps...\n";
+    soln2->run_solution(0);
+    soln2->run_solution(1, 10);
+
+    // The results must not depend on where the data is placed.
+    cout << "Comparing the results...\n";
+    auto step_dim = soln->get_step_dim_name();
+    for (auto grid : soln->get_grids()) {
+        if (grid->is_fixed_size())
+            continue;
+        auto grid2 = soln2->get_grid(grid->get_name());
+
+        // Indices of the rank domain at the last step.
+        vector<idx_t> first_indices, last_indices;
+        idx_t nelems = 1;
+        for (auto dname : grid->get_dim_names()) {
+            idx_t first_idx, last_idx;
+            if (domain_dim_set.count(dname)) {
+                first_idx = grid->get_first_rank_domain_index(dname);
+                last_idx = grid->get_last_rank_domain_index(dname);
+            }
+            else if (dname == step_dim)
+                first_idx = last_idx = 11; // Written by step 10.
+            else {
+                first_idx = grid->get_first_misc_index(dname);
+                last_idx = grid->get_last_misc_index(dname);
+            }
+            first_indices.push_back(first_idx);
+            last_indices.push_back(last_idx);
+            nelems *= last_idx - first_idx + 1;
+        }
+        auto nbytes = soln->get_element_bytes();
+        vector<char> buf(nelems * nbytes), buf2(nelems * nbytes);
+        grid->get_elements_in_slice(buf.data(), first_indices, last_indices);
+        grid2->get_elements_in_slice(buf2.data(), first_indices, last_indices);
+        idx_t nbad = 0;
+        for (idx_t i = 0; i < nelems; i++) {
+            double val = (nbytes == 4) ? ((float*)buf.data())[i] : ((double*)buf.data())[i];
+            double val2 = (nbytes == 4) ? ((float*)buf2.data())[i] : ((double*)buf2.data())[i];
+            if (abs(val - val2) > 1e-3 * max(abs(val), abs(val2)))
+                nbad++;
+        }
+        cout << "  " << grid->get_name() << ": " << nbad << " mismatch(es).\n";
+        if (nbad) {
+            cout << "TEST FAILED on rank " << env->get_rank_index() << ".\n";
+            return 1;
+        }
+    }
+
     cout << "End of YASK kernel API test.\n";
     return 0;
 }
@@ -41,6 +41,7 @@ struct AppSettings : public KernelSettings {
     bool validate = false;      // whether to do validation run.
     int pre_trial_sleep_time = 1; // sec to sleep before each trial.
     int debug_sleep = 0;          // sec to sleep for debug attach.
+    std::string tune_db;          // file of saved auto-tuner settings.
 
     AppSettings(DimsPtr dims, KernelEnvPtr env) :
         KernelSettings(dims, env) { }
@@ -111,6 +112,13 @@ struct AppSettings : public KernelSettings {
                            "values for block sizes. "
                            "Uses default values or command-line-provided values as a starting point.",
                            doAutoTune));
+        parser.add_option(new CommandLineParser::StringOption
+                          ("auto_tune_db",
+                           "Name of file holding auto-tuner settings. "
+                           "If it has settings for this solution, they are used "
+                           "instead of pre-auto-tuning. "
+                           "Settings found by the auto-tuner are saved to it.",
+                           tune_db));
         parser.add_option(new CommandLineParser::BoolOption
                           ("warmup",
                            "Run warmup iteration(s) before performance "
@@ -217,7 +225,8 @@ void alloc_steps(yk_solution_ptr soln, const AppSettings& opts) {
 }
 
 // Parse command-line args, run kernel, run validation if requested.
-int main(int argc, char** argv)
+// Called once per rank.
+int run_rank(int argc, char** argv)
 {
     // Stop collecting VTune data.
     // Even better to use -start-paused option.
@@ -278,9 +287,18 @@ int main(int argc, char** argv)
         divLine += "─";
     divLine += "\n";
 
+    // Use saved auto-tuner settings if available.
+    bool doPreAutoTune = opts->doPreAutoTune;
+    bool useTuneDb = opts->tune_db.length() > 0;
+    if (useTuneDb && ksoln->load_auto_tuner_db(opts->tune_db))
+        doPreAutoTune = false;
+
     // Invoke auto-tuner.
-    if (opts->doPreAutoTune)
+    if (doPreAutoTune) {
         ksoln->run_auto_tuner_now();
+        if (useTuneDb)
+            ksoln->save_auto_tuner_db(opts->tune_db);
+    }
 
     // Enable/disable further auto-tuning.
     ksoln->reset_auto_tuner(opts->doAutoTune);
@@ -345,11 +363,16 @@ int main(int argc, char** argv)
         }
     }
 
+    // Save settings found during the trials.
+    if (useTuneDb && opts->doAutoTune && !ksoln->is_auto_tuner_enabled())
+        ksoln->save_auto_tuner_db(opts->tune_db);
+
     os << divLine <<
         "best-elapsed-time (sec):           " << makeNumStr(best_elapsed_time) << endl <<
         "best-throughput (num-points/sec):  " << makeNumStr(best_dpps) << endl <<
         "best-throughput (est-FLOPS):       " << makeNumStr(best_flops) << endl <<
         "best-throughput (num-writes/sec):  " << makeNumStr(best_apps) << endl <<
+        "huge-page-backed data:             " << makeByteStr(context->get_huge_page_bytes()) << endl <<
         divLine <<
         "Notes:\n" <<
         " Num-points is based on overall-problem-size as described above.\n" <<
@@ -415,3 +438,14 @@ int main(int argc, char** argv)
     
     return 0;
 }
+
+int main(int argc, char** argv)
+{
+#ifdef USE_MPI_EMU
+    // Run each rank in its own thread.
+    return runEmulatedRanks(getNumEmulatedRanks(),
+                            [&]() { return run_rank(argc, argv); });
+#else
+    return run_rank(argc, argv);
+#endif
+}